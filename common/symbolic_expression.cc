@@ -70,11 +70,18 @@ Expression NegateMultiplication(const Expression& e) {
 }
 }  // namespace
 
+// Constants and variables are not interned in an ExpressionCache: comparing
+// them is as cheap as looking them up.
 Expression::Expression(const Variable& var)
     : ptr_{make_shared<const ExpressionVar>(var)} {}
 Expression::Expression(const double d) : ptr_{make_cell(d)} {}
 Expression::Expression(std::shared_ptr<const ExpressionCell> ptr)
-    : ptr_{std::move(ptr)} {}
+    : ptr_{std::move(ptr)} {
+  ExpressionCache* const cache{ExpressionCache::current()};
+  if (cache != nullptr && !is_constant(*this) && !is_variable(*this)) {
+    cache->Intern(this);
+  }
+}
 
 ExpressionKind Expression::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
@@ -83,8 +90,8 @@ ExpressionKind Expression::get_kind() const {
 
 void Expression::HashAppend(DelegatingHasher* hasher) const {
   using drake::hash_append;
-  hash_append(*hasher, get_kind());
-  ptr_->HashAppendDetail(hasher);
+  // The cell's hash covers get_kind() and the cell's details.
+  hash_append(*hasher, ptr_->GetHash());
 }
 
 Expression Expression::Zero() {
@@ -115,7 +122,7 @@ Expression Expression::NaN() {
 
 Variables Expression::GetVariables() const {
   DRAKE_ASSERT(ptr_ != nullptr);
-  return ptr_->GetVariables();
+  return ptr_->GetVariablesCached();
 }
 
 bool Expression::EqualTo(const Expression& e) const {
@@ -189,6 +196,11 @@ Expression Expression::EvaluatePartial(const Environment& env) const {
 
 Expression Expression::Expand() const {
   DRAKE_ASSERT(ptr_ != nullptr);
+  ExpressionCache* const cache{ExpressionCache::current()};
+  // Constants and variables are cheaper to redo than to look up.
+  if (cache != nullptr && !is_constant(*this) && !is_variable(*this)) {
+    return cache->Expand(*this);
+  }
   return ptr_->Expand();
 }
 
@@ -208,6 +220,11 @@ Expression Expression::Substitute(const Substitution& s) const {
 
 Expression Expression::Differentiate(const Variable& x) const {
   DRAKE_ASSERT(ptr_ != nullptr);
+  ExpressionCache* const cache{ExpressionCache::current()};
+  // Constants and variables are cheaper to redo than to look up.
+  if (cache != nullptr && !is_constant(*this) && !is_variable(*this)) {
+    return cache->Differentiate(*this, x);
+  }
   return ptr_->Differentiate(x);
 }
 
@@ -859,6 +876,54 @@ const Expression& get_else_expression(const Expression& e) {
 Expression operator+(const Variable& var) { return Expression{var}; }
 Expression operator-(const Variable& var) { return -Expression{var}; }
 
+namespace {
+// The innermost ExpressionCache alive on this thread.
+thread_local ExpressionCache* current_expression_cache{nullptr};
+}  // namespace
+
+ExpressionCache::ExpressionCache() : enclosing_{current_expression_cache} {
+  current_expression_cache = this;
+}
+
+ExpressionCache::~ExpressionCache() {
+  DRAKE_DEMAND(current_expression_cache == this);
+  current_expression_cache = enclosing_;
+}
+
+ExpressionCache* ExpressionCache::current() { return current_expression_cache; }
+
+void ExpressionCache::Intern(Expression* const e) {
+  const auto it = expressions_.insert(*e).first;
+  e->ptr_ = it->ptr_;
+}
+
+Expression ExpressionCache::Expand(const Expression& e) {
+  const auto it = expansions_.find(e);
+  if (it != expansions_.end()) {
+    return it->second;
+  }
+  // Expanding the subexpressions of e goes through this cache again, so that
+  // the iterators of expansions_ must not be held across this call.
+  Expression result{e.ptr_->Expand()};
+  expansions_.emplace(e, result);
+  return result;
+}
+
+Expression ExpressionCache::Differentiate(const Expression& e,
+                                          const Variable& x) {
+  const auto it = derivatives_.find(e);
+  if (it != derivatives_.end()) {
+    const auto it_x = it->second.find(x.get_id());
+    if (it_x != it->second.end()) {
+      return it_x->second;
+    }
+  }
+  // As in Expand(), this recurses into the cache.
+  Expression result{e.ptr_->Differentiate(x)};
+  derivatives_[e].emplace(x.get_id(), result);
+  return result;
+}
+
 VectorX<Variable> GetVariableVector(
     const Eigen::Ref<const VectorX<Expression>>& evec) {
   VectorX<Variable> vec(evec.size());
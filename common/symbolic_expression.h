@@ -16,6 +16,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -494,6 +495,7 @@ class Expression {
 
   friend class ExpressionAddFactory;
   friend class ExpressionMulFactory;
+  friend class ExpressionCache;
 
  private:
   explicit Expression(std::shared_ptr<const ExpressionCell> ptr);
@@ -1286,6 +1288,63 @@ struct ScalarBinaryOpTraits<double, drake::symbolic::Expression, BinaryOp> {
 namespace drake {
 namespace symbolic {
 
+/// Shares the cells of structurally equal expressions, and memoizes
+/// Expression::Expand() and Expression::Differentiate(), for the expressions
+/// built on the current thread while an instance is alive.
+///
+/// Each operation on expressions otherwise allocates a new cell, even when an
+/// equal expression already exists; e.g. the entries of a large Jacobian()
+/// repeat the same subexpressions many times over. Within the scope of a
+/// cache, every new cell is looked up in the cache's table and replaced by an
+/// equal cell which is already there, so that equal subexpressions are stored
+/// once and compared by pointer. The expansion of an expression, and its
+/// derivative with respect to a variable, are computed once.
+///
+/// @code
+/// MatrixX<Expression> J;
+/// {
+///   ExpressionCache cache;
+///   J = Jacobian(f, x);
+/// }
+/// @endcode
+///
+/// The cache keeps every expression in its table alive until it is
+/// destroyed; use it around a bounded computation, not for the lifetime of a
+/// program. Caches may be nested, in which case the innermost one is used.
+/// Expressions built within the scope may be used anywhere after it ends.
+class ExpressionCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionCache)
+
+  /// Starts caching the expressions built on this thread.
+  ExpressionCache();
+
+  /// Stops caching, restoring the enclosing cache (if any).
+  ~ExpressionCache();
+
+  /// Returns the number of distinct expressions in the table.
+  int size() const { return static_cast<int>(expressions_.size()); }
+
+ private:
+  friend class Expression;
+
+  // Returns the cache in effect on this thread, or nullptr.
+  static ExpressionCache* current();
+
+  // Replaces the cell of @p e by the equal cell in the table, adding it to the
+  // table if it is not there yet.
+  void Intern(Expression* e);
+
+  Expression Expand(const Expression& e);
+  Expression Differentiate(const Expression& e, const Variable& x);
+
+  ExpressionCache* const enclosing_;
+  std::unordered_set<Expression> expressions_;
+  std::unordered_map<Expression, Expression> expansions_;
+  std::unordered_map<Expression, std::unordered_map<Variable::Id, Expression>>
+      derivatives_;
+};
+
 /// Constructs a vector of variables from the vector of variable expressions.
 /// @throws std::logic_error if there is an expression in @p vec which is not a
 /// variable.
@@ -199,6 +199,37 @@ Expression ExpandPow(const Expression& base, const Expression& exponent) {
 ExpressionCell::ExpressionCell(const ExpressionKind k, const bool is_poly)
     : kind_{k}, is_polynomial_{is_poly} {}
 
+size_t ExpressionCell::GetHash() const {
+  size_t result{hash_.load(std::memory_order_relaxed)};
+  if (result == 0) {
+    DefaultHasher hasher;
+    DelegatingHasher delegating_hasher(
+        [&hasher](const void* data, const size_t length) {
+          return hasher(data, length);
+        });
+    using drake::hash_append;
+    hash_append(delegating_hasher, kind_);
+    HashAppendDetail(&delegating_hasher);
+    result = static_cast<size_t>(hasher);
+    hash_.store(result, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+const Variables& ExpressionCell::GetVariablesCached() const {
+  shared_ptr<const Variables> result{std::atomic_load(&variables_)};
+  if (result == nullptr) {
+    shared_ptr<const Variables> computed{
+        make_shared<const Variables>(GetVariables())};
+    // If another thread got there first, use (and keep) its result instead.
+    if (std::atomic_compare_exchange_strong(&variables_, &result, computed)) {
+      result = std::move(computed);
+    }
+  }
+  // The cache is never reset once filled, so that it outlives this reference.
+  return *result;
+}
+
 UnaryExpressionCell::UnaryExpressionCell(const ExpressionKind k,
                                          const Expression& e,
                                          const bool is_poly)
@@ -12,6 +12,7 @@
 #endif
 
 #include <algorithm>  // for cpplint only
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -55,9 +56,19 @@ class ExpressionCell {
    */
   virtual void HashAppendDetail(DelegatingHasher*) const = 0;
 
+  /** Returns the hash of get_kind() and HashAppendDetail(). It is computed
+   * on the first call and cached, so that hashing an expression costs O(1) in
+   * the size of its (already hashed) subexpressions.
+   */
+  size_t GetHash() const;
+
   /** Collects variables in expression. */
   virtual Variables GetVariables() const = 0;
 
+  /** Returns GetVariables(), which is computed on the first call and cached.
+   */
+  const Variables& GetVariablesCached() const;
+
   /** Checks structural equality. */
   virtual bool EqualTo(const ExpressionCell& c) const = 0;
 
@@ -102,10 +113,14 @@ class ExpressionCell {
  protected:
   /** Default constructor. */
   ExpressionCell() = default;
-  /** Move-constructs an ExpressionCell from an rvalue. */
-  ExpressionCell(ExpressionCell&& e) = default;
-  /** Copy-constructs an ExpressionCell from an lvalue. */
-  ExpressionCell(const ExpressionCell& e) = default;
+  /** Move-constructs an ExpressionCell from an rvalue. The cached hash and
+   * variables are not moved. */
+  ExpressionCell(ExpressionCell&& e)
+      : kind_{e.kind_}, is_polynomial_{e.is_polynomial_} {}
+  /** Copy-constructs an ExpressionCell from an lvalue. The cached hash and
+   * variables are not copied. */
+  ExpressionCell(const ExpressionCell& e)
+      : kind_{e.kind_}, is_polynomial_{e.is_polynomial_} {}
   /** Move-assigns (DELETED). */
   ExpressionCell& operator=(ExpressionCell&& e) = delete;
   /** Copy-assigns (DELETED). */
@@ -118,6 +133,12 @@ class ExpressionCell {
  private:
   const ExpressionKind kind_{};
   const bool is_polynomial_{false};
+  // The caches of GetHash() and GetVariablesCached(). A cell may be shared by
+  // expressions on several threads, so that they are filled atomically; two
+  // threads racing to fill one compute the same value. A hash of zero means
+  // "not computed yet" (a cell whose hash is really zero is merely rehashed).
+  mutable std::atomic<size_t> hash_{0};
+  mutable std::shared_ptr<const Variables> variables_;
 };
 
 /** Represents the base class for unary expressions.  */
@@ -0,0 +1,467 @@
+#include "drake/common/symbolic_tape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+
+// Appends the instructions computing an expression to a tape, reusing the
+// instructions of structurally equal expressions and of identical
+// instructions.
+class ExpressionTape::Compiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Compiler)
+
+  Compiler(const Eigen::Ref<const VectorX<Variable>>& variables,
+           ExpressionTape* tape)
+      : tape_{tape} {
+    for (int i = 0; i < variables.size(); ++i) {
+      const bool inserted{
+          variable_slots_.emplace(variables(i).get_id(), i).second};
+      if (!inserted) {
+        throw runtime_error(fmt::format(
+            "ExpressionTape: the variable {} is given more than once.",
+            variables(i)));
+      }
+    }
+    tape_->num_variables_ = variables.size();
+    tape_->initial_values_.assign(variables.size(), 0.0);
+  }
+
+  // Returns the slot holding the value of @p e.
+  int Compile(const Expression& e) {
+    const auto it = expression_slots_.find(e);
+    if (it != expression_slots_.end()) {
+      return it->second;
+    }
+    const int slot{VisitExpression<int>(this, e)};
+    expression_slots_.emplace(e, slot);
+    return slot;
+  }
+
+  int VisitVariable(const Expression& e) {
+    const Variable& v{get_variable(e)};
+    const auto it = variable_slots_.find(v.get_id());
+    if (it == variable_slots_.end()) {
+      throw runtime_error(fmt::format(
+          "ExpressionTape: the variable {} is not given.", v));
+    }
+    return it->second;
+  }
+
+  int VisitConstant(const Expression& e) {
+    return Emit(Op::kConstant, -1, -1, get_constant_value(e));
+  }
+
+  // Emits c₀ + c₁e₁ + ... + cₙeₙ as a chain of (scaled) additions.
+  int VisitAddition(const Expression& e) {
+    int sum{-1};
+    for (const auto& item : get_expr_to_coeff_map_in_addition(e)) {
+      const int term{Compile(item.first)};
+      const double coeff{item.second};
+      if (sum < 0) {
+        sum = coeff == 1.0 ? term : Emit(Op::kScale, term, -1, coeff);
+      } else if (coeff == 1.0) {
+        sum = Emit(Op::kAdd, sum, term, 0.0);
+      } else {
+        sum = Emit(Op::kAddScaled, sum, term, coeff);
+      }
+    }
+    const double constant{get_constant_in_addition(e)};
+    if (sum < 0) {
+      return Emit(Op::kConstant, -1, -1, constant);
+    }
+    return constant == 0.0 ? sum : Emit(Op::kAddConstant, sum, -1, constant);
+  }
+
+  // Emits c * b₁^e₁ * ... * bₙ^eₙ as a chain of multiplications.
+  int VisitMultiplication(const Expression& e) {
+    int product{-1};
+    for (const auto& item : get_base_to_exponent_map_in_multiplication(e)) {
+      const int factor{CompilePow(item.first, item.second)};
+      product = product < 0 ? factor : Emit(Op::kMul, product, factor, 0.0);
+    }
+    const double constant{get_constant_in_multiplication(e)};
+    if (product < 0) {
+      return Emit(Op::kConstant, -1, -1, constant);
+    }
+    return constant == 1.0 ? product
+                           : Emit(Op::kScale, product, -1, constant);
+  }
+
+  int VisitPow(const Expression& e) {
+    return CompilePow(get_first_argument(e), get_second_argument(e));
+  }
+
+  int VisitDivision(const Expression& e) { return VisitBinary(Op::kDiv, e); }
+  int VisitLog(const Expression& e) { return VisitUnary(Op::kLog, e); }
+  int VisitAbs(const Expression& e) { return VisitUnary(Op::kAbs, e); }
+  int VisitExp(const Expression& e) { return VisitUnary(Op::kExp, e); }
+  int VisitSqrt(const Expression& e) { return VisitUnary(Op::kSqrt, e); }
+  int VisitSin(const Expression& e) { return VisitUnary(Op::kSin, e); }
+  int VisitCos(const Expression& e) { return VisitUnary(Op::kCos, e); }
+  int VisitTan(const Expression& e) { return VisitUnary(Op::kTan, e); }
+  int VisitAsin(const Expression& e) { return VisitUnary(Op::kAsin, e); }
+  int VisitAcos(const Expression& e) { return VisitUnary(Op::kAcos, e); }
+  int VisitAtan(const Expression& e) { return VisitUnary(Op::kAtan, e); }
+  int VisitAtan2(const Expression& e) { return VisitBinary(Op::kAtan2, e); }
+  int VisitSinh(const Expression& e) { return VisitUnary(Op::kSinh, e); }
+  int VisitCosh(const Expression& e) { return VisitUnary(Op::kCosh, e); }
+  int VisitTanh(const Expression& e) { return VisitUnary(Op::kTanh, e); }
+  int VisitMin(const Expression& e) { return VisitBinary(Op::kMin, e); }
+  int VisitMax(const Expression& e) { return VisitBinary(Op::kMax, e); }
+  int VisitCeil(const Expression& e) { return VisitUnary(Op::kCeil, e); }
+  int VisitFloor(const Expression& e) { return VisitUnary(Op::kFloor, e); }
+
+  int VisitIfThenElse(const Expression&) {
+    throw runtime_error(
+        "ExpressionTape does not support if-then-else expressions.");
+  }
+
+  int VisitUninterpretedFunction(const Expression&) {
+    throw runtime_error(
+        "ExpressionTape does not support uninterpreted functions.");
+  }
+
+ private:
+  int VisitUnary(Op op, const Expression& e) {
+    return Emit(op, Compile(get_argument(e)), -1, 0.0);
+  }
+
+  int VisitBinary(Op op, const Expression& e) {
+    const int a{Compile(get_first_argument(e))};
+    const int b{Compile(get_second_argument(e))};
+    return Emit(op, a, b, 0.0);
+  }
+
+  // Emits pow(base, exponent), with the cheaper forms for the common case of
+  // a constant exponent.
+  int CompilePow(const Expression& base, const Expression& exponent) {
+    const int a{Compile(base)};
+    if (!is_constant(exponent)) {
+      return Emit(Op::kPow, a, Compile(exponent), 0.0);
+    }
+    const double k{get_constant_value(exponent)};
+    if (k == 1.0) {
+      return a;
+    }
+    if (k == 2.0) {
+      return Emit(Op::kMul, a, a, 0.0);
+    }
+    return Emit(Op::kPowConstant, a, -1, k);
+  }
+
+  // Returns the slot of the instruction (op, a, b, k), appending it to the
+  // tape unless the tape already has it.
+  int Emit(Op op, int a, int b, double k) {
+    if ((op == Op::kAdd || op == Op::kMul || op == Op::kMin ||
+         op == Op::kMax) && b < a) {
+      std::swap(a, b);
+    }
+    const auto key = std::make_tuple(op, a, b, k);
+    const auto it = instruction_slots_.find(key);
+    if (it != instruction_slots_.end()) {
+      return it->second;
+    }
+    const int slot{tape_->num_variables_ + tape_->num_instructions()};
+    tape_->tape_.push_back(Instruction{op, a, b, k});
+    tape_->initial_values_.push_back(op == Op::kConstant ? k : 0.0);
+    if (op == Op::kAbs || op == Op::kMin || op == Op::kMax ||
+        op == Op::kCeil || op == Op::kFloor) {
+      tape_->is_differentiable_ = false;
+    }
+    instruction_slots_.emplace(key, slot);
+    return slot;
+  }
+
+  ExpressionTape* const tape_;
+  std::unordered_map<Variable::Id, int> variable_slots_;
+  std::unordered_map<Expression, int> expression_slots_;
+  std::map<std::tuple<Op, int, int, double>, int> instruction_slots_;
+};
+
+ExpressionTape::Workspace::Workspace(const std::vector<double>& initial_values)
+    : values_{Eigen::Map<const Eigen::VectorXd>(initial_values.data(),
+                                                initial_values.size())},
+      adjoints_{Eigen::VectorXd::Zero(initial_values.size())} {}
+
+ExpressionTape::ExpressionTape(
+    const Eigen::Ref<const MatrixX<Expression>>& m,
+    const Eigen::Ref<const VectorX<Variable>>& variables)
+    : rows_(m.rows()), cols_(m.cols()) {
+  Compiler compiler{variables, this};
+  outputs_.reserve(m.size());
+  for (int j = 0; j < m.cols(); ++j) {
+    for (int i = 0; i < m.rows(); ++i) {
+      outputs_.push_back(compiler.Compile(m(i, j)));
+    }
+  }
+}
+
+ExpressionTape::ExpressionTape(
+    const Expression& e, const Eigen::Ref<const VectorX<Variable>>& variables)
+    : ExpressionTape(Vector1<Expression>(e), variables) {}
+
+ExpressionTape::Workspace ExpressionTape::AllocateWorkspace() const {
+  return Workspace{initial_values_};
+}
+
+void ExpressionTape::Evaluate(const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Workspace* workspace,
+                              EigenPtr<Eigen::MatrixXd> value) const {
+  DRAKE_DEMAND(workspace != nullptr);
+  DRAKE_DEMAND(value != nullptr);
+  DRAKE_DEMAND(value->rows() == rows_ && value->cols() == cols_);
+  Forward(x, workspace);
+  const Eigen::VectorXd& values = workspace->values_;
+  for (int j = 0; j < cols_; ++j) {
+    for (int i = 0; i < rows_; ++i) {
+      (*value)(i, j) = values[outputs_[i + j * rows_]];
+    }
+  }
+}
+
+void ExpressionTape::EvaluateJacobian(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Workspace* workspace,
+    EigenPtr<Eigen::MatrixXd> value, EigenPtr<Eigen::MatrixXd> jacobian) const {
+  DRAKE_DEMAND(workspace != nullptr);
+  DRAKE_DEMAND(jacobian != nullptr);
+  DRAKE_DEMAND(jacobian->rows() == rows_ * cols_ &&
+               jacobian->cols() == num_variables_);
+  if (!is_differentiable_) {
+    throw runtime_error(
+        "ExpressionTape::EvaluateJacobian(): the expressions include abs, "
+        "min, max, ceil or floor, which are not differentiable.");
+  }
+  if (value != nullptr) {
+    Evaluate(x, workspace, value);
+  } else {
+    Forward(x, workspace);
+  }
+  Eigen::VectorXd& adjoints = workspace->adjoints_;
+  for (int e = 0; e < static_cast<int>(outputs_.size()); ++e) {
+    const int output{outputs_[e]};
+    // When the output is a bare variable, the variable slots above it still
+    // hold the previous sweep's adjoints, so always clear all of them.
+    adjoints.head(std::max(output + 1, num_variables_)).setZero();
+    adjoints[output] = 1.0;
+    Reverse(output, workspace);
+    jacobian->row(e) = adjoints.head(num_variables_).transpose();
+  }
+}
+
+void ExpressionTape::Forward(const Eigen::Ref<const Eigen::VectorXd>& x,
+                             Workspace* workspace) const {
+  DRAKE_DEMAND(x.size() == num_variables_);
+  DRAKE_DEMAND(workspace->values_.size() ==
+               static_cast<int>(initial_values_.size()));
+  double* const v = workspace->values_.data();
+  for (int i = 0; i < num_variables_; ++i) {
+    v[i] = x[i];
+  }
+  double* y = v + num_variables_;
+  for (const Instruction& in : tape_) {
+    const double a{in.a >= 0 ? v[in.a] : 0.0};
+    const double b{in.b >= 0 ? v[in.b] : 0.0};
+    switch (in.op) {
+      case Op::kConstant:
+        // Already in place; see initial_values_.
+        break;
+      case Op::kAdd:
+        *y = a + b;
+        break;
+      case Op::kAddConstant:
+        *y = a + in.k;
+        break;
+      case Op::kAddScaled:
+        *y = a + in.k * b;
+        break;
+      case Op::kScale:
+        *y = in.k * a;
+        break;
+      case Op::kMul:
+        *y = a * b;
+        break;
+      case Op::kDiv:
+        *y = a / b;
+        break;
+      case Op::kPow:
+        *y = std::pow(a, b);
+        break;
+      case Op::kPowConstant:
+        *y = std::pow(a, in.k);
+        break;
+      case Op::kLog:
+        *y = std::log(a);
+        break;
+      case Op::kAbs:
+        *y = std::fabs(a);
+        break;
+      case Op::kExp:
+        *y = std::exp(a);
+        break;
+      case Op::kSqrt:
+        *y = std::sqrt(a);
+        break;
+      case Op::kSin:
+        *y = std::sin(a);
+        break;
+      case Op::kCos:
+        *y = std::cos(a);
+        break;
+      case Op::kTan:
+        *y = std::tan(a);
+        break;
+      case Op::kAsin:
+        *y = std::asin(a);
+        break;
+      case Op::kAcos:
+        *y = std::acos(a);
+        break;
+      case Op::kAtan:
+        *y = std::atan(a);
+        break;
+      case Op::kAtan2:
+        *y = std::atan2(a, b);
+        break;
+      case Op::kSinh:
+        *y = std::sinh(a);
+        break;
+      case Op::kCosh:
+        *y = std::cosh(a);
+        break;
+      case Op::kTanh:
+        *y = std::tanh(a);
+        break;
+      case Op::kMin:
+        *y = std::min(a, b);
+        break;
+      case Op::kMax:
+        *y = std::max(a, b);
+        break;
+      case Op::kCeil:
+        *y = std::ceil(a);
+        break;
+      case Op::kFloor:
+        *y = std::floor(a);
+        break;
+    }
+    ++y;
+  }
+}
+
+void ExpressionTape::Reverse(int output, Workspace* workspace) const {
+  const double* const v = workspace->values_.data();
+  double* const g = workspace->adjoints_.data();
+  // Instructions after the output's own cannot contribute to it.
+  for (int slot = output; slot >= num_variables_; --slot) {
+    const double g_y{g[slot]};
+    if (g_y == 0.0) {
+      continue;
+    }
+    const Instruction& in = tape_[slot - num_variables_];
+    const double y{v[slot]};
+    const double a{in.a >= 0 ? v[in.a] : 0.0};
+    const double b{in.b >= 0 ? v[in.b] : 0.0};
+    switch (in.op) {
+      case Op::kConstant:
+        break;
+      case Op::kAdd:
+        g[in.a] += g_y;
+        g[in.b] += g_y;
+        break;
+      case Op::kAddConstant:
+        g[in.a] += g_y;
+        break;
+      case Op::kAddScaled:
+        g[in.a] += g_y;
+        g[in.b] += in.k * g_y;
+        break;
+      case Op::kScale:
+        g[in.a] += in.k * g_y;
+        break;
+      case Op::kMul:
+        g[in.a] += g_y * b;
+        g[in.b] += g_y * a;
+        break;
+      case Op::kDiv:
+        g[in.a] += g_y / b;
+        g[in.b] -= g_y * y / b;
+        break;
+      case Op::kPow:
+        g[in.a] += g_y * b * std::pow(a, b - 1.0);
+        g[in.b] += g_y * y * std::log(a);
+        break;
+      case Op::kPowConstant:
+        g[in.a] += g_y * in.k * std::pow(a, in.k - 1.0);
+        break;
+      case Op::kLog:
+        g[in.a] += g_y / a;
+        break;
+      case Op::kExp:
+        g[in.a] += g_y * y;
+        break;
+      case Op::kSqrt:
+        g[in.a] += g_y / (2.0 * y);
+        break;
+      case Op::kSin:
+        g[in.a] += g_y * std::cos(a);
+        break;
+      case Op::kCos:
+        g[in.a] -= g_y * std::sin(a);
+        break;
+      case Op::kTan: {
+        const double cos_a{std::cos(a)};
+        g[in.a] += g_y / (cos_a * cos_a);
+        break;
+      }
+      case Op::kAsin:
+        g[in.a] += g_y / std::sqrt(1.0 - a * a);
+        break;
+      case Op::kAcos:
+        g[in.a] -= g_y / std::sqrt(1.0 - a * a);
+        break;
+      case Op::kAtan:
+        g[in.a] += g_y / (1.0 + a * a);
+        break;
+      case Op::kAtan2: {
+        const double r2{a * a + b * b};
+        g[in.a] += g_y * b / r2;
+        g[in.b] -= g_y * a / r2;
+        break;
+      }
+      case Op::kSinh:
+        g[in.a] += g_y * std::cosh(a);
+        break;
+      case Op::kCosh:
+        g[in.a] += g_y * std::sinh(a);
+        break;
+      case Op::kTanh:
+        g[in.a] += g_y * (1.0 - y * y);
+        break;
+      case Op::kAbs:
+      case Op::kMin:
+      case Op::kMax:
+      case Op::kCeil:
+      case Op::kFloor:
+        // Rejected by EvaluateJacobian() before reaching here.
+        DRAKE_UNREACHABLE();
+    }
+  }
+}
+
+}  // namespace symbolic
+}  // namespace drake
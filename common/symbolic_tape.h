@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// A matrix of symbolic expressions compiled into a flat instruction tape, for
+/// evaluating the same expressions many times at different values of their
+/// variables.
+///
+/// Expression::Evaluate() walks the expression tree and looks up every
+/// variable in an Environment. An %ExpressionTape does that work once, at
+/// construction: the given variables are assigned to dense slots `0, ..., n-1`
+/// and every distinct subexpression becomes one instruction writing one more
+/// slot. Subexpressions which are structurally equal, whether within one
+/// entry or across entries of the matrix, share an instruction. Evaluate()
+/// then runs the instructions in order, and EvaluateJacobian() additionally
+/// sweeps them backwards once per entry (reverse-mode differentiation). Both
+/// work in a Workspace allocated up front, so that they neither allocate nor
+/// hash.
+///
+/// @code
+/// const Variable x{"x"};
+/// const Variable y{"y"};
+/// Vector2<Expression> f;
+/// f << sin(x * y) + x * y, cos(x * y);
+/// const ExpressionTape tape(f, Vector2<Variable>(x, y));
+/// ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+/// Eigen::Vector2d value;
+/// Eigen::Matrix2d J;
+/// tape.EvaluateJacobian(Eigen::Vector2d(1.0, 2.0), &workspace, &value, &J);
+/// @endcode
+///
+/// Unlike Expression::Evaluate(), the tape does not check the domain of the
+/// math functions (e.g. `log(x)` for `x < 0`) nor division by zero; as in the
+/// code from CodeGen(), the result is then whatever IEEE arithmetic gives.
+/// Expressions including if-then-else or uninterpreted functions cannot be
+/// compiled.
+class ExpressionTape {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionTape)
+
+  /// Scratch memory for evaluating an ExpressionTape. A workspace may only be
+  /// used by one thread at a time; give each thread its own to evaluate the
+  /// same tape concurrently.
+  class Workspace {
+   public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Workspace)
+
+   private:
+    friend class ExpressionTape;
+    explicit Workspace(const std::vector<double>& initial_values);
+
+    // The value of each slot.
+    Eigen::VectorXd values_;
+    // The derivative of the entry being differentiated with respect to each
+    // slot.
+    Eigen::VectorXd adjoints_;
+  };
+
+  /// Compiles the entries of @p m, with @p variables mapped in order to the
+  /// entries of the argument `x` of the evaluation methods.
+  ///
+  /// @throws std::runtime_error if @p variables includes a variable twice, if
+  /// @p m includes a variable which is not in @p variables, or if @p m
+  /// includes NaN, an if-then-else, or an uninterpreted function.
+  ExpressionTape(const Eigen::Ref<const MatrixX<Expression>>& m,
+                 const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /// Compiles the single expression @p e as a 1x1 matrix.
+  ExpressionTape(const Expression& e,
+                 const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  /// Returns the number of rows of the compiled matrix.
+  int rows() const { return rows_; }
+
+  /// Returns the number of columns of the compiled matrix.
+  int cols() const { return cols_; }
+
+  /// Returns the number of variables, which is the size of `x`.
+  int num_variables() const { return num_variables_; }
+
+  /// Returns the number of instructions on the tape, which measures the cost
+  /// of one evaluation.
+  int num_instructions() const { return static_cast<int>(tape_.size()); }
+
+  /// Returns true if EvaluateJacobian() may be used; that is, if the compiled
+  /// expressions include no abs, min, max, ceil or floor. Those are not
+  /// differentiable by Expression::Differentiate() either.
+  bool is_differentiable() const { return is_differentiable_; }
+
+  /// Allocates the scratch memory used by the evaluation methods.
+  Workspace AllocateWorkspace() const;
+
+  /// Evaluates the compiled matrix at @p x into @p value.
+  ///
+  /// @pre x.size() == num_variables().
+  /// @pre value->rows() == rows() and value->cols() == cols().
+  /// @pre @p workspace was allocated by this tape (or a copy of it).
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& x,
+                Workspace* workspace, EigenPtr<Eigen::MatrixXd> value) const;
+
+  /// Evaluates the compiled matrix at @p x into @p value, unless @p value is
+  /// nullptr, and its Jacobian with respect to the variables into @p
+  /// jacobian. Row `i + j * rows()` of the Jacobian is the gradient of entry
+  /// `(i, j)`, i.e. the entries are taken in column-major order.
+  ///
+  /// @throws std::runtime_error if not is_differentiable().
+  /// @pre x.size() == num_variables().
+  /// @pre jacobian->rows() == rows() * cols() and
+  ///      jacobian->cols() == num_variables().
+  /// @pre @p workspace was allocated by this tape (or a copy of it).
+  void EvaluateJacobian(const Eigen::Ref<const Eigen::VectorXd>& x,
+                        Workspace* workspace, EigenPtr<Eigen::MatrixXd> value,
+                        EigenPtr<Eigen::MatrixXd> jacobian) const;
+
+ private:
+  // The operation of an instruction, which reads the slots `a` and `b` and
+  // the constant `k`.
+  enum class Op : std::uint8_t {
+    kConstant,     // k
+    kAdd,          // a + b
+    kAddConstant,  // a + k
+    kAddScaled,    // a + k * b
+    kScale,        // k * a
+    kMul,          // a * b
+    kDiv,          // a / b
+    kPow,          // pow(a, b)
+    kPowConstant,  // pow(a, k)
+    // The remaining operations apply the function of the same name to a, or
+    // to a and b for atan2, min and max.
+    kLog,
+    kAbs,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kAtan2,
+    kSinh,
+    kCosh,
+    kTanh,
+    kMin,
+    kMax,
+    kCeil,
+    kFloor,
+  };
+
+  // The i'th instruction on the tape writes slot `num_variables() + i`.
+  struct Instruction {
+    Op op;
+    int a;
+    int b;
+    double k;
+  };
+
+  // Builds the tape; defined in symbolic_tape.cc.
+  class Compiler;
+
+  // Runs the tape forward from @p x, leaving the value of every slot in
+  // @p workspace.
+  void Forward(const Eigen::Ref<const Eigen::VectorXd>& x,
+               Workspace* workspace) const;
+
+  // Adds the derivative of slot @p output with respect to every slot into
+  // the adjoints of @p workspace, which must be zero on entry.
+  void Reverse(int output, Workspace* workspace) const;
+
+  int rows_{0};
+  int cols_{0};
+  int num_variables_{0};
+  bool is_differentiable_{true};
+  std::vector<Instruction> tape_;
+  // The slot holding each entry of the matrix, in column-major order.
+  std::vector<int> outputs_;
+  // The value of each slot before the tape is run. The constant instructions
+  // already hold their value here, so that Forward() skips them.
+  std::vector<double> initial_values_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
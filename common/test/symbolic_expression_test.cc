@@ -2647,6 +2647,66 @@ TEST_F(SymbolicExpressionTest, EvaluateExpressionsIncludingRandomVariables) {
   }
 }
 
+TEST_F(SymbolicExpressionTest, ExpressionCacheSharesEqualExpressions) {
+  ExpressionCache cache;
+  const Expression e1{sin(x_ + y_) * (x_ + y_)};
+  const int size = cache.size();
+  EXPECT_GT(size, 0);
+  // Rebuilding an equal expression adds nothing to the table.
+  const Expression e2{sin(x_ + y_) * (x_ + y_)};
+  EXPECT_EQ(cache.size(), size);
+  EXPECT_PRED2(ExprEqual, e1, e2);
+  const Expression e3{cos(x_ + y_)};
+  EXPECT_GT(cache.size(), size);
+}
+
+TEST_F(SymbolicExpressionTest, ExpressionCacheMatchesUncached) {
+  const Expression e{pow(x_ + y_, 3) * sin(x_ * z_) + exp(x_ / y_)};
+  const Expression expanded{e.Expand()};
+  const RowVectorX<Expression> J{e.Jacobian(Vector3<Variable>(var_x_, var_y_,
+                                                              var_z_))};
+  Expression expanded_cached;
+  RowVectorX<Expression> J_cached;
+  {
+    ExpressionCache cache;
+    expanded_cached = e.Expand();
+    // The second calls are answered from the cache.
+    EXPECT_PRED2(ExprEqual, e.Expand(), expanded_cached);
+    J_cached = e.Jacobian(Vector3<Variable>(var_x_, var_y_, var_z_));
+    EXPECT_PRED2(ExprEqual, e.Differentiate(var_y_), J_cached(1));
+  }
+  // The results outlive the cache.
+  EXPECT_PRED2(ExprEqual, expanded_cached, expanded);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_PRED2(ExprEqual, J_cached(i), J(i));
+  }
+}
+
+TEST_F(SymbolicExpressionTest, ExpressionCacheNesting) {
+  ExpressionCache outer;
+  const Expression e1{x_ * y_};
+  const int outer_size = outer.size();
+  {
+    ExpressionCache inner;
+    const Expression e2{x_ * y_ + 1};
+    EXPECT_GT(inner.size(), 0);
+    EXPECT_EQ(outer.size(), outer_size);
+  }
+  const Expression e3{x_ * y_ + 1};
+  EXPECT_GT(outer.size(), outer_size);
+}
+
+TEST_F(SymbolicExpressionTest, CachedHashAndVariables) {
+  const Expression e1{sin(x_ * y_) + z_};
+  const Expression e2{sin(x_ * y_) + z_};
+  const std::hash<Expression> hasher;
+  EXPECT_EQ(hasher(e1), hasher(e2));
+  EXPECT_EQ(hasher(e1), hasher(e1));
+  EXPECT_NE(hasher(e1), hasher(sin(x_ * y_) + x_));
+  EXPECT_EQ(e1.GetVariables(), Variables({var_x_, var_y_, var_z_}));
+  EXPECT_EQ(e1.GetVariables(), Variables({var_x_, var_y_, var_z_}));
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
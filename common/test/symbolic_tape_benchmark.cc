@@ -0,0 +1,113 @@
+#include <iostream>
+#include <string>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/symbolic_tape.h"
+#include "drake/common/test_utilities/measure_execution.h"
+
+DEFINE_int32(repetitions, 1000,
+             "Number of evaluations timed for each problem size.");
+
+// Compares the cost of evaluating a vector of symbolic expressions, and its
+// Jacobian, with Expression::Evaluate() against an ExpressionTape, for vectors
+// of increasing size. Each entry mixes polynomial and trigonometric terms of
+// its own and its neighbours' variables, as in the dynamics of a chain.
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// Returns f(x) with f_i = sin(x_i - x_{i-1}) * x_{i+1}² + cos(x_i) * x_{i-1}
+// + exp(-x_i²) (with the neighbours of the ends taken as zero).
+VectorX<Expression> MakeChainExpressions(const VectorX<Variable>& x) {
+  const int n = x.size();
+  VectorX<Expression> f(n);
+  for (int i = 0; i < n; ++i) {
+    const Expression previous = i > 0 ? Expression{x(i - 1)} : Expression{0};
+    const Expression next = i + 1 < n ? Expression{x(i + 1)} : Expression{0};
+    f(i) = sin(x(i) - previous) * next * next + cos(x(i)) * previous +
+           exp(-x(i) * x(i));
+  }
+  return f;
+}
+
+int do_main() {
+  std::cout << "      n   instructions   Evaluate [us]   tape [us]"
+               "   Evaluate Jacobian [us]   tape Jacobian [us]\n";
+  for (int n : {2, 4, 8, 16, 32, 64}) {
+    const VectorX<Variable> x = MakeVectorContinuousVariable(n, "x");
+    const VectorX<Expression> f = MakeChainExpressions(x);
+    const MatrixX<Expression> J = Jacobian(f, x);
+    const ExpressionTape tape(f, x);
+    ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+    const VectorXd x0 = VectorXd::LinSpaced(n, -1.0, 1.0);
+
+    Environment env;
+    VectorXd value_evaluate(n);
+    MatrixXd J_evaluate(n, n);
+    const double evaluate_time = common::test::MeasureExecutionTime([&]() {
+      for (int k = 0; k < FLAGS_repetitions; ++k) {
+        for (int i = 0; i < n; ++i) {
+          env[x(i)] = x0(i) * (1.0 + 1e-3 * k);
+        }
+        for (int i = 0; i < n; ++i) {
+          value_evaluate(i) = f(i).Evaluate(env);
+        }
+      }
+    });
+    const double evaluate_jacobian_time =
+        common::test::MeasureExecutionTime([&]() {
+          for (int k = 0; k < FLAGS_repetitions; ++k) {
+            for (int i = 0; i < n; ++i) {
+              env[x(i)] = x0(i) * (1.0 + 1e-3 * k);
+            }
+            for (int i = 0; i < n; ++i) {
+              value_evaluate(i) = f(i).Evaluate(env);
+            }
+            J_evaluate = Evaluate(J, env);
+          }
+        });
+
+    VectorXd x_k(n);
+    MatrixXd value_tape(n, 1);
+    MatrixXd J_tape(n, n);
+    const double tape_time = common::test::MeasureExecutionTime([&]() {
+      for (int k = 0; k < FLAGS_repetitions; ++k) {
+        x_k = x0 * (1.0 + 1e-3 * k);
+        tape.Evaluate(x_k, &workspace, &value_tape);
+      }
+    });
+    const double tape_jacobian_time =
+        common::test::MeasureExecutionTime([&]() {
+          for (int k = 0; k < FLAGS_repetitions; ++k) {
+            x_k = x0 * (1.0 + 1e-3 * k);
+            tape.EvaluateJacobian(x_k, &workspace, &value_tape, &J_tape);
+          }
+        });
+
+    std::cout << fmt::format(
+        "{:7d} {:14d} {:15.2f} {:11.2f} {:24.2f} {:20.2f}\n", n,
+        tape.num_instructions(), 1e6 * evaluate_time / FLAGS_repetitions,
+        1e6 * tape_time / FLAGS_repetitions,
+        1e6 * evaluate_jacobian_time / FLAGS_repetitions,
+        1e6 * tape_jacobian_time / FLAGS_repetitions);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the evaluation of symbolic expressions and their Jacobian by "
+      "Expression::Evaluate() and by an ExpressionTape.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::symbolic::do_main();
+}
@@ -0,0 +1,203 @@
+#include "drake/common/symbolic_tape.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+const double kTol = 1e-12;
+
+class SymbolicTapeTest : public ::testing::Test {
+ protected:
+  void SetUp() override { vars_ << x_, y_, z_; }
+
+  // Returns the value of @p m at @p x by Expression::Evaluate().
+  MatrixXd EvaluateExpressions(const MatrixX<Expression>& m,
+                               const VectorXd& x) const {
+    const Environment env{{x_, x(0)}, {y_, x(1)}, {z_, x(2)}};
+    return m.unaryExpr([&env](const Expression& e) {
+      return e.Evaluate(env);
+    });
+  }
+
+  // Checks the tape of @p f against Expression::Evaluate() and, unless
+  // @p differentiable is false, against symbolic::Jacobian().
+  void CheckTape(const VectorX<Expression>& f, const VectorXd& x,
+                 bool differentiable = true) const {
+    const ExpressionTape tape(f, vars_);
+    EXPECT_EQ(tape.rows(), f.size());
+    EXPECT_EQ(tape.cols(), 1);
+    EXPECT_EQ(tape.num_variables(), 3);
+    EXPECT_EQ(tape.is_differentiable(), differentiable);
+    ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+    MatrixXd value(f.size(), 1);
+    tape.Evaluate(x, &workspace, &value);
+    EXPECT_TRUE(CompareMatrices(value, EvaluateExpressions(f, x), kTol));
+    if (differentiable) {
+      MatrixXd J(f.size(), 3);
+      value.setZero();
+      tape.EvaluateJacobian(x, &workspace, &value, &J);
+      EXPECT_TRUE(CompareMatrices(value, EvaluateExpressions(f, x), kTol));
+      EXPECT_TRUE(CompareMatrices(
+          J, EvaluateExpressions(Jacobian(f, vars_), x), kTol));
+    }
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  Vector3<Variable> vars_;
+  const Vector3d x0_{0.3, -0.7, 1.9};
+};
+
+TEST_F(SymbolicTapeTest, Arithmetic) {
+  VectorX<Expression> f(7);
+  f << 3.0,
+       y_,
+       2 + 3 * x_ - y_ + z_,
+       -2 * x_ * y_ * y_ * z_,
+       x_ / (y_ + z_),
+       pow(x_, 3) + pow(z_, -0.5) + pow(z_, x_),
+       (x_ + y_) * (x_ + y_) - 4 / x_;
+  CheckTape(f, x0_);
+}
+
+TEST_F(SymbolicTapeTest, MathFunctions) {
+  VectorX<Expression> f(13);
+  f << log(z_),
+       exp(x_ * y_),
+       sqrt(z_ + x_),
+       sin(x_),
+       cos(y_),
+       tan(x_ - y_),
+       asin(x_),
+       acos(y_),
+       atan(z_),
+       atan2(y_, x_),
+       sinh(y_),
+       cosh(z_),
+       tanh(x_ * z_);
+  CheckTape(f, x0_);
+}
+
+TEST_F(SymbolicTapeTest, NonDifferentiableFunctions) {
+  VectorX<Expression> f(5);
+  f << abs(y_), min(x_, y_), max(x_, z_), ceil(z_), floor(y_);
+  CheckTape(f, x0_, false);
+  const ExpressionTape tape(f, vars_);
+  ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+  MatrixXd J(5, 3);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      tape.EvaluateJacobian(x0_, &workspace, nullptr, &J), std::runtime_error,
+      ".*not differentiable.*");
+}
+
+// A bare variable after a nontrivial entry must not see the adjoints that
+// the earlier entry's reverse sweep left in the variable slots.
+TEST_F(SymbolicTapeTest, BareVariableAfterProduct) {
+  VectorX<Expression> f(3);
+  f << x_ * y_, x_, z_ * y_;
+  CheckTape(f, x0_);
+  const ExpressionTape tape(f, vars_);
+  ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+  MatrixXd J(3, 3);
+  tape.EvaluateJacobian(Vector3d(3, 5, 7), &workspace, nullptr, &J);
+  MatrixXd J_expected(3, 3);
+  J_expected << 5, 3, 0,
+                1, 0, 0,
+                0, 7, 5;
+  EXPECT_TRUE(CompareMatrices(J, J_expected, kTol));
+}
+
+TEST_F(SymbolicTapeTest, Matrix) {
+  Eigen::Matrix<Expression, 2, 3> m;
+  m << x_, y_ * z_, 1.0,
+       sin(x_), x_ + y_, z_ * z_;
+  const ExpressionTape tape(m, vars_);
+  EXPECT_EQ(tape.rows(), 2);
+  EXPECT_EQ(tape.cols(), 3);
+  ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+  Eigen::Matrix<double, 2, 3> value;
+  tape.Evaluate(x0_, &workspace, &value);
+  EXPECT_TRUE(CompareMatrices(value, EvaluateExpressions(m, x0_), kTol));
+
+  // The rows of the Jacobian are the entries of m in column-major order.
+  MatrixXd J(6, 3);
+  tape.EvaluateJacobian(x0_, &workspace, nullptr, &J);
+  const VectorX<Expression> m_flat =
+      Eigen::Map<const VectorX<Expression>>(m.data(), m.size());
+  EXPECT_TRUE(CompareMatrices(
+      J, EvaluateExpressions(Jacobian(m_flat, vars_), x0_), kTol));
+}
+
+TEST_F(SymbolicTapeTest, CommonSubexpressions) {
+  // sin(x * y) is computed once for both entries, and x * y once for all
+  // three of its uses.
+  const Expression xy{x_ * y_};
+  Vector2<Expression> f;
+  f << sin(xy) + xy, cos(xy) * sin(xy);
+  const ExpressionTape tape(f, vars_);
+  // x * y, sin, sin + x * y, cos, cos * sin.
+  EXPECT_EQ(tape.num_instructions(), 5);
+  CheckTape(f, x0_);
+}
+
+TEST_F(SymbolicTapeTest, RepeatedEvaluation) {
+  const Expression e{x_ * x_ * y_ + exp(z_) * y_};
+  const ExpressionTape tape(e, vars_);
+  ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+  MatrixXd value(1, 1);
+  MatrixXd J(1, 3);
+  for (double t : {-1.0, 0.0, 0.5, 2.0}) {
+    const Vector3d x{t, 2.0 * t, t - 1.0};
+    tape.EvaluateJacobian(x, &workspace, &value, &J);
+    EXPECT_NEAR(value(0, 0), EvaluateExpressions(Vector1<Expression>(e), x)(0),
+                kTol);
+    EXPECT_TRUE(CompareMatrices(
+        J, EvaluateExpressions(e.Jacobian(vars_), x), kTol));
+  }
+}
+
+TEST_F(SymbolicTapeTest, NoHeapAllocation) {
+  Vector2<Expression> f;
+  f << x_ * sin(y_) + z_, pow(x_, 2.5) / z_;
+  const ExpressionTape tape(f, vars_);
+  ExpressionTape::Workspace workspace = tape.AllocateWorkspace();
+  MatrixXd value(2, 1);
+  MatrixXd J(2, 3);
+  const VectorXd x = x0_.cwiseAbs();
+  {
+    test::LimitMalloc guard;
+    tape.Evaluate(x, &workspace, &value);
+    tape.EvaluateJacobian(x, &workspace, &value, &J);
+  }
+}
+
+TEST_F(SymbolicTapeTest, Errors) {
+  const Variable w{"w"};
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(x_ + w, vars_), std::runtime_error,
+      "ExpressionTape: the variable w is not given.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(x_, Vector2<Variable>(x_, x_)), std::runtime_error,
+      "ExpressionTape: the variable x is given more than once.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(if_then_else(x_ > y_, x_, y_), vars_),
+      std::runtime_error, ".*if-then-else.*");
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
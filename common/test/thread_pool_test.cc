@@ -0,0 +1,119 @@
+#include "drake/common/thread_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ThreadPoolTest, Construction) {
+  EXPECT_EQ(ThreadPool(1).num_threads(), 1);
+  EXPECT_EQ(ThreadPool(4).num_threads(), 4);
+  DRAKE_EXPECT_THROWS_MESSAGE(ThreadPool(0), std::logic_error,
+                              ".*num_threads must be positive; got 0.*");
+}
+
+// Every iteration runs exactly once, for any number of threads and
+// iterations, and the pool can be reused for several loops.
+GTEST_TEST(ThreadPoolTest, ParallelFor) {
+  for (int num_threads : {1, 2, 3, 8}) {
+    ThreadPool pool(num_threads);
+    for (int num_iterations : {0, 1, 2, 7, 100}) {
+      std::vector<std::atomic<int>> counts(num_iterations);
+      for (auto& count : counts) count = 0;
+      pool.ParallelFor(num_iterations, [&counts](int i) { ++counts[i]; });
+      for (int i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(counts[i], 1) << "num_threads = " << num_threads
+                                << ", iteration " << i;
+      }
+    }
+  }
+}
+
+// With enough blocking iterations, all threads must take part in the loop.
+GTEST_TEST(ThreadPoolTest, UsesAllThreads) {
+  const int kNumThreads = 4;
+  ThreadPool pool(kNumThreads);
+  std::atomic<int> num_arrived{0};
+  std::vector<std::thread::id> ids(kNumThreads);
+  pool.ParallelFor(kNumThreads, [&](int i) {
+    ids[i] = std::this_thread::get_id();
+    // None of the iterations can complete until all of them have started,
+    // which requires each of them to run on a different thread.
+    ++num_arrived;
+    while (num_arrived < kNumThreads) std::this_thread::yield();
+  });
+  for (int i = 0; i < kNumThreads; ++i) {
+    for (int j = i + 1; j < kNumThreads; ++j) {
+      EXPECT_NE(ids[i], ids[j]);
+    }
+  }
+}
+
+// A loop started from within a loop body runs on the calling thread.
+GTEST_TEST(ThreadPoolTest, NestedParallelFor) {
+  ThreadPool pool(3);
+  std::atomic<int> count{0};
+  pool.ParallelFor(5, [&](int) {
+    const std::thread::id outer_id = std::this_thread::get_id();
+    pool.ParallelFor(4, [&](int) {
+      EXPECT_EQ(std::this_thread::get_id(), outer_id);
+      ++count;
+    });
+  });
+  EXPECT_EQ(count, 20);
+}
+
+// The ranges partition [0, size), for any number of threads and sizes.
+GTEST_TEST(ThreadPoolTest, ParallelForRanges) {
+  for (int num_threads : {1, 2, 3, 8}) {
+    ThreadPool pool(num_threads);
+    for (int size : {0, 1, 2, 7, 100, 1001}) {
+      std::vector<std::atomic<int>> counts(size);
+      for (auto& count : counts) count = 0;
+      std::atomic<int> num_ranges{0};
+      pool.ParallelForRanges(size, [&](int begin, int end) {
+        EXPECT_LE(0, begin);
+        EXPECT_LE(begin, end);
+        EXPECT_LE(end, size);
+        for (int i = begin; i < end; ++i) ++counts[i];
+        ++num_ranges;
+      });
+      for (int i = 0; i < size; ++i) {
+        EXPECT_EQ(counts[i], 1) << "num_threads = " << num_threads
+                                << ", index " << i;
+      }
+      if (num_threads == 1) {
+        EXPECT_EQ(num_ranges, 1);
+      }
+    }
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ThreadPool(2).ParallelForRanges(-1, [](int, int) {}), std::logic_error,
+      ".*size must be non-negative; got -1.*");
+}
+
+GTEST_TEST(ThreadPoolTest, Exceptions) {
+  ThreadPool pool(3);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      pool.ParallelFor(10, [](int i) {
+        if (i == 4) throw std::runtime_error("iteration 4 failed");
+      }),
+      std::runtime_error, "iteration 4 failed");
+
+  // The pool is still usable after an exception.
+  std::atomic<int> count{0};
+  pool.ParallelFor(10, [&count](int) { ++count; });
+  EXPECT_EQ(count, 10);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
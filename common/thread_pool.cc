@@ -0,0 +1,127 @@
+#include "drake/common/thread_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace internal {
+
+ThreadPool::ThreadPool(int num_threads) {
+  if (num_threads < 1) {
+    throw std::logic_error(fmt::format(
+        "ThreadPool(): num_threads must be positive; got {}", num_threads));
+  }
+  workers_.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  loop_started_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(
+    int num_iterations, const std::function<void(int)>& body) {
+  bool expected_busy = false;
+  if (workers_.empty() || num_iterations <= 1 ||
+      !busy_.compare_exchange_strong(expected_busy, true)) {
+    for (int i = 0; i < num_iterations; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    body_ = &body;
+    num_iterations_ = num_iterations;
+    next_iteration_ = 0;
+    first_error_ = nullptr;
+    ++generation_;
+    loop_started_.notify_all();
+
+    RunIterations(&lock);
+    loop_finished_.wait(lock, [this]() {
+      return num_running_ == 0 &&
+             (first_error_ || next_iteration_ >= num_iterations_);
+    });
+    body_ = nullptr;
+    error = first_error_;
+    first_error_ = nullptr;
+  }
+  busy_ = false;
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::ParallelForRanges(
+    int size, const std::function<void(int, int)>& body) {
+  if (size < 0) {
+    throw std::logic_error(fmt::format(
+        "ThreadPool::ParallelForRanges(): size must be non-negative; got {}",
+        size));
+  }
+  if (workers_.empty() || size == 0) {
+    body(0, size);
+    return;
+  }
+  const int range_size = std::max(1, size / (8 * num_threads()));
+  const int num_ranges = (size + range_size - 1) / range_size;
+  ParallelFor(num_ranges, [&](int i) {
+    body(i * range_size, std::min(size, (i + 1) * range_size));
+  });
+}
+
+void ThreadPool::RunIterations(std::unique_lock<std::mutex>* lock) {
+  while (body_ != nullptr && !first_error_ &&
+         next_iteration_ < num_iterations_) {
+    const std::function<void(int)>& body = *body_;
+    const int i = next_iteration_++;
+    ++num_running_;
+    lock->unlock();
+    std::exception_ptr error;
+    try {
+      body(i);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock->lock();
+    --num_running_;
+    if (error && !first_error_) {
+      first_error_ = error;
+    }
+  }
+  if (num_running_ == 0) {
+    loop_finished_.notify_all();
+  }
+}
+
+void ThreadPool::WorkerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  int last_generation = 0;
+  while (true) {
+    loop_started_.wait(lock, [this, last_generation]() {
+      return shutdown_ || generation_ != last_generation;
+    });
+    if (shutdown_) {
+      return;
+    }
+    last_generation = generation_;
+    RunIterations(&lock);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
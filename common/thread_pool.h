@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace internal {
+
+/// A fixed set of worker threads that execute "parallel for" loops on behalf
+/// of a caller. The threads are created once, at construction, and are
+/// reused by every call to ParallelFor() so that the per-call overhead is
+/// only that of waking up the workers. Owners that run many short loops
+/// should therefore keep a pool alive across them rather than construct one
+/// per loop.
+///
+/// Loop iterations are claimed dynamically, one at a time, from a shared
+/// counter by the workers and the calling thread alike. A thread that
+/// finishes a cheap iteration early therefore goes on to take the next
+/// unclaimed one; this balances the load among iterations of very different
+/// cost without requiring a cost model.
+///
+/// ParallelFor() may be called from several threads at once (for example, by
+/// two Simulators sharing the same Diagram). The pool only serves one loop at a
+/// time though; a call made while the pool is busy, including a call made from
+/// within a loop body, runs all of its iterations on the calling thread
+/// instead of waiting for the workers.
+class ThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+
+  /// Creates a pool such that ParallelFor() runs on `num_threads` threads,
+  /// including the calling thread. That is, `num_threads - 1` worker threads
+  /// are spawned.
+  /// @throws std::exception if `num_threads` is not positive.
+  explicit ThreadPool(int num_threads);
+
+  /// Stops and joins the worker threads.
+  ~ThreadPool();
+
+  /// The number of threads, including the calling thread, that ParallelFor()
+  /// uses.
+  int num_threads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  /// Calls `body(i)` for each i in [0, `num_iterations`), in no particular
+  /// order and on any of the pool's threads or the calling thread, and
+  /// returns once all calls have completed. Different iterations must be
+  /// safe to run concurrently.
+  ///
+  /// If any call throws, iterations that were not yet started are skipped and
+  /// the first exception is rethrown on the calling thread once the calls in
+  /// flight have completed.
+  void ParallelFor(int num_iterations, const std::function<void(int)>& body);
+
+  /// Calls `body(begin, end)` over consecutive ranges [begin, end) covering
+  /// [0, `size`), as ParallelFor() does for single iterations. There are many
+  /// more ranges than threads, so that the threads which are done early take
+  /// over the remaining ranges, but few enough that a body may set up its
+  /// scratch space once per range. With a single thread, `body(0, size)` is
+  /// called once.
+  /// @throws std::exception if `size` is negative.
+  void ParallelForRanges(int size, const std::function<void(int, int)>& body);
+
+ private:
+  // Runs loop iterations, claimed from next_iteration_, until either they
+  // are exhausted or an iteration throws. Must be called with `lock` held on
+  // mutex_; the lock is released while `body` runs.
+  void RunIterations(std::unique_lock<std::mutex>* lock);
+
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+
+  // Set by the thread that owns the pool for the duration of a loop.
+  std::atomic<bool> busy_{false};
+
+  // Guards all members below.
+  std::mutex mutex_;
+  // Signaled when a new loop starts or the pool shuts down.
+  std::condition_variable loop_started_;
+  // Signaled when the last iteration of a loop completes.
+  std::condition_variable loop_finished_;
+  // Incremented with each new loop so that workers don't run a loop twice.
+  int generation_{0};
+  bool shutdown_{false};
+  const std::function<void(int)>* body_{nullptr};
+  int num_iterations_{0};
+  int next_iteration_{0};
+  int num_running_{0};
+  std::exception_ptr first_error_;
+};
+
+}  // namespace internal
+}  // namespace drake
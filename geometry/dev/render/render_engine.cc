@@ -9,6 +9,22 @@ std::unique_ptr<RenderEngine> RenderEngine::Clone() const {
   return std::unique_ptr<RenderEngine>(DoClone());
 }
 
+void RenderEngine::RenderImages(
+    const std::vector<CameraImageRequest>& requests) const {
+  for (const CameraImageRequest& request : requests) {
+    UpdateViewpoint(request.X_WR);
+    if (request.color_image_out != nullptr) {
+      RenderColorImage(request.camera, request.color_image_out, false);
+    }
+    if (request.depth_image_out != nullptr) {
+      RenderDepthImage(request.camera, request.depth_image_out);
+    }
+    if (request.label_image_out != nullptr) {
+      RenderLabelImage(request.camera, request.label_image_out, false);
+    }
+  }
+}
+
 optional<RenderIndex> RenderEngine::RegisterVisual(
     InternalIndex index, const drake::geometry::Shape& shape,
     const PerceptionProperties& properties, const Isometry3<double>& X_WG,
@@ -19,6 +19,23 @@ namespace geometry {
 namespace dev {
 namespace render {
 
+/** The images of a single camera to be rendered by
+ RenderEngine::RenderImages(). Each image is rendered if and only if its output
+ pointer is non-null; each output image must already have the camera's width
+ and height. The depth range of `camera` only affects the depth image.  */
+struct CameraImageRequest {
+  /** The pose of the camera's viewpoint in the world coordinate system.  */
+  Eigen::Isometry3d X_WR;
+  /** The intrinsic properties of the camera.  */
+  DepthCameraProperties camera;
+  /** The output color image (or nullptr).  */
+  systems::sensors::ImageRgba8U* color_image_out{};
+  /** The output depth image (or nullptr).  */
+  systems::sensors::ImageDepth32F* depth_image_out{};
+  /** The output label image (or nullptr).  */
+  systems::sensors::ImageLabel16I* label_image_out{};
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images, depth images, and, more generally, operations that can
  be performed in the OpenGL shader pipeline. The coordinate system of
@@ -139,6 +156,19 @@ class RenderEngine : public ShapeReifier {
       systems::sensors::ImageLabel16I* label_image_out,
       bool show_window) const = 0;
 
+  /** Renders the requested images of several cameras against the current
+   poses of the geometry, e.g., those of all of the cameras of a robot for one
+   frame. The images are never displayed in a window. Upon return, the
+   renderer's viewpoint is that of the last request.
+
+   The default implementation invokes UpdateViewpoint() and the individual
+   render methods for each request; derived engines can override it to amortize
+   the cost of the renderings across the batch.
+
+   @param requests  The cameras and their output images.  */
+  virtual void RenderImages(
+      const std::vector<CameraImageRequest>& requests) const;
+
  protected:
   /** The NVI-function for sub-classes to implement actual geometry
    registration. If the derived class chooses not to register this particular
@@ -1,7 +1,12 @@
 #include "drake/geometry/dev/render/render_engine_vtk.h"
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <limits>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 #include <vtkCamera.h>
@@ -16,6 +21,9 @@
 #include <vtkSphereSource.h>
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
+#include <vtkUnsignedCharArray.h>
+
+#include "drake/common/drake_throw.h"
 
 #include "drake/geometry/dev/render/shaders/depth_shaders.h"
 #include "drake/systems/sensors/color_palette.h"
@@ -29,6 +37,7 @@ namespace render {
 using std::make_unique;
 using systems::sensors::ColorD;
 using systems::sensors::ColorI;
+using systems::sensors::ColorPalette;
 using systems::sensors::ImageDepth32F;
 using systems::sensors::ImageLabel16I;
 using systems::sensors::ImageRgba8U;
@@ -80,6 +89,82 @@ float CheckRangeAndConvertToMeters(float z_buffer_value, double z_near,
   return z;
 }
 
+// A read-only view of the rgba pixels rendered by a pipeline. The rows are
+// either ordered top to bottom, as exported by the pipeline's vtkImageExport,
+// or bottom to top, as read back directly from the render window.
+class RgbaPixels {
+ public:
+  RgbaPixels(const uint8_t* data, int width, int height, bool bottom_up)
+      : data_(data), width_(width), height_(height), bottom_up_(bottom_up) {}
+
+  // Returns the pixel in column u and row v of the image, counting rows from
+  // the top.
+  const uint8_t* at(int u, int v) const {
+    const int row = bottom_up_ ? height_ - 1 - v : v;
+    return data_ + 4 * (u + row * width_);
+  }
+
+ private:
+  const uint8_t* const data_;
+  const int width_;
+  const int height_;
+  const bool bottom_up_;
+};
+
+void ConvertToColorImage(const RgbaPixels& pixels, ImageRgba8U* color_image) {
+  for (int v = 0; v < color_image->height(); ++v) {
+    std::memcpy(color_image->at(0, v), pixels.at(0, v),
+                4 * color_image->width());
+  }
+}
+
+void ConvertToDepthImage(const RgbaPixels& pixels,
+                         const DepthCameraProperties& camera,
+                         ImageDepth32F* depth_image) {
+  for (int v = 0; v < camera.height; ++v) {
+    for (int u = 0; u < camera.width; ++u) {
+      const uint8_t* pixel = pixels.at(u, v);
+      if (pixel[0] == 255u && pixel[1] == 255u && pixel[2] == 255u) {
+        depth_image->at(u, v)[0] = InvalidDepth::kTooFar;
+      } else {
+        // Decoding three channel color values to a float value. For the detail,
+        // see depth_shaders.h.
+        float shader_value = pixel[0] + pixel[1] / 255. +
+                             pixel[2] / (255. * 255.);
+
+        // Dividing by 255 so that the range gets to be [0, 1].
+        shader_value /= 255.f;
+        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
+        depth_image->at(u, v)[0] =
+            CheckRangeAndConvertToMeters(shader_value, camera.z_near,
+                                         camera.z_far);
+      }
+    }
+  }
+}
+
+void ConvertToLabelImage(const RgbaPixels& pixels,
+                         const ColorPalette<RenderLabel>& color_palette,
+                         ImageLabel16I* label_image) {
+  ColorI color;
+  for (int v = 0; v < label_image->height(); ++v) {
+    for (int u = 0; u < label_image->width(); ++u) {
+      const uint8_t* pixel = pixels.at(u, v);
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
+      label_image->at(u, v)[0] = color_palette.LookUpId(color);
+    }
+  }
+}
+
+// Throws unless `image` has the size of `camera`.
+template <typename ImageT>
+void CheckImageSize(const CameraProperties& camera, const ImageT& image) {
+  DRAKE_THROW_UNLESS(image.width() == camera.width &&
+                     image.height() == camera.height);
+}
+
 // TODO(SeanCurtis-TRI): This should ultimately part of the public SceneGraph
 // API.
 enum ImageType {
@@ -122,7 +207,8 @@ RenderEngineVtk::RenderEngineVtk()
                      RenderLabel::empty_label()),
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
-                  make_unique<RenderingPipeline>()}} {
+                  make_unique<RenderingPipeline>()}},
+      conversion_pool_(make_unique<drake::internal::ThreadPool>(2)) {
   InitializePipelines();
 }
 
@@ -158,28 +244,9 @@ void RenderEngineVtk::RenderDepthImage(const DepthCameraProperties& camera,
   // See the implementation in vtkImageExport::Export() for details.
   ImageRgba8U image(camera.width, camera.height);
   pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
-
-  for (int v = 0; v < camera.height; ++v) {
-    for (int u = 0; u < camera.width; ++u) {
-      if (image.at(u, v)[0] == 255u &&
-          image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
-        depth_image_out->at(u, v)[0] = InvalidDepth::kTooFar;
-      } else {
-        // Decoding three channel color values to a float value. For the detail,
-        // see depth_shaders.h.
-        float shader_value = image.at(u, v)[0] + image.at(u, v)[1] / 255. +
-                             image.at(u, v)[2] / (255. * 255.);
-
-        // Dividing by 255 so that the range gets to be [0, 1].
-        shader_value /= 255.f;
-        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
-        depth_image_out->at(u, v)[0] =
-            CheckRangeAndConvertToMeters(shader_value, camera.z_near,
-                                         camera.z_far);
-      }
-    }
-  }
+  ConvertToDepthImage(
+      RgbaPixels(image.at(0, 0), camera.width, camera.height, false), camera,
+      depth_image_out);
 }
 
 void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
@@ -201,16 +268,96 @@ void RenderEngineVtk::RenderLabelImage(const CameraProperties& camera,
   // See the implementation in vtkImageExport::Export() for details.
   ImageRgba8U image(camera.width, camera.height);
   pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+  ConvertToLabelImage(
+      RgbaPixels(image.at(0, 0), camera.width, camera.height, false),
+      color_palette_, label_image_out);
+}
 
-  ColorI color;
-  for (int v = 0; v < camera.height; ++v) {
-    for (int u = 0; u < camera.width; ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
-      label_image_out->at(u, v)[0] = color_palette_.LookUpId(color);
+void RenderEngineVtk::RenderImages(
+    const std::vector<CameraImageRequest>& requests) const {
+  for (const CameraImageRequest& request : requests) {
+    if (request.color_image_out != nullptr) {
+      CheckImageSize(request.camera, *request.color_image_out);
+    }
+    if (request.depth_image_out != nullptr) {
+      CheckImageSize(request.camera, *request.depth_image_out);
+    }
+    if (request.label_image_out != nullptr) {
+      CheckImageSize(request.camera, *request.label_image_out);
+    }
+  }
+
+  // Each image is rendered once and read back from the render window into one
+  // of two buffers, bypassing the pipeline's filter and exporter. It is then
+  // converted into its output image by the conversion pool's worker while the
+  // next image is rendered into the other buffer. The actors' poses are those
+  // of the last UpdatePoses() for all of the cameras.
+  std::array<vtkSmartPointer<vtkUnsignedCharArray>, 2> buffers{
+      {vtkSmartPointer<vtkUnsignedCharArray>::New(),
+       vtkSmartPointer<vtkUnsignedCharArray>::New()}};
+  int next_buffer = 0;
+  // The conversion of the last image rendered, which reads the other buffer.
+  std::function<void()> pending_conversion;
+  auto render = [&](const RenderingPipeline& p, const CameraProperties& camera,
+                    std::function<void(const RgbaPixels&)> convert) {
+    vtkUnsignedCharArray* buffer = buffers[next_buffer].Get();
+    next_buffer = 1 - next_buffer;
+    // The OpenGL calls must stay on this thread, but the pool runs either
+    // iteration on either of its threads. So this thread renders in the first
+    // iteration it claims and the pending conversion runs in the other one;
+    // if the worker claims both, this thread renders once the loop returns.
+    const std::thread::id render_thread = std::this_thread::get_id();
+    std::atomic<bool> rendered{false};
+    std::atomic<bool> converted{!pending_conversion};
+    conversion_pool_->ParallelFor(2, [&](int) {
+      if (std::this_thread::get_id() == render_thread &&
+          !rendered.exchange(true)) {
+        RenderAndReadPixels(p, camera, buffer);
+      } else if (!converted.exchange(true)) {
+        pending_conversion();
+      }
+    });
+    if (!rendered) RenderAndReadPixels(p, camera, buffer);
+    pending_conversion = [buffer, width = camera.width, height = camera.height,
+                          convert = std::move(convert)]() {
+      convert(RgbaPixels(buffer->GetPointer(0), width, height, true));
+    };
+  };
+
+  for (const CameraImageRequest& request : requests) {
+    const vtkSmartPointer<vtkTransform> vtk_X_WR =
+        ConvertToVtkTransform(request.X_WR);
+    for (const auto& pipeline : pipelines_) {
+      SetModelTransformMatrixToVtkCamera(
+          pipeline->renderer->GetActiveCamera(), vtk_X_WR);
+    }
+    const DepthCameraProperties& camera = request.camera;
+    if (request.color_image_out != nullptr) {
+      const RenderingPipeline& p = *pipelines_[ImageType::kColor];
+      UpdateWindow(camera, false, &p, "Color Image");
+      ImageRgba8U* color_image = request.color_image_out;
+      render(p, camera, [color_image](const RgbaPixels& pixels) {
+        ConvertToColorImage(pixels, color_image);
+      });
+    }
+    if (request.depth_image_out != nullptr) {
+      const RenderingPipeline& p = *pipelines_[ImageType::kDepth];
+      UpdateWindow(camera, &p);
+      ImageDepth32F* depth_image = request.depth_image_out;
+      render(p, camera, [camera, depth_image](const RgbaPixels& pixels) {
+        ConvertToDepthImage(pixels, camera, depth_image);
+      });
+    }
+    if (request.label_image_out != nullptr) {
+      const RenderingPipeline& p = *pipelines_[ImageType::kLabel];
+      UpdateWindow(camera, false, &p, "Label Image");
+      ImageLabel16I* label_image = request.label_image_out;
+      render(p, camera, [this, label_image](const RgbaPixels& pixels) {
+        ConvertToLabelImage(pixels, color_palette_, label_image);
+      });
     }
   }
+  if (pending_conversion) pending_conversion();
 }
 
 void RenderEngineVtk::ImplementGeometry(const Sphere& sphere, void* user_data) {
@@ -319,7 +466,8 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
                      RenderLabel::empty_label()),
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
-                  make_unique<RenderingPipeline>()}} {
+                  make_unique<RenderingPipeline>()}},
+      conversion_pool_(make_unique<drake::internal::ThreadPool>(2)) {
   InitializePipelines();
 
   // Utility function for creating a cloned actor which *shares* the same
@@ -533,6 +681,19 @@ void RenderEngineVtk::PerformVTKUpdate(const RenderingPipeline& p) {
   p.filter->Update();
 }
 
+void RenderEngineVtk::RenderAndReadPixels(const RenderingPipeline& p,
+                                          const CameraProperties& camera,
+                                          vtkUnsignedCharArray* pixels) {
+  // As vtkWindowToImageFilter does, renders with buffer swapping off and reads
+  // the back buffer. The rows of the pixels are ordered bottom to top.
+  const int swap_buffers = p.window->GetSwapBuffers();
+  p.window->SwapBuffersOff();
+  p.window->Render();
+  p.window->GetRGBACharPixelData(0, 0, camera.width - 1, camera.height - 1,
+                                 0 /* front */, pixels);
+  p.window->SetSwapBuffers(swap_buffers);
+}
+
 void RenderEngineVtk::UpdateWindow(const CameraProperties& camera,
                                    bool show_window,
                                    const RenderingPipeline* p,
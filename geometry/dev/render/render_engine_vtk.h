@@ -15,9 +15,11 @@
 #include <vtkRenderer.h>
 #include <vtkShaderProgram.h>
 #include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
 #include <vtkWindowToImageFilter.h>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/thread_pool.h"
 #include "drake/geometry/dev/render/render_engine.h"
 #include "drake/geometry/dev/render/render_label.h"
 #include "drake/systems/sensors/color_palette.h"
@@ -144,6 +146,17 @@ class RenderEngineVtk final : public RenderEngine,
                         systems::sensors::ImageLabel16I* label_image_out,
                         bool show_window) const override;
 
+  /** Inherits RenderEngine::RenderImages(). Each image is rendered once,
+   offscreen, and read back directly from its render window. Its conversion
+   into the output image (e.g., the decoding of depths and labels) runs on a
+   worker thread that this engine keeps for its lifetime, overlapping the
+   rendering of the next image.
+
+   @throws std::runtime_error if an output image doesn't have the size of its
+                              camera.  */
+  void RenderImages(
+      const std::vector<CameraImageRequest>& requests) const override;
+
   /** @name    Shape reification  */
   //@{
   void ImplementGeometry(const Sphere& sphere, void* user_data) override;
@@ -209,6 +222,12 @@ class RenderEngineVtk final : public RenderEngine,
   // vtkActors' pose update for rendering.
   static void PerformVTKUpdate(const RenderingPipeline& p);
 
+  // Renders the pipeline's scene into its window, at the size of `camera`, and
+  // reads back the resulting rgba pixels, bottom row first.
+  static void RenderAndReadPixels(const RenderingPipeline& p,
+                                  const CameraProperties& camera,
+                                  vtkUnsignedCharArray* pixels);
+
   // This actually modifies internal state; the pointer to a const pipeline
   // allows mutation via the contained vtkNew pointers.
   void UpdateWindow(const CameraProperties& camera, bool show_window,
@@ -220,6 +239,10 @@ class RenderEngineVtk final : public RenderEngine,
 
   std::array<std::unique_ptr<RenderingPipeline>, 3> pipelines_;
 
+  // The calling thread and one worker, which converts the pixels read back by
+  // RenderImages(). Each engine, including each clone, has its own.
+  std::unique_ptr<drake::internal::ThreadPool> conversion_pool_;
+
   // By design, all of the geometry is shared across clones of the render
   // engine. This is predicated upon the idea that the geometry is *not*
   // deformable and does *not* depend on the system's pose information.
@@ -1,5 +1,7 @@
 #include "drake/geometry/dev/render/render_engine_vtk.h"
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -801,6 +803,62 @@ TEST_F(RenderEngineVtkTest, DifferentCameras) {
   }
 }
 
+// Returns true if the two images have the same size and pixels.
+template <typename ImageT>
+bool AreEqual(const ImageT& a, const ImageT& b) {
+  return a.width() == b.width() && a.height() == b.height() &&
+         std::equal(a.at(0, 0), a.at(0, 0) + a.size(), b.at(0, 0));
+}
+
+// Confirms that rendering the images of several cameras in one batch produces
+// the images of the individual renderings.
+TEST_F(RenderEngineVtkTest, BatchedCameras) {
+  SetUp(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+
+  // The default camera, and a smaller camera with a narrower depth range that
+  // looks at the sphere from farther away.
+  DepthCameraProperties small_camera{camera_};
+  small_camera.width /= 2;
+  small_camera.height /= 2;
+  small_camera.z_far = 3;
+  const Isometry3d X_WR_far = Translation3d(0, 0, 0.5) * X_WR_;
+
+  ImageRgba8U color(camera_.width, camera_.height);
+  ImageDepth32F depth(camera_.width, camera_.height);
+  ImageLabel16I label(camera_.width, camera_.height);
+  ImageDepth32F small_depth(small_camera.width, small_camera.height);
+  ImageLabel16I small_label(small_camera.width, small_camera.height);
+  renderer_->RenderImages(
+      {CameraImageRequest{X_WR_, camera_, &color, &depth, &label},
+       CameraImageRequest{X_WR_far, small_camera, nullptr, &small_depth,
+                          &small_label}});
+
+  renderer_->UpdateViewpoint(X_WR_);
+  Render();
+  EXPECT_TRUE(AreEqual(color, color_));
+  EXPECT_TRUE(AreEqual(depth, depth_));
+  EXPECT_TRUE(AreEqual(label, label_));
+  VerifyOutliers(*renderer_, camera_, "Batched cameras", &color, &depth,
+                 &label);
+
+  renderer_->UpdateViewpoint(X_WR_far);
+  ImageDepth32F expected_small_depth(small_camera.width, small_camera.height);
+  ImageLabel16I expected_small_label(small_camera.width, small_camera.height);
+  renderer_->RenderDepthImage(small_camera, &expected_small_depth);
+  renderer_->RenderLabelImage(small_camera, &expected_small_label,
+                              kShowWindow);
+  EXPECT_TRUE(AreEqual(small_depth, expected_small_depth));
+  EXPECT_TRUE(AreEqual(small_label, expected_small_label));
+  // The terrain is beyond the narrower depth range.
+  EXPECT_EQ(small_depth.at(kInset, kInset)[0], InvalidDepth::kTooFar);
+
+  // The output images must have the size of their camera.
+  EXPECT_THROW(renderer_->RenderImages({CameraImageRequest{
+                   X_WR_, small_camera, nullptr, &depth, nullptr}}),
+               std::runtime_error);
+}
+
 // Tests that registered geometry without specific values renders without error.
 // TODO(SeanCurtis-TRI): When the ability to set defaults is exposed through a
 // public API, actually test for the *default values*. Until then, error-free
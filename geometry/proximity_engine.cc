@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <iterator>
@@ -17,6 +18,7 @@
 #include <fcl/geometry/shape/convex.h>
 #include <fcl/narrowphase/collision_request.h>
 #include <fcl/narrowphase/distance_request.h>
+#include <fmt/format.h>
 #include <spruce.hh>
 #include <tiny_obj_loader.h>
 
@@ -24,6 +26,7 @@
 #include "drake/common/drake_variant.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/sorted_vectors_have_intersection.h"
+#include "drake/common/thread_pool.h"
 #include "drake/geometry/utilities.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
@@ -215,6 +218,11 @@ class CollisionFilterLegacy {
   int next_available_clique_{0};
 };
 
+// A pair of collision objects that survived the broadphase and collision
+// filtering, awaiting the narrowphase.
+using CandidatePair =
+    std::pair<const fcl::CollisionObjectd*, const fcl::CollisionObjectd*>;
+
 // Struct for use in DistanceCallback(). Contains the distance request
 // and accumulates result in a drake::geometry::SignedDistancePair vector.
 struct DistanceData {
@@ -231,6 +239,10 @@ struct DistanceData {
 
   // Vectors of distance results
   std::vector<SignedDistancePair<double>>* nearest_pairs{};
+
+  // If non-null, the callback only collects the unfiltered pairs here, and
+  // leaves the narrowphase to the caller.
+  std::vector<CandidatePair>* candidates{};
 };
 
 // Struct for use in DistanceFromPointCallback(). Contains the distance request
@@ -274,6 +286,10 @@ struct CollisionData {
 
   // Vector of distance results
   std::vector<PenetrationAsPointPair<double>>* contacts{};
+
+  // If non-null, the callback only collects the unfiltered pairs here, and
+  // leaves the narrowphase to the caller.
+  std::vector<CandidatePair>* candidates{};
 };
 
 // An internal functor to support DistanceFromPointCallback() and
@@ -564,6 +580,36 @@ void ComputeNarrowPhaseDistance(const fcl::CollisionObjectd* a,
 }
 
 
+// Computes the signed distance between the two given objects, which must be
+// ordered such that id(A) < id(B). See DistanceCallback().
+SignedDistancePair<double> CalcDistancePair(
+    const fcl::CollisionObjectd& fcl_object_A,
+    const fcl::CollisionObjectd& fcl_object_B,
+    const std::vector<GeometryId>& geometry_map,
+    const fcl::DistanceRequestd& request) {
+  fcl::DistanceResultd result;
+  ComputeNarrowPhaseDistance(&fcl_object_A, &fcl_object_B, geometry_map,
+                             request, &result);
+  const Vector3d& p_WCa = result.nearest_points[0];
+  const Vector3d& p_WCb = result.nearest_points[1];
+  const Vector3d p_ACa = fcl_object_A.getTransform().inverse() * p_WCa;
+  const Vector3d p_BCb = fcl_object_B.getTransform().inverse() * p_WCb;
+  // TODO(DamrongGuoy): For sphere-{sphere,box,cylinder} we will start
+  //  working on the right nhat when min_distance is 0 or almost 0 after
+  //  PR #10813 lands to avoid conflicts with this PR #10823. For now,
+  //  we simply return NaN in nhat when min_distance is 0 or almost 0.
+  const Vector3d nhat_BA_W =
+      (std::abs(result.min_distance) < std::numeric_limits<double>::epsilon())
+          ? Vector3d(std::numeric_limits<double>::quiet_NaN(),
+                     std::numeric_limits<double>::quiet_NaN(),
+                     std::numeric_limits<double>::quiet_NaN())
+          : (p_WCa - p_WCb) / result.min_distance;
+  return SignedDistancePair<double>(
+      EncodedData(fcl_object_A).id(geometry_map),
+      EncodedData(fcl_object_B).id(geometry_map), p_ACa, p_BCb,
+      result.min_distance, nhat_BA_W);
+}
+
 // The callback function in fcl::distance request. The final unnamed parameter
 // is `dist`, which is used in fcl::distance, that if the distance between two
 // geometries is proved to be greater than `dist` (for example, the smallest
@@ -586,8 +632,6 @@ bool DistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   const GeometryId orig_id_A = EncodedData(*fcl_object_A_ptr).id(geometry_map);
   const GeometryId orig_id_B = EncodedData(*fcl_object_B_ptr).id(geometry_map);
   const bool swap_AB = (orig_id_B < orig_id_A);
-  const GeometryId id_A = swap_AB ? orig_id_B : orig_id_A;
-  const GeometryId id_B = swap_AB ? orig_id_A : orig_id_B;
   // NOTE: Although this function *takes* pointers to non-const objects to
   // satisfy the fcl api, it should not exploit the non-constness to modify
   // the collision objects. We ensure this by a reference to a const version
@@ -607,25 +651,12 @@ bool DistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
       encoding_A.encoded_data(), encoding_B.encoded_data());
 
   if (can_collide) {
-    fcl::DistanceResultd result;
-    ComputeNarrowPhaseDistance(&fcl_object_A, &fcl_object_B, geometry_map,
-                               distance_data.request, &result);
-    const Vector3d& p_WCa = result.nearest_points[0];
-    const Vector3d& p_WCb = result.nearest_points[1];
-    const Vector3d p_ACa = fcl_object_A.getTransform().inverse() * p_WCa;
-    const Vector3d p_BCb = fcl_object_B.getTransform().inverse() * p_WCb;
-    // TODO(DamrongGuoy): For sphere-{sphere,box,cylinder} we will start
-    //  working on the right nhat when min_distance is 0 or almost 0 after
-    //  PR #10813 lands to avoid conflicts with this PR #10823. For now,
-    //  we simply return NaN in nhat when min_distance is 0 or almost 0.
-    const Vector3d nhat_BA_W =
-        (std::abs(result.min_distance) < std::numeric_limits<double>::epsilon())
-            ? Vector3d(std::numeric_limits<double>::quiet_NaN(),
-                       std::numeric_limits<double>::quiet_NaN(),
-                       std::numeric_limits<double>::quiet_NaN())
-            : (p_WCa - p_WCb) / result.min_distance;
-    distance_data.nearest_pairs->emplace_back(id_A, id_B, p_ACa, p_BCb,
-                                              result.min_distance, nhat_BA_W);
+    if (distance_data.candidates != nullptr) {
+      distance_data.candidates->emplace_back(&fcl_object_A, &fcl_object_B);
+    } else {
+      distance_data.nearest_pairs->push_back(CalcDistancePair(
+          fcl_object_A, fcl_object_B, geometry_map, distance_data.request));
+    }
   }
 
   // Returning true would tell the broadphase manager to terminate early. Since
@@ -905,37 +936,14 @@ bool DistanceFromPointCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   return false;  // Returning false tells fcl to continue to other objects.
 }
 
-// Callback function for FCL's collide() function for retrieving a *single*
-// contact.
-bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
-                             fcl::CollisionObjectd* fcl_object_B_ptr,
-                             void* callback_data) {
-  // NOTE: Although this function *takes* non-const pointers to satisfy the
-  // fcl api, it should not exploit the non-constness to modify the collision
-  // objects. We insure this by immediately assigning to a const version and
-  // not directly using the provided parameters.
-  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
-  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
-
-  auto& collision_data = *static_cast<CollisionData*>(callback_data);
-
-  // Extract the collision filter keys from the fcl collision objects. These
-  // keys will also be used to map the fcl collision object back to the Drake
-  // GeometryId for colliding geometries.
-  EncodedData encoding_A(fcl_object_A);
-  EncodedData encoding_B(fcl_object_B);
-
-  const bool can_collide = collision_data.collision_filter.CanCollideWith(
-      encoding_A.encoded_data(), encoding_B.encoded_data());
-
-  // NOTE: Here and below, false is returned regardless of whether collision
-  // is detected or not because true tells the broadphase manager to terminate.
-  // Since we want *all* collisions, we return false.
-  if (!can_collide) return false;
-
-  // Unpack the callback data
-  const fcl::CollisionRequestd& request = collision_data.request;
-
+// Performs the narrowphase collision test between the two given objects.
+// Returns true and writes the characterization of their penetration to
+// `penetration` if they are penetrating.
+bool CalcPenetration(const fcl::CollisionObjectd& fcl_object_A,
+                     const fcl::CollisionObjectd& fcl_object_B,
+                     const std::vector<GeometryId>& geometry_map,
+                     const fcl::CollisionRequestd& request,
+                     PenetrationAsPointPair<double>* penetration) {
   // This callback only works for a single contact, this confirms a request
   // hasn't been made for more contacts.
   DRAKE_ASSERT(request.num_max_contacts == 1);
@@ -975,24 +983,62 @@ bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   Vector3d p_WAc = contact.pos - 0.5 * depth * drake_normal;
   Vector3d p_WBc = contact.pos + 0.5 * depth * drake_normal;
 
-  PenetrationAsPointPair<double> penetration;
-  penetration.depth = depth;
+  penetration->depth = depth;
   // The engine doesn't know geometry ids; it returns engine indices. The
   // caller must map engine indices to geometry ids.
-  const std::vector<GeometryId>& geometry_map = collision_data.geometry_map;
-  penetration.id_A = encoding_A.id(geometry_map);
-  penetration.id_B = encoding_B.id(geometry_map);
-  penetration.p_WCa = p_WAc;
-  penetration.p_WCb = p_WBc;
-  penetration.nhat_BA_W = drake_normal;
+  penetration->id_A = EncodedData(fcl_object_A).id(geometry_map);
+  penetration->id_B = EncodedData(fcl_object_B).id(geometry_map);
+  penetration->p_WCa = p_WAc;
+  penetration->p_WCb = p_WBc;
+  penetration->nhat_BA_W = drake_normal;
   // Guarantee fixed ordering of pair (A, B). Swap the ids and points on
   // surfaces and then flip the normal.
-  if (penetration.id_B < penetration.id_A) {
-    std::swap(penetration.id_A, penetration.id_B);
-    std::swap(penetration.p_WCa, penetration.p_WCb);
-    penetration.nhat_BA_W = -penetration.nhat_BA_W;
+  if (penetration->id_B < penetration->id_A) {
+    std::swap(penetration->id_A, penetration->id_B);
+    std::swap(penetration->p_WCa, penetration->p_WCb);
+    penetration->nhat_BA_W = -penetration->nhat_BA_W;
+  }
+  return true;
+}
+
+// Callback function for FCL's collide() function for retrieving a *single*
+// contact.
+bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                             fcl::CollisionObjectd* fcl_object_B_ptr,
+                             void* callback_data) {
+  // NOTE: Although this function *takes* non-const pointers to satisfy the
+  // fcl api, it should not exploit the non-constness to modify the collision
+  // objects. We insure this by immediately assigning to a const version and
+  // not directly using the provided parameters.
+  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
+  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
+
+  auto& collision_data = *static_cast<CollisionData*>(callback_data);
+
+  // Extract the collision filter keys from the fcl collision objects. These
+  // keys will also be used to map the fcl collision object back to the Drake
+  // GeometryId for colliding geometries.
+  EncodedData encoding_A(fcl_object_A);
+  EncodedData encoding_B(fcl_object_B);
+
+  const bool can_collide = collision_data.collision_filter.CanCollideWith(
+      encoding_A.encoded_data(), encoding_B.encoded_data());
+
+  // NOTE: Here and below, false is returned regardless of whether collision
+  // is detected or not because true tells the broadphase manager to terminate.
+  // Since we want *all* collisions, we return false.
+  if (!can_collide) return false;
+
+  if (collision_data.candidates != nullptr) {
+    collision_data.candidates->emplace_back(&fcl_object_A, &fcl_object_B);
+    return false;
+  }
+
+  PenetrationAsPointPair<double> penetration;
+  if (CalcPenetration(fcl_object_A, fcl_object_B, collision_data.geometry_map,
+                      collision_data.request, &penetration)) {
+    collision_data.contacts->emplace_back(std::move(penetration));
   }
-  collision_data.contacts->emplace_back(std::move(penetration));
 
   return false;
 }
@@ -1121,6 +1167,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
     collision_filter_ = other.collision_filter_;
+    set_num_parallel_executions(other.get_num_parallel_executions());
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -1148,6 +1195,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
     BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
+    engine->set_num_parallel_executions(get_num_parallel_executions());
 
     return engine;
   }
@@ -1230,13 +1278,44 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG,
                         const std::vector<GeometryIndex>& indices) {
     DRAKE_DEMAND(indices.size() == dynamic_objects_.size());
+    const Clock::time_point start = Clock::now();
+
+    // Only the geometries whose pose actually changed need new bounding boxes;
+    // in typical scenes many geometries (e.g., objects at rest in a bin) keep
+    // their pose from one update to the next.
+    moved_objects_.clear();
     for (size_t i = 0; i < indices.size(); ++i) {
-      dynamic_objects_[i]->setTransform(convert(X_WG[indices[i]]));
-      dynamic_objects_[i]->computeAABB();
+      fcl::CollisionObjectd* object = dynamic_objects_[i].get();
+      const Isometry3<double> X_WG_i = convert(X_WG[indices[i]]);
+      if (X_WG_i.matrix() == object->getTransform().matrix()) continue;
+      object->setTransform(X_WG_i);
+      object->computeAABB();
+      moved_objects_.push_back(object);
+    }
+
+    // Updating an object in the tree re-inserts its leaf, while the full
+    // update refits every node in a single pass. When most of the geometries
+    // have moved, the single pass is cheaper.
+    if (2 * moved_objects_.size() > dynamic_objects_.size()) {
+      dynamic_tree_.update();
+      ++statistics_.num_full_refits;
+    } else if (!moved_objects_.empty()) {
+      dynamic_tree_.update(moved_objects_);
+      ++statistics_.num_incremental_refits;
     }
-    dynamic_tree_.update();
+
+    ++statistics_.num_pose_updates;
+    statistics_.num_geometries_moved += static_cast<int>(moved_objects_.size());
+    statistics_.update_time +=
+        std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+  const BroadPhaseStatistics& broad_phase_statistics() const {
+    return statistics_;
   }
 
+  void ResetBroadPhaseStatistics() { statistics_ = BroadPhaseStatistics(); }
+
   // Implementation of ShapeReifier interface
 
   void ImplementGeometry(const Sphere& sphere, void* user_data) override {
@@ -1411,11 +1490,26 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     distance_data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
     distance_data.request.distance_tolerance = distance_tolerance_;
 
+    std::vector<CandidatePair> candidates;
+    if (thread_pool_ != nullptr) distance_data.candidates = &candidates;
+
     dynamic_tree_.distance(&distance_data, DistanceCallback);
     dynamic_tree_.distance(
         const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
             &anchored_tree_),
         &distance_data, DistanceCallback);
+
+    if (thread_pool_ != nullptr) {
+      // Every candidate yields a result; each thread writes only its own
+      // entries, which are already in the order the sequential path reports.
+      witness_pairs.resize(candidates.size());
+      thread_pool_->ParallelFor(
+          static_cast<int>(candidates.size()), [&](int i) {
+            witness_pairs[i] = CalcDistancePair(
+                *candidates[i].first, *candidates[i].second, geometry_map,
+                distance_data.request);
+          });
+    }
     return witness_pairs;
   }
 
@@ -1458,6 +1552,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     collision_data.request.gjk_tolerance = 2e-12;
     collision_data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
 
+    std::vector<CandidatePair> candidates;
+    if (thread_pool_ != nullptr) collision_data.candidates = &candidates;
+
     dynamic_tree_.collide(&collision_data, SingleCollisionCallback);
 
     // NOTE: The interface to DynamicAABBTreeCollisionManager::collide
@@ -1470,9 +1567,45 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
         const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
             &anchored_tree_),
         &collision_data, SingleCollisionCallback);
+
+    if (thread_pool_ != nullptr) {
+      // Test all candidates in parallel, then keep the penetrating ones in
+      // candidate order so that the results match the sequential path.
+      std::vector<PenetrationAsPointPair<double>> penetrations(
+          candidates.size());
+      std::vector<char> is_penetrating(candidates.size(), false);
+      thread_pool_->ParallelFor(
+          static_cast<int>(candidates.size()), [&](int i) {
+            is_penetrating[i] = CalcPenetration(
+                *candidates[i].first, *candidates[i].second, geometry_map,
+                collision_data.request, &penetrations[i]);
+          });
+      for (size_t i = 0; i < candidates.size(); ++i) {
+        if (is_penetrating[i]) contacts.push_back(std::move(penetrations[i]));
+      }
+    }
     return contacts;
   }
 
+  void set_num_parallel_executions(int num_parallel_executions) {
+    if (num_parallel_executions < 1) {
+      throw std::logic_error(fmt::format(
+          "ProximityEngine::set_num_parallel_executions(): the number of "
+          "parallel executions must be positive; got {}.",
+          num_parallel_executions));
+    }
+    if (num_parallel_executions == get_num_parallel_executions()) return;
+    thread_pool_.reset();
+    if (num_parallel_executions > 1) {
+      thread_pool_ = make_unique<drake::internal::ThreadPool>(
+          num_parallel_executions);
+    }
+  }
+
+  int get_num_parallel_executions() const {
+    return thread_pool_ == nullptr ? 1 : thread_pool_->num_threads();
+  }
+
   // TODO(SeanCurtis-TRI): Update this with the new collision filter method.
   void ExcludeCollisionsWithin(
       const std::unordered_set<GeometryIndex>& dynamic,
@@ -1709,12 +1842,29 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // AnchoredGeometryIndex maps to their position in *this* vector.
   std::vector<std::unique_ptr<fcl::CollisionObject<double>>> anchored_objects_;
 
+  // Scratch space for UpdateWorldPoses(): the dynamic objects whose pose
+  // changed in the current update.
+  std::vector<fcl::CollisionObjectd*> moved_objects_;
+
+  // The work done by UpdateWorldPoses() since construction (or the last
+  // reset). Copies of the engine start with fresh statistics.
+  BroadPhaseStatistics statistics_;
+
+  // The steady_clock is immune to system clock changes so increases
+  // monotonically.
+  using Clock = std::chrono::steady_clock;
+
   // The mechanism for dictating collision filtering.
   CollisionFilterLegacy collision_filter_;
 
   // The tolerance that determines when the iterative process would terminate.
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
+
+  // The threads that run the narrowphase of the pairwise queries; null when
+  // they run sequentially on the calling thread.
+  // @see ProximityEngine::set_num_parallel_executions().
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 
 template <typename T>
@@ -1822,6 +1972,28 @@ void ProximityEngine<T>::UpdateWorldPoses(
   impl_->UpdateWorldPoses(X_WG, indices);
 }
 
+template <typename T>
+void ProximityEngine<T>::set_num_parallel_executions(
+    int num_parallel_executions) {
+  impl_->set_num_parallel_executions(num_parallel_executions);
+}
+
+template <typename T>
+int ProximityEngine<T>::get_num_parallel_executions() const {
+  return impl_->get_num_parallel_executions();
+}
+
+template <typename T>
+const BroadPhaseStatistics& ProximityEngine<T>::broad_phase_statistics()
+    const {
+  return impl_->broad_phase_statistics();
+}
+
+template <typename T>
+void ProximityEngine<T>::ResetBroadPhaseStatistics() {
+  impl_->ResetBroadPhaseStatistics();
+}
+
 template <typename T>
 std::vector<SignedDistancePair<double>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
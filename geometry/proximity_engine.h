@@ -27,6 +27,28 @@ namespace internal {
 class GeometryStateCollisionFilterAttorney;
 #endif
 
+/** Counters describing the work ProximityEngine::UpdateWorldPoses() has done
+ to keep the broad-phase data structure of the dynamic geometries current.  */
+struct BroadPhaseStatistics {
+  /** The number of calls to UpdateWorldPoses().  */
+  int num_pose_updates{0};
+
+  /** The total number of dynamic geometries whose pose changed (and whose
+   bounding box was, therefore, recomputed), summed over all calls.  */
+  int num_geometries_moved{0};
+
+  /** The number of calls which updated only the moved geometries' entries in
+   the broad-phase structure.  */
+  int num_incremental_refits{0};
+
+  /** The number of calls in which so many geometries moved that the whole
+   broad-phase structure was refit instead.  */
+  int num_full_refits{0};
+
+  /** The total wall-clock time, in seconds, spent in UpdateWorldPoses().  */
+  double update_time{0};
+};
+
 // TODO(SeanCurtis-TRI): Swap Isometry3 for the new Transform class.
 
 /** The underlying engine for performing geometric _proximity_ queries.
@@ -133,6 +155,22 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /** Sets the number of threads used to run the narrowphase of
+   ComputePointPairPenetration() and
+   ComputeSignedDistancePairwiseClosestPoints(). With the default of one, each
+   candidate pair reported by the broadphase is evaluated on the calling
+   thread as soon as it is found. With more than one, the broadphase first
+   collects all candidate pairs, which are then evaluated concurrently on a
+   pool of threads owned by `this` engine. The results are identical to, and
+   reported in the same order as, those of the sequential evaluation. Copies
+   of the engine (including scalar conversion) use the same number of threads.
+   @throws std::exception if `num_parallel_executions` is not positive.  */
+  void set_num_parallel_executions(int num_parallel_executions);
+
+  /** Returns the number of threads used by the pairwise queries. See
+   set_num_parallel_executions().  */
+  int get_num_parallel_executions() const;
+
   //@}
 
   /** Updates the poses for all of the dynamic geometries in the engine. It
@@ -152,6 +190,16 @@ class ProximityEngine {
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG,
                         const std::vector<GeometryIndex>& indices);
 
+  /** Reports the work done by UpdateWorldPoses() since this engine was
+   constructed (or the statistics were last reset). Only geometries whose pose
+   differs from the previous update have their bounding boxes recomputed and
+   their broad-phase entries updated; the statistics expose how much of the
+   scene that was.  */
+  const BroadPhaseStatistics& broad_phase_statistics() const;
+
+  /** Zeroes all of the statistics reported by broad_phase_statistics().  */
+  void ResetBroadPhaseStatistics();
+
   // ----------------------------------------------------------------------
   /**@name              Signed Distance Queries
   See @ref signed_distance_query "Signed Distance Query" for more details.  */
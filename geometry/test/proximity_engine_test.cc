@@ -1,5 +1,6 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 #include <vector>
@@ -3203,6 +3204,148 @@ GTEST_TEST(ProximityEngineTests, AnchoredBroadPhaseInitialization) {
 }
 
 
+// Confirms that UpdateWorldPoses() only updates the broad-phase entries of the
+// geometries that moved, and that the queries still see those updates.
+GTEST_TEST(ProximityEngineTests, IncrementalBroadPhaseUpdate) {
+  ProximityEngine<double> engine;
+  const int kCount = 10;
+  std::vector<GeometryId> geometry_map;
+  std::vector<GeometryIndex> indices;
+  std::vector<Isometry3<double>> poses;
+  for (int i = 0; i < kCount; ++i) {
+    engine.AddDynamicGeometry(Sphere(0.5), GeometryIndex(i));
+    geometry_map.push_back(GeometryId::get_new_id());
+    indices.push_back(GeometryIndex(i));
+    // The spheres are spread out along the x-axis; none of them collide.
+    poses.push_back(Isometry3<double>(Translation3d{3.0 * i, 0, 0}));
+  }
+
+  // Only the first sphere is at its initial pose (the identity); all others
+  // move and the whole tree gets refit.
+  engine.UpdateWorldPoses(poses, indices);
+  EXPECT_EQ(engine.ComputePointPairPenetration(geometry_map).size(), 0);
+  BroadPhaseStatistics stats = engine.broad_phase_statistics();
+  EXPECT_EQ(stats.num_pose_updates, 1);
+  EXPECT_EQ(stats.num_geometries_moved, kCount - 1);
+  EXPECT_EQ(stats.num_full_refits, 1);
+  EXPECT_EQ(stats.num_incremental_refits, 0);
+  EXPECT_GE(stats.update_time, 0.0);
+
+  // Moving the last sphere onto the first only updates the moved sphere.
+  poses[kCount - 1] = Isometry3<double>(Translation3d{0.5, 0, 0});
+  engine.UpdateWorldPoses(poses, indices);
+  EXPECT_EQ(engine.ComputePointPairPenetration(geometry_map).size(), 1);
+  stats = engine.broad_phase_statistics();
+  EXPECT_EQ(stats.num_pose_updates, 2);
+  EXPECT_EQ(stats.num_geometries_moved, kCount);
+  EXPECT_EQ(stats.num_full_refits, 1);
+  EXPECT_EQ(stats.num_incremental_refits, 1);
+
+  // Repeating the same poses does no broad-phase work at all.
+  engine.UpdateWorldPoses(poses, indices);
+  EXPECT_EQ(engine.ComputePointPairPenetration(geometry_map).size(), 1);
+  stats = engine.broad_phase_statistics();
+  EXPECT_EQ(stats.num_pose_updates, 3);
+  EXPECT_EQ(stats.num_geometries_moved, kCount);
+  EXPECT_EQ(stats.num_full_refits, 1);
+  EXPECT_EQ(stats.num_incremental_refits, 1);
+
+  // Copies start with fresh statistics, but the same (current) broad phase.
+  ProximityEngine<double> engine_copy(engine);
+  EXPECT_EQ(engine_copy.broad_phase_statistics().num_pose_updates, 0);
+  EXPECT_EQ(engine_copy.ComputePointPairPenetration(geometry_map).size(), 1);
+
+  // Moving the sphere back away removes the collision.
+  poses[kCount - 1] = Isometry3<double>(Translation3d{3.0 * kCount, 0, 0});
+  engine.UpdateWorldPoses(poses, indices);
+  EXPECT_EQ(engine.ComputePointPairPenetration(geometry_map).size(), 0);
+  EXPECT_EQ(engine.broad_phase_statistics().num_incremental_refits, 2);
+
+  engine.ResetBroadPhaseStatistics();
+  stats = engine.broad_phase_statistics();
+  EXPECT_EQ(stats.num_pose_updates, 0);
+  EXPECT_EQ(stats.num_geometries_moved, 0);
+  EXPECT_EQ(stats.num_full_refits, 0);
+  EXPECT_EQ(stats.num_incremental_refits, 0);
+  EXPECT_EQ(stats.update_time, 0.0);
+}
+
+// Confirms that the parallel narrowphase reports exactly what the sequential
+// one does, in the same order.
+GTEST_TEST(ProximityEngineTests, ParallelNarrowPhase) {
+  ProximityEngine<double> engine;
+  std::vector<GeometryId> geometry_map;
+  std::vector<GeometryIndex> indices;
+  std::vector<Isometry3<double>> poses;
+  // A grid of interpenetrating spheres, boxes, and cylinders (in no particular
+  // geometry id order) resting on an anchored box.
+  const int kSide = 5;
+  for (int i = 0; i < kSide * kSide; ++i) {
+    const GeometryIndex index(static_cast<int>(geometry_map.size()));
+    switch (i % 3) {
+      case 0: engine.AddDynamicGeometry(Sphere(0.3), index); break;
+      case 1: engine.AddDynamicGeometry(Box(0.5, 0.5, 0.5), index); break;
+      case 2: engine.AddDynamicGeometry(Cylinder(0.25, 0.6), index); break;
+    }
+    geometry_map.push_back(GeometryId::get_new_id());
+    indices.push_back(index);
+    poses.push_back(Isometry3<double>(
+        Translation3d{0.45 * (i % kSide), 0.45 * (i / kSide), 0.2}));
+  }
+  engine.AddAnchoredGeometry(
+      Box(10, 10, 0.2), Isometry3<double>::Identity(),
+      GeometryIndex(static_cast<int>(geometry_map.size())));
+  geometry_map.push_back(GeometryId::get_new_id());
+  std::reverse(geometry_map.begin(), geometry_map.end());
+  engine.UpdateWorldPoses(poses, indices);
+
+  EXPECT_EQ(engine.get_num_parallel_executions(), 1);
+  const std::vector<PenetrationAsPointPair<double>> expected_contacts =
+      engine.ComputePointPairPenetration(geometry_map);
+  const std::vector<SignedDistancePair<double>> expected_distances =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+  ASSERT_GT(expected_contacts.size(), 0);
+  ASSERT_GT(expected_distances.size(), expected_contacts.size());
+
+  engine.set_num_parallel_executions(4);
+  EXPECT_EQ(engine.get_num_parallel_executions(), 4);
+  // Copies keep the number of threads.
+  ProximityEngine<double> engine_copy(engine);
+  EXPECT_EQ(engine_copy.get_num_parallel_executions(), 4);
+  EXPECT_EQ(engine.ToAutoDiffXd()->get_num_parallel_executions(), 4);
+
+  for (const ProximityEngine<double>* test_engine : {&engine, &engine_copy}) {
+    const std::vector<PenetrationAsPointPair<double>> contacts =
+        test_engine->ComputePointPairPenetration(geometry_map);
+    ASSERT_EQ(contacts.size(), expected_contacts.size());
+    for (size_t i = 0; i < contacts.size(); ++i) {
+      EXPECT_EQ(contacts[i].id_A, expected_contacts[i].id_A);
+      EXPECT_EQ(contacts[i].id_B, expected_contacts[i].id_B);
+      EXPECT_EQ(contacts[i].depth, expected_contacts[i].depth);
+      EXPECT_EQ(contacts[i].p_WCa, expected_contacts[i].p_WCa);
+      EXPECT_EQ(contacts[i].p_WCb, expected_contacts[i].p_WCb);
+      EXPECT_EQ(contacts[i].nhat_BA_W, expected_contacts[i].nhat_BA_W);
+    }
+
+    const std::vector<SignedDistancePair<double>> distances =
+        test_engine->ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+    ASSERT_EQ(distances.size(), expected_distances.size());
+    for (size_t i = 0; i < distances.size(); ++i) {
+      EXPECT_EQ(distances[i].id_A, expected_distances[i].id_A);
+      EXPECT_EQ(distances[i].id_B, expected_distances[i].id_B);
+      EXPECT_EQ(distances[i].distance, expected_distances[i].distance);
+      EXPECT_EQ(distances[i].p_ACa, expected_distances[i].p_ACa);
+      EXPECT_EQ(distances[i].p_BCb, expected_distances[i].p_BCb);
+    }
+  }
+
+  engine.set_num_parallel_executions(1);
+  EXPECT_EQ(engine.get_num_parallel_executions(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.set_num_parallel_executions(0), std::logic_error,
+      ".*number of parallel executions must be positive; got 0.");
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
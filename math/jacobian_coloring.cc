@@ -0,0 +1,44 @@
+#include "drake/math/jacobian_coloring.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace drake {
+namespace math {
+
+std::vector<int> ColorJacobianColumns(
+    const Eigen::SparseMatrix<double>& pattern) {
+  const int num_columns = pattern.cols();
+
+  // The columns that have a nonzero in each row.
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> row_major = pattern;
+
+  // Visit the columns with the most nonzeros first.
+  std::vector<int> order(num_columns);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&pattern](int a, int b) {
+    return pattern.col(a).nonZeros() > pattern.col(b).nonZeros();
+  });
+
+  // Give each column the smallest color not already given to a column with
+  // which it shares a row. Colors forbidden for column j are marked with j.
+  std::vector<int> colors(num_columns, -1);
+  std::vector<int> forbidden(num_columns, -1);
+  for (int j : order) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(pattern, j); it; ++it) {
+      for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator
+               neighbor(row_major, it.row());
+           neighbor; ++neighbor) {
+        const int color = colors[neighbor.col()];
+        if (color >= 0) forbidden[color] = j;
+      }
+    }
+    int color = 0;
+    while (forbidden[color] == j) ++color;
+    colors[j] = color;
+  }
+  return colors;
+}
+
+}  // namespace math
+}  // namespace drake
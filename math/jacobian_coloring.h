@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+namespace drake {
+namespace math {
+
+/**
+ * Partitions the columns of a matrix with the given sparsity pattern into
+ * groups of structurally orthogonal columns, i.e., such that no two columns
+ * in the same group have a nonzero in the same row. A Jacobian matrix with
+ * this sparsity pattern can then be computed with one finite difference (or
+ * one automatic differentiation direction) per group, rather than one per
+ * column, by perturbing all of a group's columns at once; every nonzero of
+ * the resulting difference is attributable to exactly one column of the
+ * group. See [Curtis 1974].
+ *
+ * Finding the fewest groups is NP-hard; this uses the greedy sequential
+ * algorithm, visiting columns in order of decreasing number of nonzeros,
+ * which finds the minimum for diagonal, block-diagonal, and tridiagonal
+ * patterns.
+ *
+ * @param pattern The sparsity pattern. Only its structure is used, so
+ * explicitly stored zeros count as nonzeros.
+ * @return The group ("color") of each column. Colors are numbered
+ * consecutively from zero, so the number of groups is one more than the
+ * largest color.
+ *
+ * - [Curtis 1974] A. R. Curtis, M. J. D. Powell, and J. K. Reid. On the
+ *                 estimation of sparse Jacobian matrices. IMA Journal of
+ *                 Applied Mathematics, 13(1):117-119, 1974.
+ */
+std::vector<int> ColorJacobianColumns(
+    const Eigen::SparseMatrix<double>& pattern);
+
+}  // namespace math
+}  // namespace drake
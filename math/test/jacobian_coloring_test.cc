@@ -0,0 +1,123 @@
+#include "drake/math/jacobian_coloring.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace math {
+namespace {
+
+using Eigen::SparseMatrix;
+using Eigen::Triplet;
+
+SparseMatrix<double> MakePattern(
+    int rows, int cols, const std::vector<std::pair<int, int>>& nonzeros) {
+  std::vector<Triplet<double>> triplets;
+  for (const auto& nonzero : nonzeros) {
+    triplets.emplace_back(nonzero.first, nonzero.second, 1.0);
+  }
+  SparseMatrix<double> pattern(rows, cols);
+  pattern.setFromTriplets(triplets.begin(), triplets.end());
+  return pattern;
+}
+
+int NumColors(const std::vector<int>& colors) {
+  if (colors.empty()) return 0;
+  return *std::max_element(colors.begin(), colors.end()) + 1;
+}
+
+// Checks that the colors are numbered consecutively from zero and that no two
+// columns of the same color have a nonzero in the same row.
+void CheckColoring(const SparseMatrix<double>& pattern,
+                   const std::vector<int>& colors) {
+  ASSERT_EQ(static_cast<int>(colors.size()), pattern.cols());
+  const int num_colors = NumColors(colors);
+  for (int color = 0; color < num_colors; ++color) {
+    EXPECT_NE(std::find(colors.begin(), colors.end(), color), colors.end());
+    std::vector<bool> row_used(pattern.rows(), false);
+    for (int j = 0; j < pattern.cols(); ++j) {
+      if (colors[j] != color) continue;
+      for (SparseMatrix<double>::InnerIterator it(pattern, j); it; ++it) {
+        EXPECT_FALSE(row_used[it.row()])
+            << "Columns of color " << color << " share row " << it.row();
+        row_used[it.row()] = true;
+      }
+    }
+  }
+}
+
+GTEST_TEST(JacobianColoringTest, Diagonal) {
+  const int n = 10;
+  std::vector<std::pair<int, int>> nonzeros;
+  for (int i = 0; i < n; ++i) nonzeros.emplace_back(i, i);
+  const SparseMatrix<double> pattern = MakePattern(n, n, nonzeros);
+  const std::vector<int> colors = ColorJacobianColumns(pattern);
+  CheckColoring(pattern, colors);
+  EXPECT_EQ(NumColors(colors), 1);
+}
+
+GTEST_TEST(JacobianColoringTest, Dense) {
+  const int n = 5;
+  std::vector<std::pair<int, int>> nonzeros;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) nonzeros.emplace_back(i, j);
+  }
+  const SparseMatrix<double> pattern = MakePattern(n, n, nonzeros);
+  const std::vector<int> colors = ColorJacobianColumns(pattern);
+  CheckColoring(pattern, colors);
+  EXPECT_EQ(NumColors(colors), n);
+}
+
+GTEST_TEST(JacobianColoringTest, Tridiagonal) {
+  const int n = 20;
+  std::vector<std::pair<int, int>> nonzeros;
+  for (int i = 0; i < n; ++i) {
+    for (int j = std::max(0, i - 1); j <= std::min(n - 1, i + 1); ++j) {
+      nonzeros.emplace_back(i, j);
+    }
+  }
+  const SparseMatrix<double> pattern = MakePattern(n, n, nonzeros);
+  const std::vector<int> colors = ColorJacobianColumns(pattern);
+  CheckColoring(pattern, colors);
+  EXPECT_EQ(NumColors(colors), 3);
+}
+
+// Dense diagonal blocks of sizes 1, 3, 2, and 4 need as many colors as the
+// largest block has columns.
+GTEST_TEST(JacobianColoringTest, BlockDiagonal) {
+  std::vector<std::pair<int, int>> nonzeros;
+  int start = 0;
+  for (int size : {1, 3, 2, 4}) {
+    for (int i = start; i < start + size; ++i) {
+      for (int j = start; j < start + size; ++j) nonzeros.emplace_back(i, j);
+    }
+    start += size;
+  }
+  const SparseMatrix<double> pattern = MakePattern(start, start, nonzeros);
+  const std::vector<int> colors = ColorJacobianColumns(pattern);
+  CheckColoring(pattern, colors);
+  EXPECT_EQ(NumColors(colors), 4);
+}
+
+// Empty columns, explicitly stored zeros, and non-square patterns are handled.
+GTEST_TEST(JacobianColoringTest, Irregular) {
+  SparseMatrix<double> pattern = MakePattern(
+      4, 6, {{0, 0}, {1, 0}, {0, 2}, {2, 3}, {3, 3}, {3, 5}, {1, 5}});
+  pattern.coeffRef(2, 4) = 0.0;
+  const std::vector<int> colors = ColorJacobianColumns(pattern);
+  CheckColoring(pattern, colors);
+  EXPECT_EQ(NumColors(colors), 2);
+  // The stored zero in column 4 conflicts with column 3.
+  EXPECT_NE(colors[3], colors[4]);
+
+  EXPECT_TRUE(ColorJacobianColumns(SparseMatrix<double>(0, 0)).empty());
+  EXPECT_EQ(ColorJacobianColumns(SparseMatrix<double>(3, 2)),
+            std::vector<int>({0, 0}));
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
@@ -617,7 +617,13 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     auto& v = fixed_size_workspace_.mutable_v();
     // With no friction forces Eq. (3) in the documentation reduces to
     // M vˢ⁺¹ = p*.
-    v = M.ldlt().solve(p_star);
+    if (M_ltdl_) {
+      M_ltdl_->Factor(M);
+      v = p_star;
+      M_ltdl_->SolveInPlace(&v);
+    } else {
+      v = M.ldlt().solve(p_star);
+    }
     // "One iteration" with exactly "zero" vt_error.
     statistics_.Update(0.0);
     return ImplicitStribeckSolverResult::kSuccess;
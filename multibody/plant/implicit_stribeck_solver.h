@@ -1,13 +1,16 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
 
 namespace drake {
 namespace multibody {
@@ -700,6 +703,19 @@ class ImplicitStribeckSolver {
     parameters_ = parameters;
   }
 
+  /// Informs the solver that the mass matrix M has the branch-induced sparsity
+  /// pattern of a multibody tree, described by the "parent" array
+  /// `velocity_parents` (see MultibodyTreeTopology::CalcVelocityParents()).
+  /// With this information, linear systems with M are solved using an
+  /// O(nv d²) sparse factorization (see internal::TreeLtdlFactorization), with
+  /// d the depth of the tree, instead of an O(nv³) dense factorization.
+  /// @throws std::exception if `velocity_parents` does not have size nv or if
+  /// it is not a valid parent array.
+  void set_mass_matrix_sparsity(std::vector<int> velocity_parents) {
+    DRAKE_THROW_UNLESS(static_cast<int>(velocity_parents.size()) == nv_);
+    M_ltdl_ = internal::TreeLtdlFactorization<T>(std::move(velocity_parents));
+  }
+
  private:
   // Helper class for unit testing.
   friend class ImplicitStribeckSolverTester;
@@ -1141,6 +1157,10 @@ class ImplicitStribeckSolver {
   mutable FixedSizeWorkspace fixed_size_workspace_;
   mutable VariableSizeWorkspace variable_size_workspace_;
 
+  // Sparse factorization of M, only used if set_mass_matrix_sparsity() was
+  // called.
+  mutable optional<internal::TreeLtdlFactorization<T>> M_ltdl_;
+
   // Precomputed value of cos(theta_max), used by DirectionChangeLimiter.
   double cos_theta_max_{std::cos(parameters_.theta_max)};
 
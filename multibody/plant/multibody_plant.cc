@@ -17,6 +17,7 @@
 #include "drake/multibody/plant/externally_applied_spatial_force.h"
 #include "drake/multibody/tree/prismatic_joint.h"
 #include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
 
 namespace drake {
 namespace multibody {
@@ -638,6 +639,9 @@ void MultibodyPlant<T>::FinalizePlantOnly() {
     solver_parameters.stiction_tolerance =
         stribeck_model_.stiction_tolerance();
     implicit_stribeck_solver_->set_solver_parameters(solver_parameters);
+    // The mass matrix has the sparsity pattern induced by the tree topology.
+    implicit_stribeck_solver_->set_mass_matrix_sparsity(
+        internal_tree().get_topology().CalcVelocityParents());
   }
   SetUpJointLimitsParameters();
 }
@@ -1285,8 +1289,6 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
   const int nv = this->num_velocities();
 
   // Allocate workspace. We might want to cache these to avoid allocations.
-  // Mass matrix.
-  MatrixX<T> M(nv, nv);
   // Forces.
   MultibodyForces<T> forces(internal_tree());
   // Bodies' accelerations, ordered by BodyNodeIndex.
@@ -1314,16 +1316,6 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
     forces.mutable_generalized_forces() +=
         applied_generalized_force_input.Eval(context);
 
-  internal_tree().CalcMassMatrixViaInverseDynamics(context, &M);
-
-  // WARNING: to reduce memory foot-print, we use the input applied arrays also
-  // as output arrays. This means that both the array of applied body forces and
-  // the array of applied generalized forces get overwritten on output. This is
-  // not important in this case since we don't need their values anymore.
-  // Please see the documentation for CalcInverseDynamics() for details.
-
-  // With vdot = 0, this computes:
-  //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
   std::vector<SpatialForce<T>>& F_BBo_W_array = forces.mutable_body_forces();
   VectorX<T>& tau_array = forces.mutable_generalized_forces();
 
@@ -1335,14 +1327,46 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
         context, pc, vc, point_pairs, &F_BBo_W_array);
   }
 
-  internal_tree().CalcInverseDynamics(
-      context, pc, vc, vdot,
-      F_BBo_W_array, tau_array,
-      &A_WB_array,
-      &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
-      &tau_array);
-
-  vdot = M.ldlt().solve(-tau_array);
+  switch (forward_dynamics_method_) {
+    case ForwardDynamicsMethod::kMassMatrix: {
+      // WARNING: to reduce memory foot-print, we use the input applied arrays
+      // also as output arrays. This means that both the array of applied body
+      // forces and the array of applied generalized forces get overwritten on
+      // output. This is not important in this case since we don't need their
+      // values anymore. Please see the documentation for
+      // CalcInverseDynamics() for details.
+
+      // With vdot = 0, this computes:
+      //   tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
+      internal_tree().CalcInverseDynamics(
+          context, pc, vc, vdot,
+          F_BBo_W_array, tau_array,
+          &A_WB_array,
+          &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
+          &tau_array);
+
+      // M has the sparsity pattern induced by the tree topology, which the
+      // LTDL factorization exploits to avoid the O(n³) cost of a dense one.
+      // The factorization only depends on q and is cached.
+      const internal::TreeLtdlFactorization<T>& M_ltdl =
+          internal_tree().EvalMassMatrixLtdl(context);
+      vdot = -tau_array;
+      M_ltdl.SolveInPlace(&vdot);
+      break;
+    }
+    case ForwardDynamicsMethod::kArticulatedBody: {
+      // The articulated body inertias only depend on q and are cached.
+      const internal::ArticulatedBodyInertiaCache<T>& abc =
+          internal_tree().EvalArticulatedBodyInertiaCache(context);
+      internal::ArticulatedBodyForceCache<T> aba_force_cache(
+          internal_tree().get_topology());
+      internal_tree().CalcArticulatedBodyForceCache(
+          context, pc, vc, abc, forces, &aba_force_cache);
+      internal_tree().CalcArticulatedBodyAccelerations(
+          context, pc, abc, aba_force_cache, &A_WB_array, &vdot);
+      break;
+    }
+  }
 
   auto v = x.bottomRows(nv);
   VectorX<T> xdot(this->num_multibody_states());
@@ -1417,10 +1441,9 @@ void MultibodyPlant<T>::CalcImplicitStribeckResults(
   VectorX<T> q0 = x0.topRows(nq);
   VectorX<T> v0 = x0.bottomRows(nv);
 
-  // Mass matrix and its factorization.
+  // Mass matrix. The contact solver factorizes it as needed.
   MatrixX<T> M0(nv, nv);
-  internal_tree().CalcMassMatrixViaInverseDynamics(context0, &M0);
-  auto M0_ldlt = M0.ldlt();
+  internal_tree().CalcMassMatrix(context0, &M0);
 
   // Forces at the previous time step.
   MultibodyForces<T> forces0(internal_tree());
@@ -44,6 +44,25 @@ namespace multibody {
 #define DRAKE_MBP_THROW_IF_NOT_FINALIZED() ThrowIfNotFinalized(__func__)
 /// @endcond
 
+/// The numerical method used by a continuous MultibodyPlant to compute the
+/// generalized accelerations v̇ from the state and the applied forces, see
+/// MultibodyPlant::set_forward_dynamics_method().
+enum class ForwardDynamicsMethod {
+  /// Forms the mass matrix M(q) with the composite rigid body algorithm and
+  /// solves `M(q)v̇ = -tau` with a sparse LTDL factorization that exploits
+  /// the tree topology, where tau is computed with inverse dynamics for
+  /// v̇ = 0. The cost of this method is O(n d²) in the number of generalized
+  /// velocities n and the depth d of the tree, i.e. O(n³) for a serial chain,
+  /// but with a small constant, which makes it the fastest choice for systems
+  /// with just a few degrees of freedom or with many short branches.
+  kMassMatrix,
+  /// Uses the O(n) articulated body algorithm [Featherstone 2008, Jain 2010]
+  /// which computes v̇ with three recursive passes over the tree without ever
+  /// forming the mass matrix. Preferred for systems with many degrees of
+  /// freedom.
+  kArticulatedBody,
+};
+
 /// %MultibodyPlant is a Drake system framework representation (see
 /// systems::System) for the model of a physical system consisting of a
 /// collection of interconnected bodies.  See @ref multibody for an overview of
@@ -224,6 +243,7 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     geometry_id_to_visual_index_ = other.geometry_id_to_visual_index_;
     geometry_id_to_collision_index_ = other.geometry_id_to_collision_index_;
     default_coulomb_friction_ = other.default_coulomb_friction_;
+    forward_dynamics_method_ = other.forward_dynamics_method_;
     visual_geometries_ = other.visual_geometries_;
     collision_geometries_ = other.collision_geometries_;
     if (geometry_source_is_registered())
@@ -2252,6 +2272,30 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrixViaInverseDynamics(context, H);
   }
 
+  /// Performs the computation of the mass matrix `M(q)` of the model using
+  /// the Composite Rigid Body Algorithm (CRBA) [Featherstone 2008, §6.2],
+  /// where the generalized positions q are stored in `context`.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] H
+  ///   A valid (non-null) pointer to a squared matrix in `ℛⁿˣⁿ` with n the
+  ///   number of generalized velocities (num_velocities()) of the model.
+  ///   This method aborts if H is nullptr or if it does not have the proper
+  ///   size.
+  ///
+  /// The result is the same as CalcMassMatrixViaInverseDynamics(), but the
+  /// cost is O(n d) rather than O(n²), with d the depth of the tree. Entries
+  /// `Hᵢⱼ` for which neither of the velocities i and j is outboard of the other
+  /// are set to zero.
+  ///
+  /// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+  ///                       algorithms. Springer.
+  void CalcMassMatrix(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const {
+    internal_tree().CalcMassMatrix(context, H);
+  }
+
   // TODO(amcastro-tri): Add state accessors for free body spatial velocities.
 
   /// @}
@@ -2753,6 +2797,24 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   /// @see MultibodyPlant::MultibodyPlant(double)
   double time_step() const { return time_step_; }
 
+  /// Sets the numerical method used to compute the generalized accelerations
+  /// of `this` plant when it is modeled as a continuous system. Both methods
+  /// compute the same accelerations (to round-off) and account for the same
+  /// forces; they only differ in computational cost. See ForwardDynamicsMethod
+  /// for details. This setting is ignored for discrete plants.
+  /// It can be called either pre- or post- Finalize().
+  /// @default ForwardDynamicsMethod::kMassMatrix.
+  void set_forward_dynamics_method(ForwardDynamicsMethod method) {
+    forward_dynamics_method_ = method;
+  }
+
+  /// Returns the numerical method used to compute the generalized
+  /// accelerations when `this` plant is modeled as a continuous system.
+  /// @see set_forward_dynamics_method().
+  ForwardDynamicsMethod get_forward_dynamics_method() const {
+    return forward_dynamics_method_;
+  }
+
   /// @anchor mbp_penalty_method
   /// @name Contact by penalty method
   ///
@@ -3605,6 +3667,10 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // plant is modeled as a continuous system, it is exactly zero.
   double time_step_{0};
 
+  // The method used to compute generalized accelerations in continuous mode.
+  ForwardDynamicsMethod forward_dynamics_method_{
+      ForwardDynamicsMethod::kMassMatrix};
+
   // The solver used when the plant is modeled as a discrete system.
   std::unique_ptr<ImplicitStribeckSolver<T>> implicit_stribeck_solver_;
 
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/uniform_gravity_field_element.h"
+
+DEFINE_int32(repetitions, 1000,
+             "Number of evaluations timed for each model size.");
+
+// Compares the cost of MultibodyPlant::CalcTimeDerivatives() using each of the
+// ForwardDynamicsMethod options, for serial chains of increasing number of
+// degrees of freedom. For a chain the mass matrix method costs O(n³) while the
+// articulated body algorithm costs O(n), so that the latter is expected to be
+// faster past some crossover size.
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using systems::Context;
+using systems::ContinuousState;
+
+// Makes a serial chain of `num_links` rods connected by revolute joints, with
+// the joint axes alternating between the y and z axes so that the chain moves
+// in three dimensions.
+std::unique_ptr<MultibodyPlant<double>> MakeChain(int num_links) {
+  const double kMass = 1.0;
+  const double kLength = 0.3;
+  const double kRadius = 0.02;
+  auto plant = std::make_unique<MultibodyPlant<double>>();
+  const auto M_B = SpatialInertia<double>::MakeFromCentralInertia(
+      kMass, Vector3d(kLength / 2.0, 0.0, 0.0),
+      kMass * UnitInertia<double>::SolidCylinder(
+          kRadius, kLength, Vector3d::UnitX()));
+  const Body<double>* parent = &plant->world_body();
+  for (int i = 0; i < num_links; ++i) {
+    const RigidBody<double>& link =
+        plant->AddRigidBody("link" + std::to_string(i), M_B);
+    const optional<RigidTransformd> X_PF =
+        RigidTransformd(Vector3d(i == 0 ? 0.0 : kLength, 0.0, 0.0));
+    const optional<RigidTransformd> X_BM = nullopt;
+    const Vector3d axis = i % 2 == 0 ? Vector3d::UnitY() : Vector3d::UnitZ();
+    plant->AddJoint<RevoluteJoint>(
+        "joint" + std::to_string(i), *parent, X_PF, link, X_BM, axis);
+    parent = &link;
+  }
+  plant->AddForceElement<UniformGravityFieldElement>();
+  plant->Finalize();
+  return plant;
+}
+
+// Returns the average time, in seconds, of one evaluation of the time
+// derivatives using `method`. Positions are changed on each evaluation so that
+// no position dependent cache entries are reused across evaluations.
+double TimeDerivatives(MultibodyPlant<double>* plant,
+                       ForwardDynamicsMethod method) {
+  plant->set_forward_dynamics_method(method);
+  std::unique_ptr<Context<double>> context = plant->CreateDefaultContext();
+  std::unique_ptr<ContinuousState<double>> derivatives =
+      plant->AllocateTimeDerivatives();
+  const int nv = plant->num_velocities();
+  const VectorXd q0 = VectorXd::LinSpaced(nv, -0.5, 0.5);
+  plant->SetVelocities(context.get(), VectorXd::LinSpaced(nv, 1.0, -1.0));
+  const double elapsed = common::test::MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_repetitions; ++i) {
+      plant->SetPositions(context.get(), q0 * (1.0 + 1.0e-3 * i));
+      plant->CalcTimeDerivatives(*context, derivatives.get());
+    }
+  });
+  return elapsed / FLAGS_repetitions;
+}
+
+int do_main() {
+  std::cout << "   dofs   mass matrix [us]   articulated body [us]\n";
+  for (int num_links : {1, 2, 4, 7, 10, 16, 24, 32, 64, 128}) {
+    std::unique_ptr<MultibodyPlant<double>> plant = MakeChain(num_links);
+    const double mass_matrix_time =
+        TimeDerivatives(plant.get(), ForwardDynamicsMethod::kMassMatrix);
+    const double articulated_body_time =
+        TimeDerivatives(plant.get(), ForwardDynamicsMethod::kArticulatedBody);
+    std::cout << fmt::format("{:7d} {:18.2f} {:23.2f}\n", num_links,
+                             1.0e6 * mass_matrix_time,
+                             1.0e6 * articulated_body_time);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times MultibodyPlant::CalcTimeDerivatives() for each of the "
+      "ForwardDynamicsMethod options.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::multibody::do_main();
+}
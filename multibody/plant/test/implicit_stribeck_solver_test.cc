@@ -746,6 +746,32 @@ TEST_F(PizzaSaver, NoContact) {
   EXPECT_EQ(solver_.get_tangential_velocities().size(), 0);
 }
 
+// Same as the NoContact test, but informing the solver of the sparsity of the
+// mass matrix so that it uses a sparse factorization. For this problem the
+// mass matrix is diagonal and therefore no velocity has a parent.
+TEST_F(PizzaSaver, NoContactWithMassMatrixSparsity) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  const double dt = 1.0e-3;  // time step in seconds.
+  const double Mz = 6.0;
+  const Vector3<double> tau(0.0, 0.0, Mz);
+  const Vector3<double> v0 = Vector3<double>::Zero();
+
+  solver_.set_mass_matrix_sparsity({-1, -1, -1});
+  SetNoContactProblem(v0, tau, dt);
+
+  ImplicitStribeckSolverResult info = solver_.SolveWithGuess(dt, v0);
+  ASSERT_EQ(info, ImplicitStribeckSolverResult::kSuccess);
+
+  const VectorX<double>& v = solver_.get_generalized_velocities();
+  ASSERT_EQ(v.size(), nv_);
+  EXPECT_NEAR(v(0), 0.0, kTolerance);
+  EXPECT_NEAR(v(1), 0.0, kTolerance);
+  EXPECT_NEAR(v(2), dt * Mz / I_, kTolerance);
+
+  // The sparsity pattern must be consistent with the number of velocities.
+  EXPECT_THROW(solver_.set_mass_matrix_sparsity({-1, 0}), std::exception);
+}
+
 // This test verifies that the implicit stribeck solver can correctly predict
 // transitions in a problem with impact. In this test the y axis is in the "up"
 // vertical direction, the x axis points to the right and the z axis comes out
@@ -2114,6 +2114,131 @@ INSTANTIATE_TEST_CASE_P(
     Blank, KukaArmTest,
     testing::Values(0.0 /* continuous state */, 1e-3 /* discrete state */));
 
+// Verifies that the articulated body algorithm computes the same time
+// derivatives as the default method based on the mass matrix. We use a
+// floating Kuka arm with a Schunk WSG 50 gripper welded to its end effector,
+// so that the model includes quaternion, revolute, prismatic and weld
+// mobilizers, as well as branches in the tree.
+GTEST_TEST(MultibodyPlantTest, ForwardDynamicsMethods) {
+  const char kArmSdfPath[] =
+      "drake/manipulation/models/iiwa_description/sdf/"
+          "iiwa14_no_collision.sdf";
+  const char kWsg50SdfPath[] =
+      "drake/manipulation/models/wsg_50_description/sdf/schunk_wsg_50.sdf";
+
+  MultibodyPlant<double> plant;
+  Parser parser(&plant);
+  const ModelInstanceIndex arm_model =
+      parser.AddModelFromFile(FindResourceOrThrow(kArmSdfPath));
+  const ModelInstanceIndex gripper_model =
+      parser.AddModelFromFile(FindResourceOrThrow(kWsg50SdfPath));
+  plant.WeldFrames(plant.GetFrameByName("iiwa_link_7", arm_model),
+                   plant.GetFrameByName("body", gripper_model),
+                   RigidTransformd(Vector3d(0.0, 0.0, 0.1)));
+  plant.Finalize();
+  EXPECT_EQ(plant.get_forward_dynamics_method(),
+            ForwardDynamicsMethod::kMassMatrix);
+
+  // An arbitrary non-zero state.
+  auto context = plant.CreateDefaultContext();
+  plant.SetFreeBodyPose(
+      context.get(), plant.GetBodyByName("iiwa_link_0", arm_model),
+      RigidTransformd(RollPitchYaw<double>(0.3, -0.2, 0.5),
+                      Vector3d(0.1, 0.2, 0.3)));
+  for (int i = 1; i <= 7; ++i) {
+    plant.GetJointByName<RevoluteJoint>("iiwa_joint_" + std::to_string(i))
+        .set_angle(context.get(), 0.2 * i - 0.7);
+  }
+  plant.SetVelocities(context.get(),
+                      VectorXd::LinSpaced(plant.num_velocities(), -1.0, 2.0));
+
+  // Actuation and applied generalized forces.
+  context->FixInputPort(
+      plant.get_actuation_input_port(arm_model).get_index(),
+      VectorXd::LinSpaced(plant.num_actuated_dofs(arm_model), -3.0, 3.0));
+  context->FixInputPort(
+      plant.get_actuation_input_port(gripper_model).get_index(),
+      VectorXd::Constant(plant.num_actuated_dofs(gripper_model), 0.5));
+  context->FixInputPort(
+      plant.get_applied_generalized_force_input_port().get_index(),
+      VectorXd::LinSpaced(plant.num_velocities(), 1.0, -1.0));
+
+  auto derivatives_mass_matrix = plant.AllocateTimeDerivatives();
+  plant.CalcTimeDerivatives(*context, derivatives_mass_matrix.get());
+
+  plant.set_forward_dynamics_method(ForwardDynamicsMethod::kArticulatedBody);
+  EXPECT_EQ(plant.get_forward_dynamics_method(),
+            ForwardDynamicsMethod::kArticulatedBody);
+  auto derivatives_articulated_body = plant.AllocateTimeDerivatives();
+  plant.CalcTimeDerivatives(*context, derivatives_articulated_body.get());
+
+  const double kTolerance = 1.0e-11;
+  EXPECT_TRUE(CompareMatrices(
+      derivatives_articulated_body->CopyToVector(),
+      derivatives_mass_matrix->CopyToVector(),
+      kTolerance, MatrixCompareType::relative));
+
+  // The selected method survives scalar conversion.
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_autodiff =
+      systems::System<double>::ToAutoDiffXd(plant);
+  EXPECT_EQ(plant_autodiff->get_forward_dynamics_method(),
+            ForwardDynamicsMethod::kArticulatedBody);
+}
+
+// Verifies the mass matrix computed with the composite rigid body algorithm for
+// a model with branches (the gripper fingers), welds and a free body.
+GTEST_TEST(MultibodyPlantTest, CompositeRigidBodyMassMatrix) {
+  const char kArmSdfPath[] =
+      "drake/manipulation/models/iiwa_description/sdf/"
+          "iiwa14_no_collision.sdf";
+  const char kWsg50SdfPath[] =
+      "drake/manipulation/models/wsg_50_description/sdf/schunk_wsg_50.sdf";
+
+  MultibodyPlant<double> plant;
+  Parser parser(&plant);
+  const ModelInstanceIndex arm_model =
+      parser.AddModelFromFile(FindResourceOrThrow(kArmSdfPath));
+  const ModelInstanceIndex gripper_model =
+      parser.AddModelFromFile(FindResourceOrThrow(kWsg50SdfPath));
+  plant.WeldFrames(plant.world_frame(),
+                   plant.GetFrameByName("iiwa_link_0", arm_model));
+  plant.WeldFrames(plant.GetFrameByName("iiwa_link_7", arm_model),
+                   plant.GetFrameByName("body", gripper_model),
+                   RigidTransformd(Vector3d(0.0, 0.0, 0.1)));
+  const ModelInstanceIndex box_model = plant.AddModelInstance("box");
+  const RigidBody<double>& box = plant.AddRigidBody(
+      "box", box_model, SpatialInertia<double>::MakeFromCentralInertia(
+                 2.0, Vector3d::Zero(),
+                 2.0 * UnitInertia<double>::SolidBox(0.1, 0.2, 0.3)));
+  plant.Finalize();
+  const int nv = plant.num_velocities();
+
+  auto context = plant.CreateDefaultContext();
+  plant.SetPositions(
+      context.get(), VectorXd::LinSpaced(plant.num_positions(), -0.6, 0.8));
+  plant.SetFreeBodyPose(
+      context.get(), box,
+      RigidTransformd(RollPitchYaw<double>(0.3, -0.2, 0.5),
+                      Vector3d(0.1, 0.2, 0.3)));
+
+  MatrixX<double> M_expected(nv, nv);
+  plant.CalcMassMatrixViaInverseDynamics(*context, &M_expected);
+  MatrixX<double> M(nv, nv);
+  plant.CalcMassMatrix(*context, &M);
+  const double kTolerance = 1.0e-13;
+  EXPECT_TRUE(CompareMatrices(M, M_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  // The box is not coupled with the robot. That is, the generalized momentum
+  // of the robot is zero when only the box moves.
+  VectorXd v_box = VectorXd::Zero(nv);
+  plant.SetVelocitiesInArray(
+      box_model, VectorXd::LinSpaced(6, 1.0, 2.0), &v_box);
+  const VectorXd p_box = M * v_box;
+  EXPECT_EQ(plant.GetVelocitiesFromArray(arm_model, p_box).norm(), 0.0);
+  EXPECT_EQ(plant.GetVelocitiesFromArray(gripper_model, p_box).norm(), 0.0);
+}
+
 GTEST_TEST(StateSelection, JointHasNoActuator) {
   const std::string file_name =
       "drake/multibody/benchmarks/acrobot/acrobot.sdf";
@@ -0,0 +1,4 @@
+#include "drake/multibody/tree/articulated_body_force_cache.h"
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::internal::ArticulatedBodyForceCache)
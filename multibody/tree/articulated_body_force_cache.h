@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_acceleration.h"
+#include "drake/multibody/math/spatial_force.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+#include "drake/multibody/tree/multibody_tree_topology.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/// This class holds the results of the tip-to-base force pass in the recursive
+/// implementation of the articulated body algorithm. Unlike the quantities in
+/// ArticulatedBodyInertiaCache, which depend on the generalized positions q
+/// only, the quantities stored here also depend on the generalized velocities
+/// v and on the applied forces.
+///
+/// Articulated body force cache entries include:
+///
+/// - Articulated body force bias `Zplus_PB_W`, the spatial force bias of the
+///   articulated body B as felt by its (inertialess) parent body P, applied at
+///   Bo and expressed in W. With Aplus_WB the rigid shift of A_WP to Bo, the
+///   spatial force exerted by B's inboard mobilizer on B is
+///   `F_Bo_W = Pplus_PB_W Aplus_WB + Zplus_PB_W`.
+/// - Articulated body hinge force `e_B = tau_B - H_PB_Wᵀ Z_B`, the mobility
+///   space residual force of B's mobilizer.
+/// - Velocity bias `Ab_WB` of the spatial acceleration of B in W, i.e. the
+///   acceleration A_WB that B would have if both the acceleration of its parent
+///   P and the generalized accelerations of its mobilizer were zero.
+///
+/// @tparam T The mathematical type of the context, which must be a valid Eigen
+///           scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+/// - symbolic::Expression
+///
+/// They are already available to link against in the containing library.
+template<typename T>
+class ArticulatedBodyForceCache {
+ public:
+  DRAKE_DECLARE_COPY_AND_MOVE_AND_ASSIGN(ArticulatedBodyForceCache)
+
+  /// Constructs an articulated body force cache entry for the given
+  /// MultibodyTreeTopology.
+  explicit ArticulatedBodyForceCache(const MultibodyTreeTopology& topology) :
+      num_nodes_(topology.num_bodies()) {
+    Allocate();
+  }
+
+  /// Articulated body force bias `Zplus_PB_W` of body B as felt by its parent
+  /// body P, applied at Bo and expressed in W.
+  const SpatialForce<T>& get_Zplus_PB_W(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Zplus_PB_W_[body_node_index];
+  }
+
+  /// Mutable version of get_Zplus_PB_W().
+  SpatialForce<T>& get_mutable_Zplus_PB_W(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Zplus_PB_W_[body_node_index];
+  }
+
+  /// Articulated body hinge force `e_B`, of size `nm` with `nm` the number of
+  /// mobilities of the node's mobilizer.
+  const VectorUpTo6<T>& get_e_B(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return e_B_[body_node_index];
+  }
+
+  /// Mutable version of get_e_B().
+  VectorUpTo6<T>& get_mutable_e_B(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return e_B_[body_node_index];
+  }
+
+  /// Velocity bias `Ab_WB` of the spatial acceleration of body B in W,
+  /// expressed in W.
+  const SpatialAcceleration<T>& get_Ab_WB(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Ab_WB_[body_node_index];
+  }
+
+  /// Mutable version of get_Ab_WB().
+  SpatialAcceleration<T>& get_mutable_Ab_WB(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return Ab_WB_[body_node_index];
+  }
+
+ private:
+  // Allocates resources for this articulated body force cache.
+  void Allocate() {
+    Zplus_PB_W_.resize(num_nodes_);
+    e_B_.resize(num_nodes_);
+    Ab_WB_.resize(num_nodes_);
+  }
+
+  // Number of body nodes in the corresponding MultibodyTree.
+  int num_nodes_{0};
+
+  // Pools, all indexed by BodyNodeIndex.
+  std::vector<SpatialForce<T>> Zplus_PB_W_{};
+  std::vector<VectorUpTo6<T>> e_B_{};
+  std::vector<SpatialAcceleration<T>> Ab_WB_{};
+};
+
+DRAKE_DEFINE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN_T(ArticulatedBodyForceCache);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::internal::ArticulatedBodyForceCache)
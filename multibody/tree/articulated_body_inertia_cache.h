@@ -4,6 +4,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
 #include "drake/multibody/tree/articulated_body_inertia.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
@@ -21,6 +22,11 @@ namespace internal {
 /// - Articulated body inertia `Pplus_PB_W`, which can be thought of as the
 ///   articulated body inertia of parent body P as though it were inertialess,
 ///   but taken about Bo and expressed in W.
+/// - LDLT factorization `ldlt_D_B` of the articulated body hinge inertia
+///   `D_B = H_PB_Wᵀ P_B_W H_PB_W`.
+/// - Kalman gain `g_PB_W = P_B_W H_PB_W D_B⁻¹`.
+///
+/// All of these are functions of the generalized positions q only.
 ///
 /// @tparam T The mathematical type of the context, which must be a valid Eigen
 ///           scalar.
@@ -60,6 +66,35 @@ class ArticulatedBodyInertiaCache {
     return Pplus_PB_W_[body_node_index];
   }
 
+  /// LDLT factorization `ldlt_D_B` of the articulated body hinge inertia
+  /// `D_B = H_PB_Wᵀ P_B_W H_PB_W`, of size `nm x nm` with `nm` the number of
+  /// mobilities of the node's mobilizer.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return ldlt_D_B_[body_node_index];
+  }
+
+  /// Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return ldlt_D_B_[body_node_index];
+  }
+
+  /// Kalman gain `g_PB_W = P_B_W H_PB_W D_B⁻¹`, of size `6 x nm` with `nm`
+  /// the number of mobilities of the node's mobilizer.
+  const MatrixUpTo6<T>& get_g_PB_W(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return g_PB_W_[body_node_index];
+  }
+
+  /// Mutable version of get_g_PB_W().
+  MatrixUpTo6<T>& get_mutable_g_PB_W(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return g_PB_W_[body_node_index];
+  }
+
  private:
   // The type of the pools for storing articulated body inertias.
   typedef std::vector<ArticulatedBodyInertia<T>> ABI_PoolType;
@@ -67,13 +102,17 @@ class ArticulatedBodyInertiaCache {
   // Allocates resources for this articulated body cache.
   void Allocate() {
     Pplus_PB_W_.resize(num_nodes_);
+    ldlt_D_B_.resize(num_nodes_);
+    g_PB_W_.resize(num_nodes_);
   }
 
   // Number of body nodes in the corresponding MultibodyTree.
   int num_nodes_{0};
 
-  // Pools.
-  ABI_PoolType Pplus_PB_W_{};  // Indexed by BodyNodeIndex.
+  // Pools, all indexed by BodyNodeIndex.
+  ABI_PoolType Pplus_PB_W_{};
+  std::vector<Eigen::LDLT<MatrixUpTo6<T>>> ldlt_D_B_{};
+  std::vector<MatrixUpTo6<T>> g_PB_W_{};
 };
 
 DRAKE_DEFINE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN_T(ArticulatedBodyInertiaCache);
@@ -9,6 +9,7 @@
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/math/spatial_algebra.h"
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
+#include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/body.h"
 #include "drake/multibody/tree/mobilizer.h"
@@ -399,7 +400,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
       const systems::Context<T>& context,
       const PositionKinematicsCache<T>& pc,
       const VelocityKinematicsCache<T>& vc,
-      const VectorX<T>& mbt_vdot,
+      const Eigen::Ref<const VectorX<T>>& mbt_vdot,
       std::vector<SpatialAcceleration<T>>* A_WB_array_ptr) const {
     // This method must not be called for the "world" body node.
     DRAKE_DEMAND(topology_.body != world_index());
@@ -1019,10 +1020,11 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     MatrixUpTo6<T> D_B(nv, nv);
     D_B.template triangularView<Eigen::Lower>() = HTxP * H_PB_W;
 
-    // Compute the LDLT factorization of D_B as ldlt_D_B.
+    // Compute the LDLT factorization of D_B as ldlt_D_B. It is stored in the
+    // cache for its later use in the acceleration pass.
     // TODO(bobbyluig): Test performance against inverse().
-    const auto ldlt_D_B =
-        D_B.template selfadjointView<Eigen::Lower>().ldlt();
+    Eigen::LDLT<MatrixUpTo6<T>>& ldlt_D_B = get_mutable_ldlt_D_B(abc);
+    ldlt_D_B = D_B.template selfadjointView<Eigen::Lower>().ldlt();
 
     // Ensure that D_B is not singular.
     // Singularity means that a non-physical hinge mapping matrix was used or
@@ -1039,7 +1041,8 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     }
 
     // Compute the Kalman gain, g_PB_W, using (6).
-    const MatrixUpTo6<T> g_PB_W = ldlt_D_B.solve(HTxP).transpose();
+    MatrixUpTo6<T>& g_PB_W = get_mutable_g_PB_W(abc);
+    g_PB_W = ldlt_D_B.solve(HTxP).transpose();
 
     // Project P_B_W using (7) to obtain Pplus_PB_W, the articulated body
     // inertia of this body B as felt by body P and expressed in frame W.
@@ -1050,6 +1053,193 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
         0.5 * (Pplus_PB_W_mat + Pplus_PB_W_mat.transpose()));
   }
 
+  /// This method is used by MultibodyTree within a tip-to-base loop to compute
+  /// this node's articulated body force bias quantities, which depend on the
+  /// generalized positions, the generalized velocities and the applied forces.
+  /// Together with the articulated body inertia quantities, these are all that
+  /// is needed to compute generalized accelerations in the final base-to-tip
+  /// pass of the articulated body algorithm, see
+  /// CalcArticulatedBodyAccelerations_BaseToTip().
+  ///
+  /// @param[in] context
+  ///   The context with the state of the MultibodyTree model.
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with `context`.
+  /// @param[in] vc
+  ///   An already updated velocity kinematics cache in sync with `context`.
+  /// @param[in] abc
+  ///   An already updated articulated body inertia cache in sync with
+  ///   `context`.
+  /// @param[in] Fapplied_Bo_W
+  ///   Externally applied spatial force on this node's body B at the body's
+  ///   frame origin `Bo`, expressed in the world frame.
+  /// @param[in] tau_applied
+  ///   Externally applied generalized force at this node's mobilizer. It can
+  ///   have zero size, implying no generalized forces are applied. Otherwise it
+  ///   must have a size equal to the number of generalized velocities for this
+  ///   node's mobilizer, see get_num_mobilizer_velocities().
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix for this node, see
+  ///   CalcArticulatedBodyInertiaCache_TipToBase().
+  /// @param[out] aba_force_cache
+  ///   A pointer to a valid, non nullptr, articulated body force cache.
+  ///
+  /// @pre The position kinematics cache `pc` was already updated to be in sync
+  /// with `context` by MultibodyTree::CalcPositionKinematicsCache().
+  /// @pre The velocity kinematics cache `vc` was already updated to be in sync
+  /// with `context` by MultibodyTree::CalcVelocityKinematicsCache().
+  /// @pre The articulated body inertia cache `abc` was already updated to be in
+  /// sync with `context` by MultibodyTree::CalcArticulatedBodyInertiaCache().
+  /// @pre CalcArticulatedBodyForceCache_TipToBase() must have already been
+  /// called for all the child nodes of `this` node (and, by recursive
+  /// precondition, all successor nodes in the tree.)
+  ///
+  /// @throws std::exception when called on the _root_ node or
+  /// `aba_force_cache` is nullptr.
+  void CalcArticulatedBodyForceCache_TipToBase(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const SpatialForce<T>& Fapplied_Bo_W,
+      const Eigen::Ref<const VectorX<T>>& tau_applied,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(aba_force_cache != nullptr);
+    DRAKE_DEMAND(
+        tau_applied.size() == get_num_mobilizer_velocities() ||
+        tau_applied.size() == 0);
+
+    // As a guideline for developers, a summary of the computations performed in
+    // this method is provided. Notation is as in
+    // CalcArticulatedBodyInertiaCache_TipToBase(), with the additions:
+    //  - Ab_WB for the velocity bias of the spatial acceleration of B in W.
+    //    That is, the spatial acceleration of B when both the parent's
+    //    acceleration A_WP and the mobilities' accelerations vmdot are zero.
+    //  - Aplus_WB for the rigid shift Φᵀ(p_PB_W) A_WP of the parent's spatial
+    //    acceleration to Bo.
+    //  With these, A_WB = Aplus_WB + Ab_WB + H_PB_W vmdot.
+    //
+    // The spatial force F_Bo_W exerted by B's inboard mobilizer on the
+    // articulated body B (that is, B and all its outboard bodies) is an affine
+    // function of the acceleration of B:
+    //   F_Bo_W = P_B_W A_WB + Z_B_W                                        (1)
+    // where the articulated body force bias Z_B_W collects the gyroscopic
+    // force Fb_Bo_W on B, the externally applied force Fapp_Bo_W and the
+    // contributions from B's children Cᵢ, see [Jain 2010, §7.1]:
+    //   Z_B_W = Fb_Bo_W - Fapp_Bo_W + Σᵢ(Φ(p_BCᵢ_W) Zplus_BCᵢ_W)            (2)
+    // Only the component of F_Bo_W along the motion sub-space of the mobilizer
+    // does work, and it must balance the applied generalized forces tau_B:
+    //   tau_B = H_PB_Wᵀ F_Bo_W                                             (3)
+    // Using A_WB from above in (1) and (3), the accelerations of the mobilities
+    // are:
+    //   vmdot = D_B⁻¹ e_B - g_PB_Wᵀ (Aplus_WB + Ab_WB)                     (4)
+    // where e_B is the articulated body hinge force:
+    //   e_B = tau_B - H_PB_Wᵀ Z_B_W                                        (5)
+    // Substituting (4) back into (1) leads to F_Bo_W in terms of the parent's
+    // acceleration, F_Bo_W = Pplus_PB_W Aplus_WB + Zplus_PB_W, with:
+    //   Zplus_PB_W = Z_B_W + Pplus_PB_W Ab_WB + g_PB_W e_B                 (6)
+    // which is the term propagated to the parent in (2).
+
+    // Velocity bias Ab_WB, needed here and in the acceleration pass.
+    SpatialAcceleration<T>& Ab_WB = get_mutable_Ab_WB(aba_force_cache);
+    Ab_WB = CalcSpatialAccelerationBias(context, pc, vc);
+
+    // Gyroscopic spatial force Fb_Bo_W, i.e. the total force on B when
+    // A_WB = 0.
+    SpatialForce<T> Fb_Bo_W;
+    CalcBodySpatialForceGivenItsSpatialAcceleration(
+        context, pc, vc, SpatialAcceleration<T>::Zero(), &Fb_Bo_W);
+
+    // Articulated body force bias using (2).
+    SpatialForce<T> Z_B_W = Fb_Bo_W;
+    Z_B_W -= Fapplied_Bo_W;
+
+    const Matrix3<T>& R_WB = get_X_WB(pc).linear();
+    for (const BodyNode<T>* child : children_) {
+      // Shift vector p_CoBo_W, with X_BC the pose X_PB of the child.
+      const Vector3<T> p_CoBo_W = -(R_WB * child->get_X_PB(pc).translation());
+      Z_B_W += child->get_Zplus_PB_W(*aba_force_cache).Shift(p_CoBo_W);
+    }
+
+    // Articulated body hinge force using (5).
+    VectorUpTo6<T>& e_B = get_mutable_e_B(aba_force_cache);
+    e_B = -H_PB_W.transpose() * Z_B_W.get_coeffs();
+    if (tau_applied.size() != 0) e_B += tau_applied;
+
+    // Projected articulated body force bias using (6).
+    get_mutable_Zplus_PB_W(aba_force_cache) = SpatialForce<T>(
+        Z_B_W.get_coeffs() + get_Pplus_PB_W(abc) * Ab_WB.get_coeffs() +
+        get_g_PB_W(abc) * e_B);
+  }
+
+  /// This method is used by MultibodyTree within a base-to-tip loop to compute
+  /// the generalized accelerations of this node's mobilizer and the spatial
+  /// acceleration `A_WB` of this node's body B, in the final pass of the
+  /// articulated body algorithm. See
+  /// CalcArticulatedBodyForceCache_TipToBase() for the notation and a
+  /// derivation.
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache.
+  /// @param[in] abc
+  ///   An already updated articulated body inertia cache in sync with `pc`.
+  /// @param[in] aba_force_cache
+  ///   An already updated articulated body force cache in sync with `pc`.
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix for this node, see
+  ///   CalcArticulatedBodyInertiaCache_TipToBase().
+  /// @param[in,out] A_WB_array
+  ///   A pointer to a valid, non nullptr, vector of spatial accelerations
+  ///   ordered by BodyNodeIndex. On input, it must contain already computed
+  ///   spatial accelerations for the inboard bodies to this node's body B. On
+  ///   output, its entry for body B stores `A_WB`.
+  /// @param[out] vdot
+  ///   A pointer to a valid, non nullptr, vector of generalized accelerations
+  ///   for the entire model. On output, the entries for this node's mobilizer
+  ///   store its generalized accelerations.
+  ///
+  /// @pre CalcArticulatedBodyAccelerations_BaseToTip() must have already been
+  /// called for the parent node (and, by recursive precondition, all
+  /// predecessor nodes in the tree).
+  void CalcArticulatedBodyAccelerations_BaseToTip(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const ArticulatedBodyForceCache<T>& aba_force_cache,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> vdot) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_DEMAND(A_WB_array != nullptr);
+    DRAKE_DEMAND(vdot != nullptr);
+
+    // Since we are in a base-to-tip recursion the parent body P's spatial
+    // acceleration is already available in the array.
+    const SpatialAcceleration<T>& A_WP = get_A_WP_from_array(*A_WB_array);
+
+    // Rigid shift Aplus_WB = Φᵀ(p_PB_W) A_WP. The centrifugal term due to the
+    // angular velocity of P is already included in the velocity bias Ab_WB.
+    const Vector3<T> p_PB_W =
+        get_X_WP(pc).linear() * get_X_PB(pc).translation();
+    const Vector3<T>& alpha_WP = A_WP.rotational();
+    const SpatialAcceleration<T> Aplus_WB(
+        alpha_WP, A_WP.translational() + alpha_WP.cross(p_PB_W));
+
+    // Acceleration of B for zero mobility accelerations, Aplus_WB + Ab_WB.
+    const Vector6<T> A0_WB =
+        Aplus_WB.get_coeffs() + get_Ab_WB(aba_force_cache).get_coeffs();
+
+    // Mobility accelerations using Eq. (4) in
+    // CalcArticulatedBodyForceCache_TipToBase().
+    auto vmdot = get_mutable_velocities_from_array(vdot);
+    vmdot = get_ldlt_D_B(abc).solve(get_e_B(aba_force_cache)) -
+        get_g_PB_W(abc).transpose() * A0_WB;
+
+    get_mutable_A_WB_from_array(A_WB_array) =
+        SpatialAcceleration<T>(A0_WB + H_PB_W * vmdot);
+  }
+
  protected:
   /// Returns the inboard frame F of this node's mobilizer.
   /// @throws std::runtime_error if called on the root node corresponding to
@@ -1086,9 +1276,9 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
   // from a vector of generalized velocities for the entire parent multibody
   // tree. Useful for the implementation of operator forms where the generalized
   // velocity (or time derivatives of the generalized velocities) is an argument
-  // to the operator.
-  Eigen::VectorBlock<const VectorX<T>> get_mobilizer_velocities(
-      const VectorX<T>& v) const {
+  // to the operator. The returned block refers to `v`, which must outlive it.
+  Eigen::VectorBlock<const Eigen::Ref<const VectorX<T>>>
+  get_mobilizer_velocities(const Eigen::Ref<const VectorX<T>>& v) const {
     return v.segment(topology_.mobilizer_velocities_start_in_v,
                      topology_.num_mobilizer_velocities);
   }
@@ -1232,6 +1422,72 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     return abc->get_mutable_Pplus_PB_W(topology_.index);
   }
 
+  // Returns a const reference to the LDLT factorization of the articulated
+  // body hinge inertia D_B of this node.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_ldlt_D_B(topology_.index);
+  }
+
+  // Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_ldlt_D_B(topology_.index);
+  }
+
+  // Returns a const reference to the Kalman gain g_PB_W of this node.
+  const MatrixUpTo6<T>& get_g_PB_W(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_g_PB_W(topology_.index);
+  }
+
+  // Mutable version of get_g_PB_W().
+  MatrixUpTo6<T>& get_mutable_g_PB_W(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_g_PB_W(topology_.index);
+  }
+
+  // =========================================================================
+  // ArticulatedBodyForceCache Accessors and Mutators.
+
+  // Returns a const reference to the articulated body force bias Zplus_PB_W
+  // of this node's body B as felt by its parent body P.
+  const SpatialForce<T>& get_Zplus_PB_W(
+      const ArticulatedBodyForceCache<T>& aba_force_cache) const {
+    return aba_force_cache.get_Zplus_PB_W(topology_.index);
+  }
+
+  // Mutable version of get_Zplus_PB_W().
+  SpatialForce<T>& get_mutable_Zplus_PB_W(
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    return aba_force_cache->get_mutable_Zplus_PB_W(topology_.index);
+  }
+
+  // Returns a const reference to the articulated body hinge force e_B.
+  const VectorUpTo6<T>& get_e_B(
+      const ArticulatedBodyForceCache<T>& aba_force_cache) const {
+    return aba_force_cache.get_e_B(topology_.index);
+  }
+
+  // Mutable version of get_e_B().
+  VectorUpTo6<T>& get_mutable_e_B(
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    return aba_force_cache->get_mutable_e_B(topology_.index);
+  }
+
+  // Returns a const reference to the velocity bias Ab_WB of the spatial
+  // acceleration of this node's body B.
+  const SpatialAcceleration<T>& get_Ab_WB(
+      const ArticulatedBodyForceCache<T>& aba_force_cache) const {
+    return aba_force_cache.get_Ab_WB(topology_.index);
+  }
+
+  // Mutable version of get_Ab_WB().
+  SpatialAcceleration<T>& get_mutable_Ab_WB(
+      ArticulatedBodyForceCache<T>* aba_force_cache) const {
+    return aba_force_cache->get_mutable_Ab_WB(topology_.index);
+  }
+
   // =========================================================================
   // Per Node Array Accessors.
   // Quantities are ordered by BodyNodeIndex unless otherwise specified.
@@ -1392,6 +1648,41 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     X_FM = get_mobilizer().CalcAcrossMobilizerTransform(context);
   }
 
+  // Computes the velocity bias Ab_WB of the spatial acceleration of body B in
+  // W, expressed in W. This is the acceleration A_WB computed by
+  // CalcSpatialAcceleration_BaseToTip() when both the parent's acceleration
+  // A_WP and this node's generalized accelerations vmdot are zero. It includes
+  // the centrifugal and Coriolis terms due to the motion of P and of B in P:
+  //   Ab_WB = 0.ComposeWithMovingFrameAcceleration(
+  //       p_PB_W, w_WP, V_PB_W, Ab_PB_W)
+  // where Ab_PB_W = R_WF * Ab_FM.Shift(p_MB_F, w_FM) with Ab_FM = Hdot_FM * vm.
+  SpatialAcceleration<T> CalcSpatialAccelerationBias(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc) const {
+    const math::RigidTransform<T> X_PF =
+        inboard_frame().CalcPoseInBodyFrame(context);
+    const math::RigidTransform<T> X_MB =
+        outboard_frame().CalcPoseInBodyFrame(context).inverse();
+    const math::RigidTransform<T>& X_WP = get_X_WP(pc);
+    const Matrix3<T> R_WF = X_WP.linear() * X_PF.linear();
+    const Vector3<T> p_MB_F = get_X_FM(pc).linear() * X_MB.translation();
+    const SpatialVelocity<T>& V_FM = get_V_FM(vc);
+
+    // Ab_FM = Hdot_FM * vm, obtained with vmdot = 0.
+    const VectorUpTo6<T> vmdot_zero =
+        VectorUpTo6<T>::Zero(get_num_mobilizer_velocities());
+    const SpatialAcceleration<T> Ab_FM =
+        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(
+            context, vmdot_zero);
+    const SpatialAcceleration<T> Ab_PB_W =
+        R_WF * Ab_FM.Shift(p_MB_F, V_FM.rotational());
+
+    const Vector3<T> p_PB_W = X_WP.linear() * get_X_PB(pc).translation();
+    return SpatialAcceleration<T>::Zero().ComposeWithMovingFrameAcceleration(
+        p_PB_W, get_V_WP(vc).rotational(), get_V_PB_W(vc), Ab_PB_W);
+  }
+
   // This method computes the total force Ftot_BBo on body B that must be
   // applied for it to incur in a spatial acceleration A_WB. Mathematically:
   //   Ftot_BBo = M_B_W * A_WB + b_Bo
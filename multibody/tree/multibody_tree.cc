@@ -679,6 +679,151 @@ void MultibodyTree<T>::CalcInverseDynamics(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcPositionKinematicsCacheBatch(
+    const std::vector<const systems::Context<T>*>& contexts,
+    const std::vector<PositionKinematicsCache<T>*>& pcs) const {
+  const int batch_size = static_cast<int>(contexts.size());
+  DRAKE_THROW_UNLESS(static_cast<int>(pcs.size()) == batch_size);
+  for (int i = 0; i < batch_size; ++i) {
+    DRAKE_THROW_UNLESS(contexts[i] != nullptr);
+    DRAKE_THROW_UNLESS(pcs[i] != nullptr);
+  }
+
+  // Same base-to-tip recursion as in CalcPositionKinematicsCache(), with the
+  // loop over instances innermost. This skips the world, level = 0.
+  for (int level = 1; level < tree_height(); ++level) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      DRAKE_ASSERT(node.get_topology().level == level);
+      for (int i = 0; i < batch_size; ++i) {
+        node.CalcPositionKinematicsCache_BaseToTip(*contexts[i], pcs[i]);
+      }
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcVelocityKinematicsCacheBatch(
+    const std::vector<const systems::Context<T>*>& contexts,
+    const std::vector<const PositionKinematicsCache<T>*>& pcs,
+    const std::vector<VelocityKinematicsCache<T>*>& vcs) const {
+  const int batch_size = static_cast<int>(contexts.size());
+  DRAKE_THROW_UNLESS(static_cast<int>(pcs.size()) == batch_size);
+  DRAKE_THROW_UNLESS(static_cast<int>(vcs.size()) == batch_size);
+
+  // Gather the across-node Jacobians for each instance up front so that the
+  // (cached) evaluation stays out of the tree traversal below.
+  std::vector<const std::vector<Vector6<T>>*> H_PB_W_caches(batch_size);
+  for (int i = 0; i < batch_size; ++i) {
+    DRAKE_THROW_UNLESS(contexts[i] != nullptr);
+    DRAKE_THROW_UNLESS(pcs[i] != nullptr);
+    DRAKE_THROW_UNLESS(vcs[i] != nullptr);
+    H_PB_W_caches[i] =
+        &tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(
+            *contexts[i]);
+  }
+
+  // Base-to-tip recursion computing body velocities, skipping the world.
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      DRAKE_ASSERT(node.get_topology().level == depth);
+      for (int i = 0; i < batch_size; ++i) {
+        Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+            node.GetJacobianFromArray(*H_PB_W_caches[i]);
+        node.CalcVelocityKinematicsCache_BaseToTip(
+            *contexts[i], *pcs[i], H_PB_W, vcs[i]);
+      }
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsBatch(
+    const std::vector<const systems::Context<T>*>& contexts,
+    const std::vector<const PositionKinematicsCache<T>*>& pcs,
+    const std::vector<const VelocityKinematicsCache<T>*>& vcs,
+    const MatrixX<T>& known_vdot,
+    const std::vector<const MultibodyForces<T>*>& external_forces,
+    std::vector<std::vector<SpatialAcceleration<T>>>* A_WB_arrays,
+    std::vector<std::vector<SpatialForce<T>>>* F_BMo_W_arrays,
+    MatrixX<T>* tau) const {
+  const int batch_size = static_cast<int>(contexts.size());
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(static_cast<int>(pcs.size()) == batch_size);
+  DRAKE_THROW_UNLESS(static_cast<int>(vcs.size()) == batch_size);
+  DRAKE_THROW_UNLESS(known_vdot.rows() == nv);
+  DRAKE_THROW_UNLESS(known_vdot.cols() == batch_size);
+  DRAKE_THROW_UNLESS(external_forces.empty() ||
+                     static_cast<int>(external_forces.size()) == batch_size);
+  DRAKE_THROW_UNLESS(A_WB_arrays != nullptr);
+  DRAKE_THROW_UNLESS(F_BMo_W_arrays != nullptr);
+  DRAKE_THROW_UNLESS(tau != nullptr);
+  for (int i = 0; i < batch_size; ++i) {
+    DRAKE_THROW_UNLESS(contexts[i] != nullptr);
+    DRAKE_THROW_UNLESS(pcs[i] != nullptr);
+    DRAKE_THROW_UNLESS(vcs[i] != nullptr);
+    if (!external_forces.empty() && external_forces[i] != nullptr) {
+      DRAKE_THROW_UNLESS(external_forces[i]->CheckHasRightSizeForModel(*this));
+    }
+  }
+  tau->resize(nv, batch_size);
+
+  // Per-instance scratch, laid out instance-major so that each instance sees
+  // the per-body arrays expected by the BodyNode kernels. These resizes are
+  // no-ops when the caller reuses the scratch for batches of the same size.
+  std::vector<std::vector<SpatialAcceleration<T>>>& A_WB = *A_WB_arrays;
+  std::vector<std::vector<SpatialForce<T>>>& F_BMo_W = *F_BMo_W_arrays;
+  A_WB.resize(batch_size);
+  F_BMo_W.resize(batch_size);
+  for (int i = 0; i < batch_size; ++i) {
+    A_WB[i].resize(num_bodies());
+    F_BMo_W[i].resize(num_bodies());
+  }
+
+  // Body spatial accelerations, base to tip, skipping the world. The kernels
+  // read the columns of known_vdot in place.
+  for (int i = 0; i < batch_size; ++i) {
+    A_WB[i][world_index()] = SpatialAcceleration<T>::Zero();
+  }
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      for (int i = 0; i < batch_size; ++i) {
+        node.CalcSpatialAcceleration_BaseToTip(
+            *contexts[i], *pcs[i], *vcs[i], known_vdot.col(i), &A_WB[i]);
+      }
+    }
+  }
+
+  // Tip-to-base recursion for the spatial forces, including the world. See
+  // CalcInverseDynamics() for details.
+  VectorUpTo6<T> tau_applied_mobilizer(0);
+  for (int depth = tree_height() - 1; depth >= 0; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      for (int i = 0; i < batch_size; ++i) {
+        const MultibodyForces<T>* forces =
+            external_forces.empty() ? nullptr : external_forces[i];
+        SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
+        tau_applied_mobilizer.resize(0);
+        if (forces != nullptr) {
+          Fapplied_Bo_W = forces->body_forces()[body_node_index];
+          tau_applied_mobilizer =
+              node.get_mobilizer().get_generalized_forces_from_array(
+                  forces->generalized_forces());
+        }
+        // Each node writes its own mobilizer's entries of the i-th column.
+        Eigen::Ref<VectorX<T>> tau_i = tau->col(i);
+        node.CalcInverseDynamics_TipToBase(
+            *contexts[i], *pcs[i], *vcs[i], A_WB[i], Fapplied_Bo_W,
+            tau_applied_mobilizer, &F_BMo_W[i], &tau_i);
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcForceElementsContribution(
     const systems::Context<T>& context,
@@ -784,6 +929,107 @@ void MultibodyTree<T>::DoCalcMassMatrixViaInverseDynamics(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrix(
+    const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const {
+  DRAKE_DEMAND(H != nullptr);
+  DRAKE_DEMAND(H->rows() == num_velocities());
+  DRAKE_DEMAND(H->cols() == num_velocities());
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  DoCalcMassMatrix(context, pc, H);
+}
+
+template <typename T>
+void MultibodyTree<T>::DoCalcMassMatrix(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    EigenPtr<MatrixX<T>> H) const {
+  // Composite Rigid Body Algorithm (CRBA), [Featherstone 2008, §6.2].
+  //
+  // K_BBo_W_array stores, for each body node B, the spatial inertia of the
+  // composite body formed by B and all of its outboard bodies welded together,
+  // about Bo and expressed in W. ArticulatedBodyInertia is used as storage
+  // since, unlike SpatialInertia, its sum and shift operations are well
+  // defined for composite bodies of zero mass.
+  std::vector<ArticulatedBodyInertia<T>> K_BBo_W_array(num_bodies());
+  for (BodyNodeIndex body_node_index(1); body_node_index < num_bodies();
+       ++body_node_index) {
+    const Body<T>& body_B = body_nodes_[body_node_index]->body();
+    const math::RotationMatrix<T>& R_WB =
+        pc.get_X_WB(body_node_index).rotation();
+    const SpatialInertia<T> M_B = body_B.CalcSpatialInertiaInBodyFrame(context);
+    K_BBo_W_array[body_node_index] =
+        ArticulatedBodyInertia<T>(M_B.ReExpress(R_WB));
+  }
+
+  // Tip-to-base recursion to add the composite body inertia of each body into
+  // that of its parent. Bodies at depth = 1 have the world as parent and
+  // therefore we stop there.
+  for (int depth = tree_height() - 1; depth > 1; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNodeIndex parent_node_index =
+          body_nodes_[body_node_index]->get_topology().parent_body_node;
+      const Vector3<T> p_BoPo_W =
+          pc.get_X_WB(parent_node_index).translation() -
+          pc.get_X_WB(body_node_index).translation();
+      K_BBo_W_array[parent_node_index] +=
+          K_BBo_W_array[body_node_index].Shift(p_BoPo_W);
+    }
+  }
+
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  // The column block of H for the mobilities of body B is computed by
+  // projecting the spatial forces F_W = K_BBo_W H_PB_W (one per column),
+  // required to impart unit accelerations to each of B's mobilities, onto the
+  // hinge matrices of B and each of its inboard bodies. Blocks for pairs of
+  // mobilizers in different branches of the tree are zero.
+  H->setZero();
+  for (BodyNodeIndex body_node_index(1); body_node_index < num_bodies();
+       ++body_node_index) {
+    const BodyNode<T>& node = *body_nodes_[body_node_index];
+    const int nv_B = node.get_topology().num_mobilizer_velocities;
+    if (nv_B == 0) continue;
+    const int start_B = node.get_topology().mobilizer_velocities_start_in_v;
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+
+    // On input F_W is applied about Bo.
+    MatrixUpTo6<T> F_W = K_BBo_W_array[body_node_index] * H_PB_W;
+    H->block(start_B, start_B, nv_B, nv_B) = H_PB_W.transpose() * F_W;
+
+    // Walk the path from B to the world. At each step F_W is shifted from the
+    // origin of the child body C to the origin of its parent P.
+    BodyNodeIndex child_node_index = body_node_index;
+    BodyNodeIndex parent_node_index = node.get_topology().parent_body_node;
+    while (parent_node_index != BodyNodeIndex(0)) {
+      const BodyNode<T>& parent_node = *body_nodes_[parent_node_index];
+      const Vector3<T> p_CoPo_W =
+          pc.get_X_WB(parent_node_index).translation() -
+          pc.get_X_WB(child_node_index).translation();
+      // Shift: τ_Po = τ_Co + p_PoCo × f = τ_Co + f × p_CoPo.
+      F_W.template topRows<3>() +=
+          F_W.template bottomRows<3>().colwise().cross(p_CoPo_W);
+
+      const int nv_P = parent_node.get_topology().num_mobilizer_velocities;
+      if (nv_P != 0) {
+        const int start_P =
+            parent_node.get_topology().mobilizer_velocities_start_in_v;
+        // Hinge matrix of P, with G the parent of P.
+        Eigen::Map<const MatrixUpTo6<T>> H_GP_W =
+            parent_node.GetJacobianFromArray(H_PB_W_cache);
+        H->block(start_P, start_B, nv_P, nv_B) = H_GP_W.transpose() * F_W;
+        H->block(start_B, start_P, nv_B, nv_P) =
+            H->block(start_P, start_B, nv_P, nv_B).transpose();
+      }
+
+      child_node_index = parent_node_index;
+      parent_node_index = parent_node.get_topology().parent_body_node;
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -1509,6 +1755,74 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcArticulatedBodyForceCache(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const VelocityKinematicsCache<T>& vc,
+    const ArticulatedBodyInertiaCache<T>& abc,
+    const MultibodyForces<T>& forces,
+    ArticulatedBodyForceCache<T>* aba_force_cache) const {
+  DRAKE_THROW_UNLESS(aba_force_cache != nullptr);
+  DRAKE_DEMAND(forces.CheckHasRightSizeForModel(*this));
+
+  const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array =
+      forces.body_forces();
+  const VectorX<T>& tau_applied_array = forces.generalized_forces();
+
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  // Perform tip-to-base recursion, skipping the world.
+  for (int depth = tree_height() - 1; depth > 0; depth--) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      // Get hinge mapping matrix.
+      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+
+      node.CalcArticulatedBodyForceCache_TipToBase(
+          context, pc, vc, abc, Fapplied_Bo_W_array[body_node_index],
+          node.get_mobilizer().get_generalized_forces_from_array(
+              tau_applied_array),
+          H_PB_W, aba_force_cache);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const ArticulatedBodyInertiaCache<T>& abc,
+    const ArticulatedBodyForceCache<T>& aba_force_cache,
+    std::vector<SpatialAcceleration<T>>* A_WB_array,
+    EigenPtr<VectorX<T>> vdot) const {
+  DRAKE_THROW_UNLESS(A_WB_array != nullptr);
+  DRAKE_THROW_UNLESS(static_cast<int>(A_WB_array->size()) == num_bodies());
+  DRAKE_THROW_UNLESS(vdot != nullptr);
+  DRAKE_THROW_UNLESS(vdot->size() == num_velocities());
+
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  // The world's spatial acceleration is always zero.
+  (*A_WB_array)[world_index()].SetZero();
+
+  // Perform base-to-tip recursion, skipping the world.
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      // Get hinge mapping matrix.
+      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+
+      node.CalcArticulatedBodyAccelerations_BaseToTip(
+          pc, abc, aba_force_cache, H_PB_W, A_WB_array, vdot);
+    }
+  }
+}
+
 template <typename T>
 MatrixX<double> MultibodyTree<T>::MakeStateSelectorMatrix(
     const std::vector<JointIndex>& user_to_joint_index_map) const {
@@ -17,12 +17,14 @@
 #include "drake/common/random.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
+#include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
 #include "drake/multibody/tree/spatial_inertia.h"
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
 #include "drake/multibody/tree/velocity_kinematics_cache.h"
 #include "drake/systems/framework/context.h"
 
@@ -1525,6 +1527,10 @@ class MultibodyTree {
   void CalcMassMatrixViaInverseDynamics(
       const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const;
 
+  /// See MultibodyPlant method.
+  void CalcMassMatrix(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const;
+
   /// See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
@@ -1570,9 +1576,174 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       ArticulatedBodyInertiaCache<T>* abc) const;
 
+  /// Computes the articulated body force bias quantities of the articulated
+  /// body algorithm and stores them in `aba_force_cache`. These depend on the
+  /// state stored in `context` and on the applied forces `forces`.
+  ///
+  /// These include:
+  /// - Articulated body force bias `Zplus_PB_W`, the spatial force bias of body
+  ///   B as felt by its (inertialess) parent body P, applied at Bo and
+  ///   expressed in W.
+  /// - Articulated body hinge force `e_B`, the mobility space residual force on
+  ///   B's mobilizer.
+  /// - Velocity bias `Ab_WB` of the spatial acceleration of each body B.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] pc
+  ///   A position kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] vc
+  ///   A velocity kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] abc
+  ///   An articulated body inertia cache already updated to be in sync with
+  ///   `context`, see CalcArticulatedBodyInertiaCache().
+  /// @param[in] forces
+  ///   The applied forces, with body spatial forces applied at each body's
+  ///   origin Bo and expressed in the world frame W, and with generalized
+  ///   forces applied at the mobilities. It must be compatible with `this`
+  ///   model, see MultibodyForces::CheckHasRightSizeForModel().
+  /// @param[out] aba_force_cache
+  ///   A pointer to a valid, non nullptr, articulated body force cache created
+  ///   with `get_topology()`. This method throws an exception if
+  ///   `aba_force_cache` is a nullptr.
+  void CalcArticulatedBodyForceCache(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const MultibodyForces<T>& forces,
+      ArticulatedBodyForceCache<T>* aba_force_cache) const;
+
+  /// Performs the final base-to-tip pass of the articulated body algorithm to
+  /// compute the generalized accelerations `vdot` that result from the state
+  /// and applied forces previously used to compute `abc` and
+  /// `aba_force_cache`. Together with CalcArticulatedBodyInertiaCache() and
+  /// CalcArticulatedBodyForceCache(), this solves the forward dynamics problem
+  /// `M(q)v̇ + C(q, v)v = tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W` in O(n) operations,
+  /// with n the number of bodies, without ever forming or factorizing the mass
+  /// matrix.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] pc
+  ///   A position kinematics cache object already updated to be in sync with
+  ///   `context`.
+  /// @param[in] abc
+  ///   An articulated body inertia cache already updated to be in sync with
+  ///   `context`.
+  /// @param[in] aba_force_cache
+  ///   An articulated body force cache already updated to be in sync with
+  ///   `context`, see CalcArticulatedBodyForceCache().
+  /// @param[out] A_WB_array
+  ///   A pointer to a valid, non nullptr, vector of spatial accelerations of
+  ///   size num_bodies(). On output, entry `body.node_index()` stores the
+  ///   spatial acceleration `A_WB` of each body B, measured and expressed in
+  ///   the world frame W.
+  /// @param[out] vdot
+  ///   A pointer to a valid, non nullptr, vector of size num_velocities(). On
+  ///   output it stores the generalized accelerations.
+  ///
+  /// @throws std::exception if any of the output arguments is nullptr or has
+  /// the wrong size.
+  void CalcArticulatedBodyAccelerations(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const ArticulatedBodyForceCache<T>& aba_force_cache,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> vdot) const;
+
   /// @}
   // Closes "Computational methods" Doxygen section.
 
+  /// @name Batched computational methods
+  /// These methods evaluate the same quantities as their single-context
+  /// counterparts above for a batch of N independent states of `this` model
+  /// (for instance, the samples of a sampling-based planner or the instances
+  /// of a set of policy rollouts), each stored in its own `systems::Context`.
+  ///
+  /// Rather than performing N complete traversals of the tree, the batch is
+  /// evaluated in a single traversal where the loop over the instances is the
+  /// innermost loop. Each BodyNode (and its Mobilizer) is therefore visited
+  /// once per level for the whole batch, which amortizes the cost of
+  /// dispatching into the node and keeps the node's topology, mobilizer and
+  /// body data hot in cache while the N instances are processed. Generalized
+  /// quantities (accelerations and forces) are passed as `nv x N` matrices,
+  /// one column per instance, and each column is read and written in place.
+  /// Per-body quantities are kept in one array per instance, in the same
+  /// layout used by the single-context methods; the arithmetic itself is not
+  /// vectorized across instances.
+  ///
+  /// Results are identical to those of N calls to the single-context methods.
+  /// All batch arguments must have the same size N. Each context must have
+  /// been created for `this` model and each cache with `get_topology()`.
+  /// @{
+
+  /// Batched version of CalcPositionKinematicsCache(). On output, `pcs[i]`
+  /// stores the position kinematics for the state in `contexts[i]`.
+  /// @throws std::exception if `contexts` and `pcs` have different sizes or
+  /// if any entry is nullptr.
+  void CalcPositionKinematicsCacheBatch(
+      const std::vector<const systems::Context<T>*>& contexts,
+      const std::vector<PositionKinematicsCache<T>*>& pcs) const;
+
+  /// Batched version of CalcVelocityKinematicsCache(). On output, `vcs[i]`
+  /// stores the velocity kinematics for the state in `contexts[i]`.
+  /// @pre `pcs[i]` was updated to be in sync with `contexts[i]`, e.g. with
+  /// CalcPositionKinematicsCacheBatch().
+  /// @throws std::exception if the batch arguments have different sizes or
+  /// if any entry is nullptr.
+  void CalcVelocityKinematicsCacheBatch(
+      const std::vector<const systems::Context<T>*>& contexts,
+      const std::vector<const PositionKinematicsCache<T>*>& pcs,
+      const std::vector<VelocityKinematicsCache<T>*>& vcs) const;
+
+  /// Batched version of CalcInverseDynamics(). Given the known generalized
+  /// accelerations `known_vdot`, of size `num_velocities() x N`, whose i-th
+  /// column corresponds to the state in `contexts[i]`, this method computes
+  /// into the i-th column of `tau` the generalized forces that must be applied
+  /// to attain those accelerations. See CalcInverseDynamics() for details.
+  ///
+  /// @param[in] external_forces
+  ///   Either empty, meaning that no forces are applied, or a vector of N
+  ///   pointers where `external_forces[i]` (which may be nullptr to indicate
+  ///   no applied forces) are the forces applied on the i-th instance.
+  /// @param[out] A_WB_arrays
+  ///   Scratch storage for the spatial accelerations of each instance. On
+  ///   output, `(*A_WB_arrays)[i]` stores the spatial acceleration of each
+  ///   body for the i-th instance, ordered by BodyNodeIndex. See
+  ///   CalcInverseDynamics() for details. It is resized if needed.
+  /// @param[out] F_BMo_W_arrays
+  ///   Scratch storage for the mobilizer reaction forces of each instance.
+  ///   On output, `(*F_BMo_W_arrays)[i]` stores the spatial force `F_BMo_W`
+  ///   of each body for the i-th instance, ordered by BodyNodeIndex. See
+  ///   CalcInverseDynamics() for details. It is resized if needed.
+  /// @param[out] tau
+  ///   On output, a `num_velocities() x N` matrix of generalized forces. It
+  ///   is resized if needed.
+  ///
+  /// @note Callers that evaluate batches of the same size repeatedly can
+  /// reuse the same `A_WB_arrays`, `F_BMo_W_arrays` and `tau` across calls,
+  /// in which case no dynamic memory allocation is performed.
+  ///
+  /// @pre `pcs[i]` and `vcs[i]` are in sync with `contexts[i]`.
+  /// @throws std::exception if the batch arguments have inconsistent sizes,
+  /// if any context or cache is nullptr or if any output is nullptr.
+  void CalcInverseDynamicsBatch(
+      const std::vector<const systems::Context<T>*>& contexts,
+      const std::vector<const PositionKinematicsCache<T>*>& pcs,
+      const std::vector<const VelocityKinematicsCache<T>*>& vcs,
+      const MatrixX<T>& known_vdot,
+      const std::vector<const MultibodyForces<T>*>& external_forces,
+      std::vector<std::vector<SpatialAcceleration<T>>>* A_WB_arrays,
+      std::vector<std::vector<SpatialForce<T>>>* F_BMo_W_arrays,
+      MatrixX<T>* tau) const;
+
+  /// @}
+  // Closes "Batched computational methods" Doxygen section.
+
   /// See MultibodyPlant method.
   MatrixX<double> MakeStateSelectorMatrix(
       const std::vector<JointIndex>& user_to_joint_index_map) const;
@@ -1830,6 +2001,28 @@ class MultibodyTree {
     return tree_system_->EvalVelocityKinematics(context);
   }
 
+  /// Evaluates the articulated body inertia cache cached in context. This will
+  /// also force position kinematics to be updated if it hasn't already.
+  /// @param context A Context whose articulated body inertia cache will be
+  ///                updated and returned.
+  /// @return Reference to the ArticulatedBodyInertiaCache of context.
+  const ArticulatedBodyInertiaCache<T>& EvalArticulatedBodyInertiaCache(
+      const systems::Context<T>& context) const {
+    DRAKE_ASSERT(tree_system_ != nullptr);
+    return tree_system_->EvalArticulatedBodyInertiaCache(context);
+  }
+
+  /// Evaluates the LTDL factorization of the mass matrix M(q) cached in
+  /// context. See TreeLtdlFactorization.
+  /// @param context A Context whose mass matrix factorization will be
+  ///                updated and returned.
+  /// @return Reference to the factorization of M(q) for context.
+  const TreeLtdlFactorization<T>& EvalMassMatrixLtdl(
+      const systems::Context<T>& context) const {
+    DRAKE_ASSERT(tree_system_ != nullptr);
+    return tree_system_->EvalMassMatrixLtdl(context);
+  }
+
   /// @name                 State access methods
   /// These methods use information in the MultibodyTree to determine how to
   /// locate the tree's state variables in a given Context or State.
@@ -2126,6 +2319,17 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       EigenPtr<MatrixX<T>> H) const;
 
+  // Implementation for CalcMassMatrix().
+  // It assumes:
+  //  - The position kinematics cache object is already updated to be in sync
+  //    with `context`.
+  //  - H is not nullptr.
+  //  - H has storage for a square matrix of size num_velocities().
+  void DoCalcMassMatrix(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      EigenPtr<MatrixX<T>> H) const;
+
   // Implementation of CalcBiasTerm().
   // It assumes:
   //  - The position kinematics cache object is already updated to be in sync
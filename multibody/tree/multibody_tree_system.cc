@@ -166,7 +166,44 @@ void MultibodyTreeSystem<T>::Finalize() {
       {this->cache_entry_ticket(position_kinematics_cache_index_)});
   H_PB_W_cache_index_ = H_PB_W_cache_entry.cache_index();
 
-  // TODO(sherm1) Allocate articulated body inertia cache.
+  // Allocate articulated body inertia cache.
+  auto& articulated_body_inertia_cache_entry = this->DeclareCacheEntry(
+      std::string("articulated body inertia"),
+      [tree = tree_.get()]() {
+        return AbstractValue::Make(
+            ArticulatedBodyInertiaCache<T>(tree->get_topology()));
+      },
+      [tree = tree_.get()](const systems::ContextBase& context_base,
+                           AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& abi_cache =
+            cache_value->get_mutable_value<ArticulatedBodyInertiaCache<T>>();
+        tree->CalcArticulatedBodyInertiaCache(
+            context, tree->EvalPositionKinematics(context), &abi_cache);
+      },
+      {this->configuration_ticket()});
+  articulated_body_inertia_cache_index_ =
+      articulated_body_inertia_cache_entry.cache_index();
+
+  // Allocate the LTDL factorization of the mass matrix. Its sparsity
+  // structure is computed here, once, from the topology; the calculator only
+  // refactors the numerical values whenever the configuration changes.
+  const TreeLtdlFactorization<T> mass_matrix_ltdl(tree_->get_topology());
+  auto& mass_matrix_ltdl_cache_entry = this->DeclareCacheEntry(
+      std::string("mass matrix LTDL factorization"),
+      [mass_matrix_ltdl]() { return AbstractValue::Make(mass_matrix_ltdl); },
+      [tree = tree_.get()](const systems::ContextBase& context_base,
+                           AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& M_ltdl =
+            cache_value->get_mutable_value<TreeLtdlFactorization<T>>();
+        const int nv = tree->num_velocities();
+        MatrixX<T> M(nv, nv);
+        tree->CalcMassMatrix(context, &M);
+        M_ltdl.Factor(M);
+      },
+      {this->configuration_ticket()});
+  mass_matrix_ltdl_cache_index_ = mass_matrix_ltdl_cache_entry.cache_index();
 
   already_finalized_ = true;
 }
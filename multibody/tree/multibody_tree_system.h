@@ -7,7 +7,9 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
 #include "drake/multibody/tree/velocity_kinematics_cache.h"
 #include "drake/systems/framework/cache_entry.h"
 #include "drake/systems/framework/context.h"
@@ -111,7 +113,25 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
         .template Eval<std::vector<Vector6<T>>>(context);
   }
 
-  // TODO(sherm1) Add ArticulatedBodyInertiaCache.
+  /** Returns a reference to the up to date ArticulatedBodyInertiaCache in the
+  given Context, recalculating it first if necessary. Also if necessary, the
+  PositionKinematicsCache and the across-node Jacobians H_PB_W will be
+  recalculated as well. */
+  const ArticulatedBodyInertiaCache<T>& EvalArticulatedBodyInertiaCache(
+      const systems::Context<T>& context) const {
+    return this->get_cache_entry(articulated_body_inertia_cache_index_)
+        .template Eval<ArticulatedBodyInertiaCache<T>>(context);
+  }
+
+  /** Returns a reference to the up to date LTDL factorization of the mass
+  matrix M(q) in the given Context, refactoring it first if necessary. The
+  sparsity structure of the factorization is computed once, when the model is
+  finalized; only its numerical values depend on the Context. */
+  const TreeLtdlFactorization<T>& EvalMassMatrixLtdl(
+      const systems::Context<T>& context) const {
+    return this->get_cache_entry(mass_matrix_ltdl_cache_index_)
+        .template Eval<TreeLtdlFactorization<T>>(context);
+  }
 
  protected:
   /** @name        Alternate API for derived classes
@@ -184,6 +204,8 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   systems::CacheIndex position_kinematics_cache_index_;
   systems::CacheIndex velocity_kinematics_cache_index_;
   systems::CacheIndex H_PB_W_cache_index_;
+  systems::CacheIndex articulated_body_inertia_cache_index_;
+  systems::CacheIndex mass_matrix_ltdl_cache_index_;
 
   // Used to enforce "finalize once" restriction for protected-API users.
   bool already_finalized_{false};
@@ -957,6 +957,47 @@ class MultibodyTreeTopology {
     return welded_bodies;
   }
 
+  /// Computes the "parent" array λ for the generalized velocities in `this`
+  /// topology, as defined in [Featherstone 2008, §6.5]. For each generalized
+  /// velocity with index `i`, λ(i) is the index of the nearest generalized
+  /// velocity inboard of `i`, or -1 if there is none. That is:
+  ///
+  /// - For all but the first velocity of a mobilizer, λ(i) = i - 1.
+  /// - For the first velocity of a mobilizer, λ(i) is the last velocity of
+  ///   the closest inboard mobilizer with a non-zero number of velocities, or
+  ///   -1 if all mobilizers in the path to the world are welds.
+  ///
+  /// Since velocities are numbered in the order of increasing level in the
+  /// tree, λ(i) < i always. Index j is an ancestor of index i if it is
+  /// reached by repeated application of λ starting at i. The mass matrix M
+  /// of the multibody system has non-zero off-diagonal entries Mᵢⱼ only if
+  /// either i or j is an ancestor of the other; this is the "branch-induced
+  /// sparsity" exploited by internal::TreeLtdlFactorization.
+  ///
+  /// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+  ///                       algorithms. Springer.
+  std::vector<int> CalcVelocityParents() const {
+    DRAKE_DEMAND(is_valid());
+    std::vector<int> parents(num_velocities(), -1);
+    // last_velocity[node] stores the index of the last velocity in the path
+    // from `node` to the world, or -1 if there is none. Since parent nodes
+    // always have a lower index than their children, a single forward scan
+    // visits each parent before its children.
+    std::vector<int> last_velocity(get_num_body_nodes(), -1);
+    for (BodyNodeIndex node_index(1);
+         node_index < get_num_body_nodes(); ++node_index) {
+      const BodyNodeTopology& node = get_body_node(node_index);
+      int parent_velocity = last_velocity[node.parent_body_node];
+      for (int k = 0; k < node.num_mobilizer_velocities; ++k) {
+        const int i = node.mobilizer_velocities_start_in_v + k;
+        parents[i] = parent_velocity;
+        parent_velocity = i;
+      }
+      last_velocity[node_index] = parent_velocity;
+    }
+    return parents;
+  }
+
  private:
   // Returns `true` if there is _any_ mobilizer in the multibody tree
   // connecting the frames with indexes `frame` and `frame2`.
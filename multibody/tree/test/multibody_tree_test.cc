@@ -18,6 +18,7 @@
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
 #include "drake/multibody/tree/weld_mobilizer.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/continuous_state.h"
@@ -1140,6 +1141,214 @@ TEST_F(KukaIiwaModelTests, CalcRelativeFrameGeometricJacobian) {
       std::exception, ".*'Jw_V_ABp_E->cols\\(\\) == num_columns'.*");
 }
 
+// Verifies that the batched kinematics and inverse dynamics methods reproduce
+// the results of their single-context counterparts, instance by instance.
+TEST_F(KukaIiwaModelTests, BatchedKinematicsAndInverseDynamics) {
+  const int nv = tree().num_velocities();
+  const int kBatchSize = 4;
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+
+  VectorX<double> q0, v0;
+  GetArbitraryNonZeroConfiguration(&q0, &v0);
+
+  std::vector<std::unique_ptr<Context<double>>> contexts;
+  std::vector<std::unique_ptr<PositionKinematicsCache<double>>> pcs;
+  std::vector<std::unique_ptr<VelocityKinematicsCache<double>>> vcs;
+  std::vector<const Context<double>*> context_ptrs;
+  std::vector<PositionKinematicsCache<double>*> pc_ptrs;
+  std::vector<const PositionKinematicsCache<double>*> const_pc_ptrs;
+  std::vector<VelocityKinematicsCache<double>*> vc_ptrs;
+  std::vector<const VelocityKinematicsCache<double>*> const_vc_ptrs;
+  MatrixX<double> vdot(nv, kBatchSize);
+  for (int i = 0; i < kBatchSize; ++i) {
+    contexts.push_back(system_->CreateDefaultContext());
+    const VectorX<double> q = q0 * (1.0 + 0.3 * i);
+    const VectorX<double> v = v0 * (1.0 - 0.2 * i);
+    for (int j = 0; j < nv; ++j) {
+      joints_[j]->set_angle(contexts.back().get(), q[j]);
+      joints_[j]->set_angular_rate(contexts.back().get(), v[j]);
+    }
+    vdot.col(i) = VectorX<double>::LinSpaced(nv, -1.0, 1.0 + i);
+    pcs.push_back(std::make_unique<PositionKinematicsCache<double>>(
+        tree().get_topology()));
+    vcs.push_back(std::make_unique<VelocityKinematicsCache<double>>(
+        tree().get_topology()));
+    context_ptrs.push_back(contexts.back().get());
+    pc_ptrs.push_back(pcs.back().get());
+    const_pc_ptrs.push_back(pcs.back().get());
+    vc_ptrs.push_back(vcs.back().get());
+    const_vc_ptrs.push_back(vcs.back().get());
+  }
+
+  // Applied forces on one of the instances only.
+  MultibodyForces<double> forces(tree());
+  forces.mutable_generalized_forces() = VectorX<double>::Constant(nv, 0.5);
+  forces.mutable_body_forces()[end_effector_link_->node_index()] =
+      SpatialForce<double>(Vector3d(0.1, 0.2, 0.3), Vector3d(1.0, 2.0, 3.0));
+  const std::vector<const MultibodyForces<double>*> forces_ptrs = {
+      nullptr, &forces, nullptr, nullptr};
+
+  tree().CalcPositionKinematicsCacheBatch(context_ptrs, pc_ptrs);
+  tree().CalcVelocityKinematicsCacheBatch(context_ptrs, const_pc_ptrs,
+                                          vc_ptrs);
+  std::vector<std::vector<SpatialAcceleration<double>>> A_WB_arrays;
+  std::vector<std::vector<SpatialForce<double>>> F_BMo_W_arrays;
+  MatrixX<double> tau_batch;
+  tree().CalcInverseDynamicsBatch(context_ptrs, const_pc_ptrs, const_vc_ptrs,
+                                  vdot, forces_ptrs, &A_WB_arrays,
+                                  &F_BMo_W_arrays, &tau_batch);
+  ASSERT_EQ(tau_batch.rows(), nv);
+  ASSERT_EQ(tau_batch.cols(), kBatchSize);
+  ASSERT_EQ(static_cast<int>(A_WB_arrays.size()), kBatchSize);
+  ASSERT_EQ(static_cast<int>(F_BMo_W_arrays.size()), kBatchSize);
+
+  // Reusing the scratch storage gives the same results.
+  MatrixX<double> tau_batch_again;
+  tree().CalcInverseDynamicsBatch(context_ptrs, const_pc_ptrs, const_vc_ptrs,
+                                  vdot, forces_ptrs, &A_WB_arrays,
+                                  &F_BMo_W_arrays, &tau_batch_again);
+  EXPECT_TRUE(CompareMatrices(tau_batch_again, tau_batch, 0));
+
+  for (int i = 0; i < kBatchSize; ++i) {
+    const Context<double>& context = *contexts[i];
+    const PositionKinematicsCache<double>& pc =
+        tree().EvalPositionKinematics(context);
+    const VelocityKinematicsCache<double>& vc =
+        tree().EvalVelocityKinematics(context);
+    for (BodyIndex body_index(0); body_index < tree().num_bodies();
+         ++body_index) {
+      const BodyNodeIndex node_index =
+          tree().get_body(body_index).node_index();
+      EXPECT_TRUE(pcs[i]->get_X_WB(node_index).IsExactlyEqualTo(
+          pc.get_X_WB(node_index)));
+      EXPECT_EQ(vcs[i]->get_V_WB(node_index).get_coeffs(),
+                vc.get_V_WB(node_index).get_coeffs());
+    }
+    const VectorX<double> tau = tree().CalcInverseDynamics(
+        context, vdot.col(i),
+        i == 1 ? forces : MultibodyForces<double>(tree()));
+    EXPECT_TRUE(CompareMatrices(tau_batch.col(i), tau, kTolerance,
+                                MatrixCompareType::relative));
+  }
+
+  // Inconsistent batch sizes are rejected.
+  pc_ptrs.pop_back();
+  EXPECT_THROW(tree().CalcPositionKinematicsCacheBatch(context_ptrs, pc_ptrs),
+               std::exception);
+}
+
+// Verifies that the generalized accelerations computed with the O(n)
+// articulated body algorithm match those obtained by solving the dense system
+// M(q)v̇ = -tau(q, v, 0), with tau computed with inverse dynamics.
+TEST_F(KukaIiwaModelTests, ArticulatedBodyAlgorithmForwardDynamics) {
+  const int nv = tree().num_velocities();
+  const double kTolerance = 1.0e-12;
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+  for (int j = 0; j < nv; ++j) {
+    joints_[j]->set_angle(context_.get(), q[j]);
+    joints_[j]->set_angular_rate(context_.get(), v[j]);
+  }
+
+  const PositionKinematicsCache<double>& pc =
+      tree().EvalPositionKinematics(*context_);
+  const VelocityKinematicsCache<double>& vc =
+      tree().EvalVelocityKinematics(*context_);
+
+  // Gravity, plus arbitrary applied generalized and spatial forces.
+  MultibodyForces<double> forces(tree());
+  tree().CalcForceElementsContribution(*context_, pc, vc, &forces);
+  forces.mutable_generalized_forces() +=
+      VectorX<double>::LinSpaced(nv, -2.0, 3.0);
+  forces.mutable_body_forces()[end_effector_link_->node_index()] +=
+      SpatialForce<double>(Vector3d(0.1, -0.2, 0.3), Vector3d(1.0, 2.0, -3.0));
+
+  // Expected accelerations from the mass matrix.
+  MatrixX<double> M(nv, nv);
+  tree().CalcMassMatrixViaInverseDynamics(*context_, &M);
+  const VectorX<double> tau =
+      tree().CalcInverseDynamics(*context_, VectorX<double>::Zero(nv), forces);
+  const VectorX<double> vdot_expected = M.ldlt().solve(-tau);
+
+  const ArticulatedBodyInertiaCache<double>& abc =
+      tree().EvalArticulatedBodyInertiaCache(*context_);
+  ArticulatedBodyForceCache<double> aba_force_cache(tree().get_topology());
+  tree().CalcArticulatedBodyForceCache(
+      *context_, pc, vc, abc, forces, &aba_force_cache);
+  std::vector<SpatialAcceleration<double>> A_WB_array(tree().num_bodies());
+  VectorX<double> vdot(nv);
+  tree().CalcArticulatedBodyAccelerations(
+      *context_, pc, abc, aba_force_cache, &A_WB_array, &vdot);
+  EXPECT_TRUE(CompareMatrices(vdot, vdot_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  // The body spatial accelerations are consistent with vdot.
+  std::vector<SpatialAcceleration<double>> A_WB_expected(tree().num_bodies());
+  tree().CalcSpatialAccelerationsFromVdot(
+      *context_, pc, vc, vdot, &A_WB_expected);
+  for (BodyNodeIndex node_index(0); node_index < tree().num_bodies();
+       ++node_index) {
+    EXPECT_TRUE(CompareMatrices(A_WB_array[node_index].get_coeffs(),
+                                A_WB_expected[node_index].get_coeffs(),
+                                kTolerance, MatrixCompareType::relative));
+  }
+
+  // Output arrays of the wrong size are rejected.
+  VectorX<double> vdot_wrong_size(nv + 1);
+  EXPECT_THROW(tree().CalcArticulatedBodyAccelerations(
+      *context_, pc, abc, aba_force_cache, &A_WB_array, &vdot_wrong_size),
+      std::exception);
+}
+
+TEST_F(KukaIiwaModelTests, CompositeRigidBodyMassMatrix) {
+  const int nv = tree().num_velocities();
+  const double kTolerance = 1.0e-13;
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+  for (int j = 0; j < nv; ++j) {
+    joints_[j]->set_angle(context_.get(), q[j]);
+  }
+
+  MatrixX<double> M_expected(nv, nv);
+  tree().CalcMassMatrixViaInverseDynamics(*context_, &M_expected);
+  MatrixX<double> M(nv, nv);
+  tree().CalcMassMatrix(*context_, &M);
+  EXPECT_TRUE(CompareMatrices(M, M_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  // The arm is a serial chain and therefore each velocity is the parent of
+  // the next one.
+  const std::vector<int> parents =
+      tree().get_topology().CalcVelocityParents();
+  ASSERT_EQ(static_cast<int>(parents.size()), nv);
+  for (int i = 0; i < nv; ++i) {
+    EXPECT_EQ(parents[i], i - 1);
+  }
+
+  // Solve with the mass matrix using its LTDL factorization.
+  TreeLtdlFactorization<double> M_ltdl(tree().get_topology());
+  M_ltdl.Factor(M);
+  const VectorX<double> b = VectorX<double>::LinSpaced(nv, -1.0, 2.0);
+  EXPECT_TRUE(CompareMatrices(M_ltdl.Solve(b), M.ldlt().solve(b),
+                              kTolerance, MatrixCompareType::relative));
+
+  // The cached factorization has the same structure and solution.
+  const TreeLtdlFactorization<double>& M_ltdl_cached =
+      tree().EvalMassMatrixLtdl(*context_);
+  EXPECT_EQ(M_ltdl_cached.parents(), parents);
+  EXPECT_TRUE(CompareMatrices(M_ltdl_cached.Solve(b), M_ltdl.Solve(b),
+                              kTolerance, MatrixCompareType::relative));
+
+  // Verify the mass matrix for other scalar types.
+  context_autodiff_->SetTimeStateAndParametersFrom(*context_);
+  MatrixX<AutoDiffXd> M_autodiff(nv, nv);
+  tree_autodiff().CalcMassMatrix(*context_autodiff_, &M_autodiff);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(M_autodiff), M,
+                              kTolerance, MatrixCompareType::relative));
+}
+
 // Fixture to setup a simple MBT model with weld mobilizers. The model is in
 // the x-y plane and is sketched below. See unit test code comments for details.
 //
@@ -0,0 +1,117 @@
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon();
+
+// A tree with two branches off velocity 0, {1, 2} and {3, 4}, plus a second
+// disconnected tree {5, 6}. This is the kind of pattern found in the mass
+// matrix of a robot with two fingers and a free object.
+const std::vector<int> kParents{-1, 0, 1, 0, 3, -1, 5};
+
+// Makes a symmetric positive definite matrix with the sparsity pattern given
+// by `parents`, along with its LTDL factors.
+void MakeMatrixWithTreeSparsity(const std::vector<int>& parents,
+                                MatrixXd* M, MatrixXd* L, VectorXd* D) {
+  const int n = parents.size();
+  *L = MatrixXd::Identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = parents[i]; j >= 0; j = parents[j]) {
+      (*L)(i, j) = 0.1 * (i + 1) - 0.05 * j;
+    }
+  }
+  *D = VectorXd::LinSpaced(n, 1.0, 3.0);
+  *M = L->transpose() * D->asDiagonal() * (*L);
+}
+
+GTEST_TEST(TreeLtdlFactorization, FactorAndSolve) {
+  MatrixXd M, L_expected;
+  VectorXd D_expected;
+  MakeMatrixWithTreeSparsity(kParents, &M, &L_expected, &D_expected);
+
+  // Verify M has the expected sparsity, i.e. no fill-in. For instance, entries
+  // coupling the two branches are zero.
+  EXPECT_EQ(M(2, 4), 0.0);
+  EXPECT_EQ(M(1, 3), 0.0);
+  EXPECT_EQ(M.block(0, 5, 5, 2).norm(), 0.0);
+
+  TreeLtdlFactorization<double> ltdl(kParents);
+  EXPECT_EQ(ltdl.size(), 7);
+  EXPECT_EQ(ltdl.parents(), kParents);
+  EXPECT_FALSE(ltdl.is_factored());
+  ltdl.Factor(M);
+  EXPECT_TRUE(ltdl.is_factored());
+
+  const double kTolerance = 10 * kEpsilon;
+  EXPECT_TRUE(CompareMatrices(ltdl.GetL(), L_expected, kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(ltdl.GetD(), D_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  // Solve with multiple right hand sides.
+  MatrixXd B(7, 2);
+  B.col(0) = VectorXd::LinSpaced(7, -1.0, 1.0);
+  B.col(1) = VectorXd::LinSpaced(7, 2.0, 0.5);
+  const MatrixXd X_expected = M.ldlt().solve(B);
+  EXPECT_TRUE(CompareMatrices(ltdl.Solve(B), X_expected, kTolerance,
+                              MatrixCompareType::relative));
+
+  // Solve in place for a vector.
+  VectorXd x = B.col(0);
+  ltdl.SolveInPlace(&x);
+  EXPECT_TRUE(CompareMatrices(x, X_expected.col(0), kTolerance,
+                              MatrixCompareType::relative));
+}
+
+// Entries outside the sparsity pattern and in the upper triangular part are
+// never read.
+GTEST_TEST(TreeLtdlFactorization, IgnoresEntriesOutsidePattern) {
+  MatrixXd M, L;
+  VectorXd D;
+  MakeMatrixWithTreeSparsity(kParents, &M, &L, &D);
+
+  MatrixXd M_garbage = M;
+  M_garbage(4, 2) = 13.0;
+  M_garbage(0, 6) = -7.0;
+  M_garbage(1, 2) = 5.0;
+
+  TreeLtdlFactorization<double> ltdl(kParents);
+  ltdl.Factor(M_garbage);
+  const VectorXd b = VectorXd::LinSpaced(7, -1.0, 1.0);
+  EXPECT_TRUE(CompareMatrices(ltdl.Solve(b), M.ldlt().solve(b),
+                              10 * kEpsilon, MatrixCompareType::relative));
+}
+
+GTEST_TEST(TreeLtdlFactorization, Errors) {
+  // A parent must have a lower index.
+  EXPECT_THROW(TreeLtdlFactorization<double>({-1, 1}), std::exception);
+  EXPECT_THROW(TreeLtdlFactorization<double>({-1, -2}), std::exception);
+
+  TreeLtdlFactorization<double> ltdl(kParents);
+  VectorXd x = VectorXd::Zero(7);
+  // Solving before factoring.
+  EXPECT_THROW(ltdl.SolveInPlace(&x), std::exception);
+  // Wrong sizes.
+  EXPECT_THROW(ltdl.Factor(MatrixXd::Identity(3, 3)), std::exception);
+  ltdl.Factor(MatrixXd::Identity(7, 7));
+  EXPECT_THROW(ltdl.Solve(VectorXd::Zero(3)), std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,109 @@
+#include "drake/multibody/tree/tree_ltdl_factorization.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <typename T>
+TreeLtdlFactorization<T>::TreeLtdlFactorization(std::vector<int> parents)
+    : parents_(std::move(parents)) {
+  for (int i = 0; i < size(); ++i) {
+    if (parents_[i] < -1 || parents_[i] >= i) {
+      throw std::logic_error(fmt::format(
+          "TreeLtdlFactorization(): parents[{}] = {} is not in [-1, {}).", i,
+          parents_[i], i));
+    }
+  }
+  LD_.resize(size(), size());
+}
+
+template <typename T>
+void TreeLtdlFactorization<T>::Factor(const Eigen::Ref<const MatrixX<T>>& M) {
+  DRAKE_THROW_UNLESS(M.rows() == size() && M.cols() == size());
+  const int n = size();
+  // Only the lower triangular part within the sparsity pattern is used.
+  for (int k = 0; k < n; ++k) {
+    LD_(k, k) = M(k, k);
+    for (int i = parents_[k]; i >= 0; i = parents_[i]) LD_(k, i) = M(k, i);
+  }
+
+  // The LTDL algorithm in Table 6.3 of [Featherstone 2008], with zero-based
+  // indexes. Row k of L is computed from the tip to the base so that the
+  // updates of the rows of its ancestors i only touch entries (i, j) with j an
+  // ancestor of i, i.e. no fill-in is introduced.
+  for (int k = n - 1; k >= 0; --k) {
+    for (int i = parents_[k]; i >= 0; i = parents_[i]) {
+      const T a = LD_(k, i) / LD_(k, k);
+      for (int j = i; j >= 0; j = parents_[j]) {
+        LD_(i, j) -= a * LD_(k, j);
+      }
+      LD_(k, i) = a;
+    }
+  }
+  is_factored_ = true;
+}
+
+template <typename T>
+void TreeLtdlFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> x) const {
+  DRAKE_THROW_UNLESS(is_factored());
+  DRAKE_THROW_UNLESS(x != nullptr);
+  DRAKE_THROW_UNLESS(x->rows() == size());
+  const int n = size();
+  // Given M = Lᵀ D L, we solve M x = b in three steps.
+  // 1. Solve Lᵀ y = b, back substitution from the tip to the base.
+  for (int i = n - 1; i >= 0; --i) {
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      x->row(j) -= LD_(i, j) * x->row(i);
+    }
+  }
+  // 2. Solve D z = y.
+  for (int i = 0; i < n; ++i) {
+    x->row(i) /= LD_(i, i);
+  }
+  // 3. Solve L x = z, forward substitution from the base to the tip.
+  for (int i = 0; i < n; ++i) {
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      x->row(i) -= LD_(i, j) * x->row(j);
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> TreeLtdlFactorization<T>::Solve(
+    const Eigen::Ref<const MatrixX<T>>& b) const {
+  DRAKE_THROW_UNLESS(b.rows() == size());
+  MatrixX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+template <typename T>
+MatrixX<T> TreeLtdlFactorization<T>::GetL() const {
+  DRAKE_THROW_UNLESS(is_factored());
+  const int n = size();
+  MatrixX<T> L = MatrixX<T>::Identity(n, n);
+  for (int k = 0; k < n; ++k) {
+    for (int i = parents_[k]; i >= 0; i = parents_[i]) L(k, i) = LD_(k, i);
+  }
+  return L;
+}
+
+template <typename T>
+VectorX<T> TreeLtdlFactorization<T>::GetD() const {
+  DRAKE_THROW_UNLESS(is_factored());
+  return LD_.diagonal();
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::internal::TreeLtdlFactorization)
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/multibody_tree_topology.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/// This class computes the LTDL factorization `M = Lᵀ D L` of a symmetric
+/// positive definite matrix M with the branch-induced sparsity pattern of a
+/// multibody tree, as described in [Featherstone 2005] and
+/// [Featherstone 2008, §6.5]. L is unit lower triangular and D is diagonal.
+///
+/// The sparsity pattern is described by a "parent" array λ, see
+/// MultibodyTreeTopology::CalcVelocityParents(), such that the entry Mᵢⱼ, with
+/// i > j, is non-zero only if j is an ancestor of i. The key property of the
+/// LTDL factorization (as opposed to the more common LDLᵀ) is that it does not
+/// introduce any fill-in: L has the same sparsity pattern as the lower
+/// triangular part of M. Therefore, the cost of the factorization is O(n d²)
+/// and the cost of a solve is O(n d), with n the size of M and d the depth of
+/// the tree (measured in number of velocities). This is in contrast to the
+/// O(n³) and O(n²) costs of a dense factorization. For models with several
+/// disconnected subtrees, like a robot manipulating a number of free
+/// objects, M is block diagonal and d is much smaller than n.
+///
+/// Only the entries of M in its lower triangular part and within the sparsity
+/// pattern are read. All other entries are ignored.
+///
+/// - [Featherstone 2005] Featherstone, R., 2005. Efficient factorization of the
+///   joint-space inertia matrix for branched kinematic trees. The
+///   International Journal of Robotics Research, 24(6), pp. 487-500.
+/// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+///   algorithms. Springer.
+///
+/// @tparam T The scalar type. Must be a valid Eigen scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+/// - symbolic::Expression
+///
+/// They are already available to link against in the containing library.
+template <typename T>
+class TreeLtdlFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TreeLtdlFactorization)
+
+  /// Constructs a factorization object for matrices with the sparsity pattern
+  /// described by the parent array `parents`, see the class's documentation.
+  /// No factorization is performed until Factor() is called.
+  /// @throws std::exception if `parents[i]` is not in [-1, i) for each i.
+  explicit TreeLtdlFactorization(std::vector<int> parents);
+
+  /// Constructs a factorization object for the mass matrix of a model with
+  /// the given `topology`. See MultibodyTreeTopology::CalcVelocityParents().
+  explicit TreeLtdlFactorization(const MultibodyTreeTopology& topology)
+      : TreeLtdlFactorization(topology.CalcVelocityParents()) {}
+
+  /// The size n of the n x n matrices factorized by `this` object.
+  int size() const { return static_cast<int>(parents_.size()); }
+
+  /// The parent array λ describing the sparsity pattern.
+  const std::vector<int>& parents() const { return parents_; }
+
+  /// Computes the factorization of M. M must be symmetric positive definite
+  /// and have the sparsity pattern described by parents().
+  /// @throws std::exception if M is not of size size() x size().
+  void Factor(const Eigen::Ref<const MatrixX<T>>& M);
+
+  /// Returns `true` if Factor() was called at least once.
+  bool is_factored() const { return is_factored_; }
+
+  /// Overwrites `x` with the solution of M x = b, where M is the matrix last
+  /// passed to Factor() and b is the value of `x` on input. `x` can have any
+  /// number of columns.
+  /// @throws std::exception if is_factored() is `false` or x is nullptr or
+  /// does not have size() rows.
+  void SolveInPlace(EigenPtr<MatrixX<T>> x) const;
+
+  /// Returns the solution of M x = b, where M is the matrix last passed to
+  /// Factor().
+  /// @throws std::exception if is_factored() is `false` or b does not have
+  /// size() rows.
+  MatrixX<T> Solve(const Eigen::Ref<const MatrixX<T>>& b) const;
+
+  /// Returns the unit lower triangular factor L, as a dense matrix.
+  /// @throws std::exception if is_factored() is `false`.
+  MatrixX<T> GetL() const;
+
+  /// Returns the diagonal of the factor D.
+  /// @throws std::exception if is_factored() is `false`.
+  VectorX<T> GetD() const;
+
+ private:
+  std::vector<int> parents_;
+  // Dense n x n storage for the factorization, computed in place. Following
+  // [Featherstone 2005], the diagonal stores D and the strictly lower
+  // triangular part stores L. Only entries within the sparsity pattern are
+  // meaningful.
+  MatrixX<T> LD_;
+  bool is_factored_{false};
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::internal::TreeLtdlFactorization)
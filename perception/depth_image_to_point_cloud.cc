@@ -1,13 +1,14 @@
 #include "drake/perception/depth_image_to_point_cloud.h"
 
+#include <algorithm>
 #include <limits>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
 
 using Eigen::Isometry3f;
-using Eigen::Matrix3Xf;
 using Eigen::Vector3f;
 using drake::AbstractValue;
 using drake::Value;
@@ -44,61 +45,165 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
-// TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
-// cloud output? (This would require adding support for colored point clouds,
-// because current implementation assume that an RGB image will still line up).
+// Returns the coordinates, at unit depth, of the rays through the centers of
+// `size` pixel columns (or rows) of a camera with the given center and focal
+// length (in pixels) along that axis.
+Eigen::VectorXf MakeRays(int size, double center, double focal) {
+  const float c = center;
+  const float f_inv = 1.f / focal;
+  Eigen::VectorXf rays(size);
+  for (int i = 0; i < size; ++i) {
+    rays[i] = (i - c) * f_inv;
+  }
+  return rays;
+}
+
+// Converts the row of pixels `depth_row` (and their colors `rgba_row`, unless
+// null) into points written from `xyz` (and colors written from `rgb`), and
+// returns the number of points written. The point of the pixel at column u and
+// depth z is z (ray_x[u] R_PC_x + row_offset) + p_PC; see DoConvert().
+template <PixelType pixel_type, bool kDropInvalidPoints>
+int ConvertRow(const typename ImageTraits<pixel_type>::ChannelType* depth_row,
+               const uint8_t* rgba_row, int width, const float* ray_x,
+               float scale, const Vector3f& R_PC_x, const Vector3f& row_offset,
+               const Vector3f& p_PC, float* xyz, uint8_t* rgb) {
+  using Traits = ImageTraits<pixel_type>;
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  // Copies everything to scalars, so that the loop only reads the image.
+  const float r0 = R_PC_x[0], r1 = R_PC_x[1], r2 = R_PC_x[2];
+  const float o0 = row_offset[0], o1 = row_offset[1], o2 = row_offset[2];
+  const float t0 = p_PC[0], t1 = p_PC[1], t2 = p_PC[2];
+  int num_points = 0;
+  for (int u = 0; u < width; ++u) {
+    const auto depth = depth_row[u];
+    const bool is_in_range =
+        (depth != Traits::kTooClose) && (depth != Traits::kTooFar);
+    // N.B. NaN depths are in range, and are converted to NaN points.
+    if (kDropInvalidPoints && !(is_in_range && depth == depth)) {
+      continue;
+    }
+    const float z = scale * depth;
+    const float x = ray_x[u];
+    float* const point = xyz + 3 * num_points;
+    point[0] = is_in_range ? z * (x * r0 + o0) + t0 : kInf;
+    point[1] = is_in_range ? z * (x * r1 + o1) + t1 : kInf;
+    point[2] = is_in_range ? z * (x * r2 + o2) + t2 : kInf;
+    if (kDropInvalidPoints && rgb != nullptr) {
+      std::copy(rgba_row + 4 * u, rgba_row + 4 * u + 3, rgb + 3 * num_points);
+    }
+    ++num_points;
+  }
+  if (!kDropInvalidPoints && rgb != nullptr) {
+    for (int u = 0; u < width; ++u) {
+      std::copy(rgba_row + 4 * u, rgba_row + 4 * u + 3, rgb + 3 * u);
+    }
+  }
+  return num_points;
+}
+
+// Returns the number of pixels in the rows of `depth_image` from `first_row`
+// on that ConvertRow() keeps when dropping invalid points.
+template <PixelType pixel_type>
+int CountValidPixels(const Image<pixel_type>& depth_image, int first_row) {
+  using Traits = ImageTraits<pixel_type>;
+  const int width = depth_image.width();
+  int count = 0;
+  for (int v = first_row; v < depth_image.height() && width > 0; ++v) {
+    const auto* const depth_row = depth_image.at(0, v);
+    for (int u = 0; u < width; ++u) {
+      const auto depth = depth_row[u];
+      // N.B. `&` rather than `&&`, so that the loop does not branch.
+      count += (depth != Traits::kTooClose) & (depth != Traits::kTooFar) &
+               (depth == depth);
+    }
+  }
+  return count;
+}
+
+// The rays may be precomputed by the caller (`ray_x` and `ray_y`, which may
+// be null); they are only recomputed here if they do not match the size of the
+// depth image.
 template <PixelType pixel_type>
 void DoConvert(const optional<pc_flags::BaseFieldT>& exact_base_fields,
-               const CameraInfo& camera_info,
+               const CameraInfo& camera_info, const Eigen::VectorXf* ray_x,
+               const Eigen::VectorXf* ray_y,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
-               PointCloud* output) {
+               const bool drop_invalid_points, PointCloud* output) {
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
 
+  const int height = depth_image.height();
+  const int width = depth_image.width();
+  Eigen::VectorXf ray_x_storage;
+  if (ray_x == nullptr || ray_x->size() != width) {
+    ray_x_storage =
+        MakeRays(width, camera_info.center_x(), camera_info.focal_x());
+    ray_x = &ray_x_storage;
+  }
+  Eigen::VectorXf ray_y_storage;
+  if (ray_y == nullptr || ray_y->size() != height) {
+    ray_y_storage =
+        MakeRays(height, camera_info.center_y(), camera_info.focal_y());
+    ray_y = &ray_y_storage;
+  }
+
   // Reset the output size, if necessary.  We can leave the memory
-  // uninitialized iff we are going to fill it in below.
-  if (output->size() != depth_image.size()) {
-    const bool skip_initialize = (output->fields().base_fields() == kXYZs);
+  // uninitialized iff we are going to fill it in below.  When dropping the
+  // invalid points, their number is not known up front; the output keeps its
+  // size while the rows still fit in it, and is resized (at most) once: grown
+  // to the exact size needed once a row might not fit, or else shrunk to the
+  // number of points at the end.  Converting similar frames into the same
+  // cloud thus mostly keeps its storage.
+  const bool skip_initialize = (output->fields().base_fields() == kXYZs);
+  if (!drop_invalid_points && output->size() != depth_image.size()) {
     output->resize(depth_image.size(), skip_initialize);
   }
-  Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
-  optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
-  if (color_image) {
-    output_rgb = output->mutable_rgbs();
-  }
+  bool is_size_known = !drop_invalid_points;
+  float* output_xyz = output->mutable_xyzs().data();
+  uint8_t* output_rgb = color_image ? output->mutable_rgbs().data() : nullptr;
 
-  const int height = depth_image.height();
-  const int width = depth_image.width();
-  const float cx = camera_info.center_x();
-  const float cy = camera_info.center_y();
-  const float fx_inv = 1.f / camera_info.focal_x();
-  const float fy_inv = 1.f / camera_info.focal_y();
+  // The point of pixel (u, v) at depth z is p_PC + z R_PC [ray_x(u), ray_y(v),
+  // 1], which is computed as z (ray_x(u) R_PC.col(0) + row_offset) + p_PC with
+  // the row offset R_PC [0, ray_y(v), 1] hoisted out of the loop over u.
   const Isometry3f X_PC = camera_pose
                               ? camera_pose->GetAsIsometry3().cast<float>()
                               : Isometry3f::Identity();
+  const Vector3f R_PC_x = X_PC.linear().col(0);
+  const Vector3f p_PC = X_PC.translation();
 
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
+  int num_points = 0;
+  for (int v = 0; v < height && width > 0; ++v) {
+    if (!is_size_known && num_points + width > output->size()) {
+      const int size = num_points + CountValidPixels(depth_image, v);
+      if (size > output->size()) {
+        output->resize(size, skip_initialize);
+        output_xyz = output->mutable_xyzs().data();
+        output_rgb = color_image ? output->mutable_rgbs().data() : nullptr;
       }
+      is_size_known = true;
     }
+    const Vector3f row_offset =
+        X_PC.linear().col(1) * (*ray_y)[v] + X_PC.linear().col(2);
+    const auto* const depth_row = depth_image.at(0, v);
+    const uint8_t* const rgba_row =
+        color_image ? color_image->at(0, v) : nullptr;
+    float* const xyz = output_xyz + 3 * num_points;
+    uint8_t* const rgb = output_rgb ? output_rgb + 3 * num_points : nullptr;
+    num_points +=
+        drop_invalid_points
+            ? ConvertRow<pixel_type, true>(depth_row, rgba_row, width,
+                                           ray_x->data(), scale, R_PC_x,
+                                           row_offset, p_PC, xyz, rgb)
+            : ConvertRow<pixel_type, false>(depth_row, rgba_row, width,
+                                            ray_x->data(), scale, R_PC_x,
+                                            row_offset, p_PC, xyz, rgb);
+  }
+  if (num_points != output->size()) {
+    DRAKE_DEMAND(num_points < output->size());
+    output->resize(num_points);
   }
 }
 
@@ -106,11 +211,16 @@ void DoConvert(const optional<pc_flags::BaseFieldT>& exact_base_fields,
 
 DepthImageToPointCloud::DepthImageToPointCloud(
     const CameraInfo& camera_info, PixelType depth_pixel_type, float scale,
-    const pc_flags::BaseFieldT fields)
+    const pc_flags::BaseFieldT fields, bool drop_invalid_points)
     : camera_info_(camera_info),
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
-      fields_(fields) {
+      fields_(fields),
+      drop_invalid_points_(drop_invalid_points),
+      ray_x_(MakeRays(camera_info.width(), camera_info.center_x(),
+                      camera_info.focal_x())),
+      ray_y_(MakeRays(camera_info.height(), camera_info.center_y(),
+                      camera_info.focal_y())) {
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -140,10 +250,12 @@ void DepthImageToPointCloud::Convert(
     const optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth32F& depth_image,
     const optional<systems::sensors::ImageRgba8U>& color_image,
-    const optional<float>& scale, PointCloud* output) {
-  DoConvert(nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+    const optional<float>& scale, PointCloud* output,
+    bool drop_invalid_points) {
+  DoConvert(nullopt, camera_info, nullptr, nullptr,
+            camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            drop_invalid_points, output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -151,10 +263,12 @@ void DepthImageToPointCloud::Convert(
     const optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth16U& depth_image,
     const optional<systems::sensors::ImageRgba8U>& color_image,
-    const optional<float>& scale, PointCloud* output) {
-  DoConvert(nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+    const optional<float>& scale, PointCloud* output,
+    bool drop_invalid_points) {
+  DoConvert(nullopt, camera_info, nullptr, nullptr,
+            camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            drop_invalid_points, output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -166,8 +280,9 @@ void DepthImageToPointCloud::CalcOutput32F(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  DoConvert(fields_, camera_info_, &ray_x_, &ray_y_, pose_or_null,
+            *depth_image, color_image_or_null, scale_, drop_invalid_points_,
+            output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -179,8 +294,9 @@ void DepthImageToPointCloud::CalcOutput16U(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  DoConvert(fields_, camera_info_, &ray_x_, &ray_y_, pose_or_null,
+            *depth_image, color_image_or_null, scale_, drop_invalid_points_,
+            output);
 }
 
 }  // namespace perception
@@ -38,7 +38,9 @@ namespace perception {
 /// If a pixel is NaN, the converted point will be (NaN, NaN, NaN).  If a pixel
 /// is kTooClose or kTooFar (as defined by ImageTraits), the converted point
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
-/// the Point Cloud Library (PCL).
+/// the Point Cloud Library (PCL). Alternatively, these invalid points can be
+/// dropped, in which case the point cloud only holds the valid points (and
+/// their colors), in the order of their pixels.
 ///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
@@ -54,11 +56,15 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] drop_invalid_points If true, the pixels whose depth is NaN,
+  ///   kTooClose or kTooFar are left out of the point cloud, instead of being
+  ///   converted to NaN or +Inf points.
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      bool drop_invalid_points = false);
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -90,28 +96,32 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// in the class overview and constructor.
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
-  /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// The `cloud` will be resized to match the size of the depth image (or the
+  /// number of valid pixels, if `drop_invalid_points` is true).  The `cloud`
+  /// must have the XYZ channel enabled.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth32F& depth_image,
       const optional<systems::sensors::ImageRgba8U>& color_image,
-      const optional<float>& scale, PointCloud* cloud);
+      const optional<float>& scale, PointCloud* cloud,
+      bool drop_invalid_points = false);
 
   /// Converts a depth image to a point cloud using direct arguments instead of
   /// System input and output ports.  The semantics are the same as documented
   /// in the class overview and constructor.
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
-  /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// The `cloud` will be resized to match the size of the depth image (or the
+  /// number of valid pixels, if `drop_invalid_points` is true).  The `cloud`
+  /// must have the XYZ channel enabled.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth16U& depth_image,
       const optional<systems::sensors::ImageRgba8U>& color_image,
-      const optional<float>& scale, PointCloud* cloud);
+      const optional<float>& scale, PointCloud* cloud,
+      bool drop_invalid_points = false);
 
  private:
   void CalcOutput16U(const systems::Context<double>&, PointCloud*) const;
@@ -121,6 +131,12 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  const bool drop_invalid_points_;
+
+  // The x and y coordinates, at unit depth, of the rays through the centers of
+  // the pixel columns and rows of camera_info_.
+  const Eigen::VectorXf ray_x_;
+  const Eigen::VectorXf ray_y_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
@@ -0,0 +1,44 @@
+#include "drake/perception/icp_tracker.h"
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+using math::RigidTransformd;
+
+IcpTracker::IcpTracker(const PointCloud& model, const RigidTransformd& X_CM,
+                       double period, const IcpOptions& options)
+    : icp_(model, options) {
+  DRAKE_THROW_UNLESS(period > 0);
+  this->DeclareAbstractInputPort("point_cloud", Value<PointCloud>());
+  this->DeclareAbstractState(AbstractValue::Make<RigidTransformd>(X_CM));
+  this->DeclareAbstractOutputPort("pose", &IcpTracker::CalcPose,
+                                  {this->all_state_ticket()});
+  this->DeclarePeriodicUnrestrictedUpdateEvent(period, 0.,
+                                               &IcpTracker::UpdatePose);
+}
+
+void IcpTracker::SetPose(systems::Context<double>* context,
+                         const RigidTransformd& X_CM) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  context->get_mutable_abstract_state<RigidTransformd>(0) = X_CM;
+}
+
+void IcpTracker::UpdatePose(const systems::Context<double>& context,
+                            systems::State<double>* state) const {
+  const auto& scene = point_cloud_input_port().Eval<PointCloud>(context);
+  const auto& X_CM = context.get_abstract_state<RigidTransformd>(0);
+  // The scene is the input cloud, whose frame is C.
+  const IcpResult result = icp_.Register(scene, X_CM.inverse());
+  state->get_mutable_abstract_state<RigidTransformd>(0) =
+      result.X_MS.inverse();
+}
+
+void IcpTracker::CalcPose(const systems::Context<double>& context,
+                          RigidTransformd* X_CM) const {
+  *X_CM = context.get_abstract_state<RigidTransformd>(0);
+}
+
+}  // namespace perception
+}  // namespace drake
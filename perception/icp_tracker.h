@@ -0,0 +1,85 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/iterative_closest_point.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// Tracks the pose of an object in a sequence of point clouds, e.g. those of
+/// a DepthImageToPointCloud, by registering a model cloud of the object
+/// against each cloud with IterativeClosestPoint. Each registration starts
+/// from the pose estimated for the previous cloud.
+///
+/// @system{ IcpTracker,
+///          @input_port{point_cloud},
+///          @output_port{pose}
+/// }
+///
+/// The input cloud, in some frame C, is registered periodically. The output
+/// is the estimate X_CM of the pose of the model frame M in C, as a
+/// RigidTransformd, and is held in the state between registrations; it
+/// therefore does not depend directly on the input. The cloud of a camera
+/// frame is usually cropped (e.g. with a CropBoxFilter) and downsampled (e.g.
+/// with a VoxelGridFilter) before it is registered.
+///
+/// @ingroup perception_systems
+class IcpTracker final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IcpTracker)
+
+  /// Constructs the tracker.
+  ///
+  /// @param[in] model The cloud of the object, in its frame M.
+  /// @param[in] X_CM The initial estimate of the pose of the object, in the
+  ///   default context.
+  /// @param[in] period The period of the registrations, i.e. the period of
+  ///   the input clouds.
+  /// @param[in] options The parameters of the registrations.
+  /// @throws std::runtime_error if `period` is not positive, or as documented
+  ///   by IterativeClosestPoint.
+  IcpTracker(const PointCloud& model, const math::RigidTransformd& X_CM,
+             double period, const IcpOptions& options = IcpOptions());
+
+  /// Returns the abstract valued input port that expects a PointCloud.
+  const systems::InputPort<double>& point_cloud_input_port() const {
+    return LeafSystem<double>::get_input_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides X_CM as a
+  /// RigidTransformd.
+  const systems::OutputPort<double>& pose_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+  /// Sets the estimate of the pose of the object in @p context, e.g. to
+  /// recover once the object is lost.
+  void SetPose(systems::Context<double>* context,
+               const math::RigidTransformd& X_CM) const;
+
+  /// Returns the registration, and through it the model and the options.
+  const IterativeClosestPoint& icp() const { return icp_; }
+
+ private:
+  // The output only depends on the state. LeafSystem does not infer that from
+  // the output's prerequisites, so say it here.
+  optional<bool> DoHasDirectFeedthrough(int, int) const final {
+    return false;
+  }
+
+  void UpdatePose(const systems::Context<double>& context,
+                  systems::State<double>* state) const;
+
+  void CalcPose(const systems::Context<double>& context,
+                math::RigidTransformd* X_CM) const;
+
+  const IterativeClosestPoint icp_;
+};
+
+}  // namespace perception
+}  // namespace drake
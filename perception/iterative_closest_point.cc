@@ -0,0 +1,159 @@
+#include "drake/perception/iterative_closest_point.h"
+
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+using Eigen::Matrix3Xf;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+namespace {
+
+typedef Eigen::Matrix<double, 6, 6> Matrix6d;
+typedef Eigen::Matrix<double, 6, 1> Vector6d;
+
+// Throws unless `model` and `options` are valid; returns `model`.
+const PointCloud& CheckArguments(const PointCloud& model,
+                                 const IcpOptions& options) {
+  DRAKE_THROW_UNLESS(options.max_iterations >= 1);
+  DRAKE_THROW_UNLESS(options.max_correspondence_distance > 0);
+  DRAKE_THROW_UNLESS(options.convergence_tolerance >= 0);
+  DRAKE_THROW_UNLESS(options.num_threads >= 1);
+  model.RequireFields(options.metric == IcpMetric::kPointToPlane
+                          ? pc_flags::kXYZs | pc_flags::kNormals
+                          : pc_flags::kXYZs);
+  return model;
+}
+
+// Returns the rigid transform of rotation vector δ.head(3) and translation
+// δ.tail(3).
+RigidTransformd Exp(const Vector6d& delta) {
+  const Vector3d w = delta.head<3>();
+  const double angle = w.norm();
+  const RotationMatrixd R =
+      angle > 0 ? RotationMatrixd(Eigen::AngleAxisd(angle, w / angle))
+                : RotationMatrixd();
+  return RigidTransformd(R, delta.tail<3>());
+}
+
+}  // namespace
+
+IterativeClosestPoint::IterativeClosestPoint(const PointCloud& model,
+                                             const IcpOptions& options)
+    : model_(CheckArguments(model, options)),
+      options_(options),
+      tree_(&model_) {
+  tree_.set_num_threads(options.num_threads);
+}
+
+IterativeClosestPoint::~IterativeClosestPoint() = default;
+
+IcpResult IterativeClosestPoint::Register(const PointCloud& scene,
+                                          const RigidTransformd& X_MS) const {
+  scene.RequireFields(pc_flags::kXYZs);
+  const auto scene_xyzs = scene.xyzs();
+  const bool point_to_plane = options_.metric == IcpMetric::kPointToPlane;
+  const double max_squared_distance = options_.max_correspondence_distance *
+                                      options_.max_correspondence_distance;
+
+  // The finite points of the scene, in the scene frame.
+  Matrix3Xf p_SPs(3, scene.size());
+  int num_points = 0;
+  for (int i = 0; i < scene.size(); ++i) {
+    if (scene_xyzs.col(i).array().isFinite().all()) {
+      p_SPs.col(num_points++) = scene_xyzs.col(i);
+    }
+  }
+  p_SPs.conservativeResize(3, num_points);
+
+  IcpResult result;
+  result.X_MS = X_MS;
+  Matrix3Xf p_MPs(3, num_points);
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  const auto model_xyzs = model_.xyzs();
+  const float* const model_normals =
+      point_to_plane ? model_.normals().data() : nullptr;
+  while (result.num_iterations < options_.max_iterations) {
+    ++result.num_iterations;
+    const Eigen::Isometry3f X_MS_float =
+        result.X_MS.GetAsIsometry3().cast<float>();
+    p_MPs.noalias() = X_MS_float.linear() * p_SPs;
+    p_MPs.colwise() += X_MS_float.translation();
+    tree_.FindNearest(p_MPs, 1, &indices, &squared_distances);
+
+    // Accumulates the normal equations H δ = -g of the Gauss-Newton step δ,
+    // for the residuals r(δ) = r + J δ of the scene points moved by Exp(δ).
+    // For a point p, ∂p/∂δ = [-[p]ₓ  I].
+    Matrix6d H = Matrix6d::Zero();
+    Vector6d g = Vector6d::Zero();
+    double sum_squared_errors = 0;
+    int num_correspondences = 0;
+    for (int i = 0; i < num_points; ++i) {
+      const int index = indices(0, i);
+      if (index < 0 || squared_distances(0, i) > max_squared_distance) {
+        continue;
+      }
+      const Vector3d p = p_MPs.col(i).cast<double>();
+      const Vector3d q = model_xyzs.col(index).cast<double>();
+      if (point_to_plane) {
+        const Vector3d n =
+            Eigen::Map<const Eigen::Vector3f>(model_normals + 3 * index)
+                .cast<double>();
+        if (!n.array().isFinite().all()) continue;
+        const double r = n.dot(p - q);
+        Vector6d J;
+        J << p.cross(n), n;
+        H.selfadjointView<Eigen::Lower>().rankUpdate(J);
+        g += r * J;
+        sum_squared_errors += r * r;
+      } else {
+        const Vector3d r = p - q;
+        // Jᵀ J and Jᵀ r for J = [-[p]ₓ  I].
+        Eigen::Matrix<double, 3, 6> J;
+        // clang-format off
+        J <<      0,  p.z(), -p.y(), 1, 0, 0,
+             -p.z(),      0,  p.x(), 0, 1, 0,
+              p.y(), -p.x(),      0, 0, 0, 1;
+        // clang-format on
+        H.noalias() += J.transpose() * J;
+        g.noalias() += J.transpose() * r;
+        sum_squared_errors += r.squaredNorm();
+      }
+      ++num_correspondences;
+    }
+    result.num_correspondences = num_correspondences;
+    result.rms_error =
+        num_correspondences > 0
+            ? std::sqrt(sum_squared_errors / num_correspondences)
+            : std::numeric_limits<double>::quiet_NaN();
+    // Too few correspondences leave the pose undetermined.
+    if (num_correspondences < 6) break;
+
+    // Only the lower triangle of H is read.
+    const Eigen::LDLT<Matrix6d> ldlt(H);
+    if (ldlt.info() != Eigen::Success) break;
+    const Vector6d delta = ldlt.solve(-g);
+    if (!delta.array().isFinite().all()) break;
+    result.X_MS = Exp(delta) * result.X_MS;
+    if (delta.norm() < options_.convergence_tolerance) {
+      result.converged = true;
+      break;
+    }
+  }
+
+  // Keeps the rotation orthonormal despite the products of the iterations.
+  Eigen::Quaterniond quaternion = result.X_MS.rotation().ToQuaternion();
+  quaternion.normalize();
+  result.X_MS.set_rotation(RotationMatrixd(quaternion));
+  return result;
+}
+
+}  // namespace perception
+}  // namespace drake
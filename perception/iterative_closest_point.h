@@ -0,0 +1,108 @@
+#pragma once
+
+#include <limits>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/kd_tree.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// The error minimized by IterativeClosestPoint.
+enum class IcpMetric {
+  /// The squared distances between the scene points and their closest model
+  /// points.
+  kPointToPoint,
+  /// The squared distances between the scene points and the tangent planes of
+  /// their closest model points. This converges in far fewer iterations on
+  /// smooth surfaces, but requires the normals of the model.
+  kPointToPlane,
+};
+
+/// The parameters of IterativeClosestPoint.
+struct IcpOptions {
+  IcpMetric metric{IcpMetric::kPointToPlane};
+
+  /// The largest number of iterations of a registration.
+  int max_iterations{30};
+
+  /// Correspondences farther apart than this distance are ignored, which
+  /// discards the scene points that are not on the model (e.g. the table the
+  /// object lies on).
+  double max_correspondence_distance{std::numeric_limits<double>::infinity()};
+
+  /// The registration has converged once an iteration moves the scene by
+  /// less than this tolerance, measured as the norm of the rotation angle
+  /// (in radians) and translation (in meters) vector.
+  double convergence_tolerance{1e-6};
+
+  /// The number of threads the correspondences are searched for on.
+  int num_threads{1};
+};
+
+/// The outcome of IterativeClosestPoint::Register().
+struct IcpResult {
+  /// The estimated pose of the scene frame S in the model frame M.
+  math::RigidTransformd X_MS;
+
+  /// Whether the convergence tolerance was met within the largest number of
+  /// iterations.
+  bool converged{false};
+
+  /// The number of iterations run.
+  int num_iterations{0};
+
+  /// The number of correspondences, and the root mean square of their errors
+  /// (as measured by the metric), at the last iteration.
+  int num_correspondences{0};
+  double rms_error{std::numeric_limits<double>::quiet_NaN()};
+};
+
+/// Registers point clouds of a scene against a model cloud, i.e. estimates
+/// the pose of the scene that best aligns it with the model, by the
+/// iterative closest point (ICP) algorithm. Each iteration pairs every scene
+/// point with its closest model point, through a KdTree over the model that
+/// is built once for all registrations, and then takes a Gauss-Newton step
+/// on the pose, parameterized by a rotation vector and a translation.
+///
+/// See Rusinkiewicz and Levoy, "Efficient Variants of the ICP Algorithm"
+/// (2001) for the point-to-point and point-to-plane metrics.
+///
+/// As ICP only converges to a local minimum, the initial guess of the pose
+/// must be close enough to the solution; when tracking an object, the pose
+/// of the previous frame is usually a good guess for the next frame.
+class IterativeClosestPoint {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IterativeClosestPoint)
+
+  /// Constructs the registration against @p model, which is copied.
+  /// @throws std::runtime_error if `model` does not have XYZs, or if it does
+  /// not have normals for the point-to-plane metric, or if the options are
+  /// not valid.
+  explicit IterativeClosestPoint(const PointCloud& model,
+                                 const IcpOptions& options = IcpOptions());
+
+  ~IterativeClosestPoint();
+
+  const PointCloud& model() const { return model_; }
+
+  const IcpOptions& options() const { return options_; }
+
+  /// Registers @p scene against the model, starting from the initial guess
+  /// @p X_MS of the pose of the scene in the model frame. The non-finite
+  /// points of the scene are ignored.
+  /// @throws std::runtime_error if `scene` does not have XYZs.
+  IcpResult Register(const PointCloud& scene,
+                     const math::RigidTransformd& X_MS) const;
+
+ private:
+  const PointCloud model_;
+  const IcpOptions options_;
+  // Aliases model_.
+  KdTree tree_;
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,247 @@
+#include "drake/perception/kd_tree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/thread_pool.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3f;
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+// Orders the neighbors by distance, and then by index for determinism.
+bool IsCloser(const KdTree::Neighbor& a, const KdTree::Neighbor& b) {
+  return a.squared_distance < b.squared_distance ||
+         (a.squared_distance == b.squared_distance && a.index < b.index);
+}
+
+// Returns the squared distance from `p` to the box [lower, upper].
+float SquaredDistanceToBox(const Vector3f& p, const Vector3f& lower,
+                           const Vector3f& upper) {
+  return (lower - p).cwiseMax(p - upper).cwiseMax(0.f).squaredNorm();
+}
+
+}  // namespace
+
+KdTree::KdTree(const PointCloud* cloud, int leaf_size)
+    : cloud_(cloud), leaf_size_(leaf_size) {
+  DRAKE_THROW_UNLESS(cloud != nullptr);
+  DRAKE_THROW_UNLESS(leaf_size >= 1);
+  cloud->RequireFields(pc_flags::kXYZs);
+  set_num_threads(1);
+  Rebuild();
+}
+
+KdTree::~KdTree() = default;
+
+void KdTree::Rebuild() {
+  const auto xyzs = cloud_->xyzs();
+  DRAKE_DEMAND(xyzs.outerStride() == 3);
+  xyzs_ = xyzs.data();
+  cloud_size_ = cloud_->size();
+  indices_.clear();
+  nodes_.clear();
+  for (int i = 0; i < cloud_size_; ++i) {
+    if (point(i).array().isFinite().all()) indices_.push_back(i);
+  }
+  if (!indices_.empty()) {
+    Build(0, size());
+  }
+}
+
+void KdTree::Refit() {
+  if (cloud_->size() != cloud_size_) {
+    throw std::runtime_error(
+        "KdTree::Refit(): the cloud was resized since the last Rebuild().");
+  }
+  xyzs_ = cloud_->xyzs().data();
+  if (!nodes_.empty()) {
+    RefitNode(0);
+  }
+}
+
+void KdTree::set_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  // Joins the former threads before creating the new ones.
+  thread_pool_.reset();
+  thread_pool_ = std::make_unique<drake::internal::ThreadPool>(num_threads);
+}
+
+int KdTree::num_threads() const { return thread_pool_->num_threads(); }
+
+int KdTree::Build(int begin, int end) {
+  const int node_index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+  Vector3f lower = Vector3f::Constant(kInf);
+  Vector3f upper = Vector3f::Constant(-kInf);
+  for (int i = begin; i < end; ++i) {
+    lower = lower.cwiseMin(point(indices_[i]));
+    upper = upper.cwiseMax(point(indices_[i]));
+  }
+  nodes_[node_index].lower = lower;
+  nodes_[node_index].upper = upper;
+  nodes_[node_index].begin = begin;
+  nodes_[node_index].end = end;
+  if (end - begin <= leaf_size_) return node_index;
+
+  // Splits at the median along the axis of largest extent.
+  int axis{};
+  (upper - lower).maxCoeff(&axis);
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(indices_.begin() + begin, indices_.begin() + middle,
+                   indices_.begin() + end, [this, axis](int a, int b) {
+                     return xyzs_[3 * a + axis] < xyzs_[3 * b + axis];
+                   });
+  // The children are built before being assigned, as building them may
+  // reallocate nodes_.
+  const int left = Build(begin, middle);
+  const int right = Build(middle, end);
+  nodes_[node_index].left = left;
+  nodes_[node_index].right = right;
+  return node_index;
+}
+
+void KdTree::RefitNode(int node_index) {
+  Node& node = nodes_[node_index];
+  if (node.left < 0) {
+    node.lower.setConstant(kInf);
+    node.upper.setConstant(-kInf);
+    for (int i = node.begin; i < node.end; ++i) {
+      const auto p = point(indices_[i]);
+      if (p.array().isFinite().all()) {
+        node.lower = node.lower.cwiseMin(p);
+        node.upper = node.upper.cwiseMax(p);
+      }
+    }
+    return;
+  }
+  RefitNode(node.left);
+  RefitNode(node.right);
+  node.lower = nodes_[node.left].lower.cwiseMin(nodes_[node.right].lower);
+  node.upper = nodes_[node.left].upper.cwiseMax(nodes_[node.right].upper);
+}
+
+void KdTree::FindNearest(const Vector3f& p, int k,
+                         std::vector<Neighbor>* neighbors) const {
+  DRAKE_THROW_UNLESS(neighbors != nullptr);
+  neighbors->clear();
+  if (nodes_.empty() || k <= 0) return;
+  // `neighbors` is kept as a max-heap until the search is complete.
+  SearchNearest(0, p, k, neighbors);
+  std::sort_heap(neighbors->begin(), neighbors->end(), IsCloser);
+}
+
+void KdTree::FindWithinRadius(const Vector3f& p, float radius,
+                              std::vector<Neighbor>* neighbors) const {
+  DRAKE_THROW_UNLESS(neighbors != nullptr);
+  neighbors->clear();
+  if (nodes_.empty() || !(radius >= 0)) return;
+  SearchWithinRadius(0, p, radius * radius, neighbors);
+  std::sort(neighbors->begin(), neighbors->end(), IsCloser);
+}
+
+void KdTree::FindNearest(const Eigen::Ref<const Matrix3X<float>>& queries,
+                         int k, Eigen::MatrixXi* indices,
+                         Eigen::MatrixXf* squared_distances) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  DRAKE_THROW_UNLESS(squared_distances != nullptr);
+  DRAKE_THROW_UNLESS(k >= 0);
+  indices->setConstant(k, queries.cols(), -1);
+  squared_distances->setConstant(k, queries.cols(), kInf);
+  thread_pool_->ParallelForRanges(queries.cols(), [&](int begin, int end) {
+    std::vector<Neighbor> neighbors;
+    neighbors.reserve(k);
+    for (int j = begin; j < end; ++j) {
+      FindNearest(queries.col(j), k, &neighbors);
+      for (int i = 0; i < static_cast<int>(neighbors.size()); ++i) {
+        (*indices)(i, j) = neighbors[i].index;
+        (*squared_distances)(i, j) = neighbors[i].squared_distance;
+      }
+    }
+  });
+}
+
+void KdTree::FindWithinRadius(
+    const Eigen::Ref<const Matrix3X<float>>& queries, float radius,
+    std::vector<std::vector<Neighbor>>* neighbors) const {
+  DRAKE_THROW_UNLESS(neighbors != nullptr);
+  neighbors->resize(queries.cols());
+  thread_pool_->ParallelForRanges(queries.cols(), [&](int begin, int end) {
+    for (int j = begin; j < end; ++j) {
+      FindWithinRadius(queries.col(j), radius, &(*neighbors)[j]);
+    }
+  });
+}
+
+void KdTree::SearchNearest(int node_index, const Vector3f& p, int k,
+                           std::vector<Neighbor>* heap) const {
+  const Node& node = nodes_[node_index];
+  if (node.left < 0) {
+    for (int i = node.begin; i < node.end; ++i) {
+      const int index = indices_[i];
+      const float squared_distance = (point(index) - p).squaredNorm();
+      // Skips the points that became non-finite since the last Rebuild().
+      if (!(squared_distance < kInf)) continue;
+      const Neighbor neighbor{index, squared_distance};
+      if (static_cast<int>(heap->size()) < k) {
+        heap->push_back(neighbor);
+        std::push_heap(heap->begin(), heap->end(), IsCloser);
+      } else if (IsCloser(neighbor, heap->front())) {
+        std::pop_heap(heap->begin(), heap->end(), IsCloser);
+        heap->back() = neighbor;
+        std::push_heap(heap->begin(), heap->end(), IsCloser);
+      }
+    }
+    return;
+  }
+  // Visits the nearer child first, so as to prune more of the farther one.
+  const Node& left = nodes_[node.left];
+  const Node& right = nodes_[node.right];
+  float near_distance = SquaredDistanceToBox(p, left.lower, left.upper);
+  float far_distance = SquaredDistanceToBox(p, right.lower, right.upper);
+  int near = node.left;
+  int far = node.right;
+  if (far_distance < near_distance) {
+    std::swap(near_distance, far_distance);
+    std::swap(near, far);
+  }
+  if (static_cast<int>(heap->size()) < k ||
+      near_distance <= heap->front().squared_distance) {
+    SearchNearest(near, p, k, heap);
+  }
+  if (static_cast<int>(heap->size()) < k ||
+      far_distance <= heap->front().squared_distance) {
+    SearchNearest(far, p, k, heap);
+  }
+}
+
+void KdTree::SearchWithinRadius(int node_index, const Vector3f& p,
+                                float squared_radius,
+                                std::vector<Neighbor>* neighbors) const {
+  const Node& node = nodes_[node_index];
+  if (SquaredDistanceToBox(p, node.lower, node.upper) > squared_radius) {
+    return;
+  }
+  if (node.left < 0) {
+    for (int i = node.begin; i < node.end; ++i) {
+      const int index = indices_[i];
+      const float squared_distance = (point(index) - p).squaredNorm();
+      if (squared_distance <= squared_radius) {
+        neighbors->push_back({index, squared_distance});
+      }
+    }
+    return;
+  }
+  SearchWithinRadius(node.left, p, squared_radius, neighbors);
+  SearchWithinRadius(node.right, p, squared_radius, neighbors);
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace internal {
+class ThreadPool;
+}  // namespace internal
+
+namespace perception {
+
+/// A k-d tree over the XYZs of a PointCloud, for nearest neighbors and radius
+/// searches.
+///
+/// The tree does not copy the points: it holds a permutation of their indices
+/// and a bounding box per node, and reads the coordinates from the cloud,
+/// which must therefore outlive the tree. Points with a non-finite coordinate
+/// (see PointCloud::IsInvalidValue()) are not indexed.
+///
+/// When the cloud is modified, the tree must be brought up to date before it
+/// is searched again, in one of two ways:
+///
+/// - Refit(), if the points were moved in place (the cloud was not resized).
+///   This only recomputes the bounding boxes of the nodes, keeping the
+///   partition of the points, and is several times cheaper than a rebuild.
+///   The searches remain exact, but slow down as the partition drifts from
+///   that of a fresh tree, e.g. as the cloud is transformed by large motions.
+/// - Rebuild(), in any other case. This reuses the memory of the former tree.
+///
+/// Searches are const and may run concurrently. The batched searches, which
+/// run many searches at once, are spread over the threads set by
+/// set_num_threads().
+class KdTree {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(KdTree)
+
+  /// A point found by a search.
+  struct Neighbor {
+    /// The index of the point in the cloud.
+    int index{};
+    /// The squared distance of the point to the query.
+    float squared_distance{};
+  };
+
+  /// Builds the tree over the finite XYZs of @p cloud, aliased.
+  /// @param leaf_size The largest number of points in a leaf of the tree.
+  /// @throws std::runtime_error if `cloud` does not have XYZs, or if
+  /// `leaf_size` is not positive.
+  explicit KdTree(const PointCloud* cloud, int leaf_size = 16);
+
+  ~KdTree();
+
+  /// Returns the number of points indexed by the tree, i.e. the number of
+  /// finite points of the cloud at the last Rebuild().
+  int size() const { return static_cast<int>(indices_.size()); }
+
+  /// Rebuilds the tree over the current XYZs of the cloud.
+  void Rebuild();
+
+  /// Updates the tree for the points of the cloud having been moved in place.
+  /// The points that became non-finite are no longer found; the points that
+  /// became finite are not found until the next Rebuild().
+  /// @throws std::runtime_error if the cloud was resized since the last
+  /// Rebuild().
+  void Refit();
+
+  /// Sets the number of threads, including the calling thread, that the
+  /// batched searches are spread over. The default is 1.
+  /// @throws std::runtime_error if `num_threads` is not positive.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads used by the batched searches.
+  int num_threads() const;
+
+  /// Finds the (up to) @p k points nearest to @p p, by increasing distance.
+  void FindNearest(const Eigen::Vector3f& p, int k,
+                   std::vector<Neighbor>* neighbors) const;
+
+  /// Finds the points within @p radius of @p p (inclusive), by increasing
+  /// distance.
+  void FindWithinRadius(const Eigen::Vector3f& p, float radius,
+                        std::vector<Neighbor>* neighbors) const;
+
+  /// Finds the @p k points nearest to each column of @p queries. Column j of
+  /// @p indices and @p squared_distances holds the neighbors of query j by
+  /// increasing distance; if fewer than k points are indexed, the remaining
+  /// rows are -1 and +Inf respectively.
+  void FindNearest(const Eigen::Ref<const Matrix3X<float>>& queries, int k,
+                   Eigen::MatrixXi* indices,
+                   Eigen::MatrixXf* squared_distances) const;
+
+  /// Finds the points within @p radius of each column of @p queries; element
+  /// j of @p neighbors holds those of query j by increasing distance.
+  void FindWithinRadius(const Eigen::Ref<const Matrix3X<float>>& queries,
+                        float radius,
+                        std::vector<std::vector<Neighbor>>* neighbors) const;
+
+ private:
+  // Spans indices_[begin, end), whose points are all within [lower, upper].
+  // Leaves have no children.
+  struct Node {
+    Eigen::Vector3f lower;
+    Eigen::Vector3f upper;
+    int begin{};
+    int end{};
+    int left{-1};
+    int right{-1};
+  };
+
+  // Returns the index of the node built over indices_[begin, end).
+  int Build(int begin, int end);
+
+  // Updates the bounding box of the node at `node_index` and of its
+  // descendants from the points they span.
+  void RefitNode(int node_index);
+
+  Eigen::Map<const Eigen::Vector3f> point(int index) const {
+    return Eigen::Map<const Eigen::Vector3f>(xyzs_ + 3 * index);
+  }
+
+  void SearchNearest(int node_index, const Eigen::Vector3f& p, int k,
+                     std::vector<Neighbor>* heap) const;
+
+  void SearchWithinRadius(int node_index, const Eigen::Vector3f& p,
+                          float squared_radius,
+                          std::vector<Neighbor>* neighbors) const;
+
+  const PointCloud* const cloud_;
+  const int leaf_size_;
+  // The XYZs of the cloud and its size at the last Rebuild().
+  const float* xyzs_{};
+  int cloud_size_{};
+  std::vector<int> indices_;
+  // nodes_[0] is the root, if any point is indexed.
+  std::vector<Node> nodes_;
+  // Runs the batched searches; it is kept across searches, so that its
+  // threads are only created by set_num_threads().
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+};
+
+}  // namespace perception
+}  // namespace drake
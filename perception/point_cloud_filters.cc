@@ -0,0 +1,89 @@
+#include "drake/perception/point_cloud_filters.h"
+
+#include "drake/common/drake_throw.h"
+#include "drake/perception/point_cloud_processing.h"
+
+namespace drake {
+namespace perception {
+
+CropBoxFilter::CropBoxFilter(const Eigen::Vector3f& lower_xyz,
+                             const Eigen::Vector3f& upper_xyz,
+                             const math::RigidTransformd& X_CB,
+                             pc_flags::BaseFieldT fields)
+    : lower_xyz_(lower_xyz), upper_xyz_(upper_xyz), X_CB_(X_CB) {
+  this->DeclareAbstractInputPort("point_cloud",
+                                 Value<PointCloud>(PointCloud{0, fields}));
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{0, fields},
+                                  &CropBoxFilter::CalcOutput);
+}
+
+void CropBoxFilter::CalcOutput(const systems::Context<double>& context,
+                               PointCloud* output) const {
+  const auto& input = point_cloud_input_port().Eval<PointCloud>(context);
+  if (X_CB_.IsExactlyIdentity()) {
+    CropBox(input, lower_xyz_, upper_xyz_, output);
+  } else {
+    CropBox(input, X_CB_, lower_xyz_, upper_xyz_, output);
+  }
+}
+
+VoxelGridFilter::VoxelGridFilter(double voxel_size,
+                                 pc_flags::BaseFieldT fields)
+    : voxel_size_(voxel_size) {
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  this->DeclareAbstractInputPort("point_cloud",
+                                 Value<PointCloud>(PointCloud{0, fields}));
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{0, fields},
+                                  &VoxelGridFilter::CalcOutput);
+}
+
+void VoxelGridFilter::CalcOutput(const systems::Context<double>& context,
+                                 PointCloud* output) const {
+  const auto& input = point_cloud_input_port().Eval<PointCloud>(context);
+  VoxelizedDownSample(input, voxel_size_, output);
+}
+
+StatisticalOutlierFilter::StatisticalOutlierFilter(int num_neighbors,
+                                                   double std_ratio,
+                                                   pc_flags::BaseFieldT fields,
+                                                   int num_threads)
+    : num_neighbors_(num_neighbors),
+      std_ratio_(std_ratio),
+      num_threads_(num_threads) {
+  DRAKE_THROW_UNLESS(num_neighbors >= 1);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  this->DeclareAbstractInputPort("point_cloud",
+                                 Value<PointCloud>(PointCloud{0, fields}));
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{0, fields},
+                                  &StatisticalOutlierFilter::CalcOutput);
+}
+
+void StatisticalOutlierFilter::CalcOutput(
+    const systems::Context<double>& context, PointCloud* output) const {
+  const auto& input = point_cloud_input_port().Eval<PointCloud>(context);
+  RemoveStatisticalOutliers(input, num_neighbors_, std_ratio_, output,
+                            num_threads_);
+}
+
+NormalEstimator::NormalEstimator(int num_closest, pc_flags::BaseFieldT fields,
+                                 int num_threads)
+    : num_closest_(num_closest), fields_(fields), num_threads_(num_threads) {
+  DRAKE_THROW_UNLESS(num_closest >= 1);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  this->DeclareAbstractInputPort("point_cloud",
+                                 Value<PointCloud>(PointCloud{0, fields}));
+  this->DeclareAbstractOutputPort("point_cloud",
+                                  PointCloud{0, fields | pc_flags::kNormals},
+                                  &NormalEstimator::CalcOutput);
+}
+
+void NormalEstimator::CalcOutput(const systems::Context<double>& context,
+                                 PointCloud* output) const {
+  const auto& input = point_cloud_input_port().Eval<PointCloud>(context);
+  // Copies the input fields; the normals are all written below.
+  output->SetFrom(input, fields_);
+  EstimateNormals(num_closest_, output, num_threads_);
+}
+
+}  // namespace perception
+}  // namespace drake
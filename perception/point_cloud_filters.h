@@ -0,0 +1,178 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+
+/// @file
+/// Systems wrapping the stages of point_cloud_processing.h. Each one has a
+/// single abstract-valued input port and output port, both named
+/// "point_cloud", whose PointCloud has the fields passed to its constructor
+/// (to which NormalEstimator adds the normals). The output is recomputed
+/// whenever the input changes.
+
+namespace drake {
+namespace perception {
+
+/// Keeps the points of the input cloud that lie within a box.
+///
+/// @system{ CropBoxFilter,
+///          @input_port{point_cloud},
+///          @output_port{point_cloud}
+/// }
+///
+/// @see CropBox()
+/// @ingroup perception_systems
+class CropBoxFilter final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CropBoxFilter)
+
+  /// Constructs a filter keeping the points within the box `lower_xyz ≤ p_B ≤
+  /// upper_xyz`, where B is the frame of the box, whose pose in the frame of
+  /// the cloud is @p X_CB. By default, the box is axis-aligned.
+  CropBoxFilter(const Eigen::Vector3f& lower_xyz,
+                const Eigen::Vector3f& upper_xyz,
+                const math::RigidTransformd& X_CB = math::RigidTransformd(),
+                pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+
+  /// Returns the abstract valued input port that expects a PointCloud.
+  const systems::InputPort<double>& point_cloud_input_port() const {
+    return LeafSystem<double>::get_input_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides a PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  void CalcOutput(const systems::Context<double>&, PointCloud*) const;
+
+  const Eigen::Vector3f lower_xyz_;
+  const Eigen::Vector3f upper_xyz_;
+  const math::RigidTransformd X_CB_;
+};
+
+/// Downsamples the input cloud on a grid of voxels.
+///
+/// @system{ VoxelGridFilter,
+///          @input_port{point_cloud},
+///          @output_port{point_cloud}
+/// }
+///
+/// @see VoxelizedDownSample()
+/// @ingroup perception_systems
+class VoxelGridFilter final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VoxelGridFilter)
+
+  /// Constructs a filter on a grid of cubic voxels of side @p voxel_size.
+  /// @throws std::runtime_error if `voxel_size` is not positive.
+  explicit VoxelGridFilter(double voxel_size,
+                           pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+
+  /// Returns the abstract valued input port that expects a PointCloud.
+  const systems::InputPort<double>& point_cloud_input_port() const {
+    return LeafSystem<double>::get_input_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides a PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  void CalcOutput(const systems::Context<double>&, PointCloud*) const;
+
+  const double voxel_size_;
+};
+
+/// Removes the statistical outliers of the input cloud.
+///
+/// @system{ StatisticalOutlierFilter,
+///          @input_port{point_cloud},
+///          @output_port{point_cloud}
+/// }
+///
+/// @see RemoveStatisticalOutliers()
+/// @ingroup perception_systems
+class StatisticalOutlierFilter final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(StatisticalOutlierFilter)
+
+  /// Constructs a filter removing the points whose mean distance to their
+  /// @p num_neighbors nearest neighbors exceeds the mean over the cloud by
+  /// more than @p std_ratio standard deviations. The neighbors are searched
+  /// for on @p num_threads threads.
+  /// @throws std::runtime_error if `num_neighbors` or `num_threads` is not
+  /// positive.
+  StatisticalOutlierFilter(int num_neighbors, double std_ratio,
+                           pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+                           int num_threads = 1);
+
+  /// Returns the abstract valued input port that expects a PointCloud.
+  const systems::InputPort<double>& point_cloud_input_port() const {
+    return LeafSystem<double>::get_input_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides a PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  void CalcOutput(const systems::Context<double>&, PointCloud*) const;
+
+  const int num_neighbors_;
+  const double std_ratio_;
+  const int num_threads_;
+};
+
+/// Estimates the normals of the input cloud. The output cloud holds the
+/// points of the input cloud, with their normals.
+///
+/// @system{ NormalEstimator,
+///          @input_port{point_cloud},
+///          @output_port{point_cloud}
+/// }
+///
+/// @see EstimateNormals()
+/// @ingroup perception_systems
+class NormalEstimator final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(NormalEstimator)
+
+  /// Constructs an estimator from the @p num_closest nearest neighbors of
+  /// each point, searched for on @p num_threads threads.
+  /// @param fields The fields of the input cloud; those of the output cloud
+  ///   are `fields | pc_flags::kNormals`.
+  /// @throws std::runtime_error if `num_closest` or `num_threads` is not
+  /// positive.
+  explicit NormalEstimator(int num_closest,
+                           pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+                           int num_threads = 1);
+
+  /// Returns the abstract valued input port that expects a PointCloud.
+  const systems::InputPort<double>& point_cloud_input_port() const {
+    return LeafSystem<double>::get_input_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides a PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  void CalcOutput(const systems::Context<double>&, PointCloud*) const;
+
+  const int num_closest_;
+  const pc_flags::BaseFieldT fields_;
+  const int num_threads_;
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,283 @@
+#include "drake/perception/point_cloud_processing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/perception/kd_tree.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+
+typedef PointCloud::T T;
+typedef PointCloud::C C;
+
+// Throws unless `output` may receive the points of `cloud`.
+void CheckOutput(const PointCloud& cloud, const PointCloud* output) {
+  DRAKE_THROW_UNLESS(output != nullptr);
+  DRAKE_THROW_UNLESS(output != &cloud);
+  cloud.RequireFields(pc_flags::kXYZs);
+  output->RequireExactFields(cloud.fields());
+}
+
+bool IsFinite(const Eigen::Ref<const Matrix3X<T>>& xyzs, int i) {
+  return !PointCloud::IsInvalidValue(xyzs(0, i)) &&
+         !PointCloud::IsInvalidValue(xyzs(1, i)) &&
+         !PointCloud::IsInvalidValue(xyzs(2, i));
+}
+
+// Copies all of the fields of the points of `cloud` given by `indices`, in
+// that order, into `output`.
+void CopySelected(const PointCloud& cloud, const std::vector<int>& indices,
+                  PointCloud* output) {
+  const int size = static_cast<int>(indices.size());
+  output->resize(size, true);
+  if (cloud.has_xyzs()) {
+    const auto xyzs = cloud.xyzs();
+    auto output_xyzs = output->mutable_xyzs();
+    for (int i = 0; i < size; ++i) output_xyzs.col(i) = xyzs.col(indices[i]);
+  }
+  if (cloud.has_normals()) {
+    const auto normals = cloud.normals();
+    auto output_normals = output->mutable_normals();
+    for (int i = 0; i < size; ++i) {
+      output_normals.col(i) = normals.col(indices[i]);
+    }
+  }
+  if (cloud.has_rgbs()) {
+    const auto rgbs = cloud.rgbs();
+    auto output_rgbs = output->mutable_rgbs();
+    for (int i = 0; i < size; ++i) output_rgbs.col(i) = rgbs.col(indices[i]);
+  }
+  if (cloud.has_descriptors()) {
+    const auto descriptors = cloud.descriptors();
+    auto output_descriptors = output->mutable_descriptors();
+    for (int i = 0; i < size; ++i) {
+      output_descriptors.col(i) = descriptors.col(indices[i]);
+    }
+  }
+}
+
+// The integer coordinates of a voxel.
+struct VoxelKey {
+  bool operator==(const VoxelKey& other) const {
+    return x == other.x && y == other.y && z == other.z;
+  }
+
+  int64_t x{};
+  int64_t y{};
+  int64_t z{};
+};
+
+struct VoxelKeyHash {
+  size_t operator()(const VoxelKey& key) const {
+    // Large primes, as in Teschner et al., "Optimized Spatial Hashing for
+    // Collision Detection of Deformable Objects" (2003).
+    return static_cast<size_t>(key.x * 73856093) ^
+           static_cast<size_t>(key.y * 19349663) ^
+           static_cast<size_t>(key.z * 83492791);
+  }
+};
+
+}  // namespace
+
+void CropBox(const PointCloud& cloud, const Eigen::Vector3f& lower_xyz,
+             const Eigen::Vector3f& upper_xyz, PointCloud* output) {
+  CheckOutput(cloud, output);
+  const auto xyzs = cloud.xyzs();
+  std::vector<int> indices;
+  indices.reserve(cloud.size());
+  for (int i = 0; i < cloud.size(); ++i) {
+    // NaN coordinates fail both comparisons, and ±Inf is outside any box.
+    if ((xyzs.col(i).array() >= lower_xyz.array()).all() &&
+        (xyzs.col(i).array() <= upper_xyz.array()).all() &&
+        IsFinite(xyzs, i)) {
+      indices.push_back(i);
+    }
+  }
+  CopySelected(cloud, indices, output);
+}
+
+void CropBox(const PointCloud& cloud, const math::RigidTransformd& X_CB,
+             const Eigen::Vector3f& lower_xyz,
+             const Eigen::Vector3f& upper_xyz, PointCloud* output) {
+  CheckOutput(cloud, output);
+  const Eigen::Isometry3f X_BC =
+      X_CB.inverse().GetAsIsometry3().cast<float>();
+  const auto xyzs = cloud.xyzs();
+  std::vector<int> indices;
+  indices.reserve(cloud.size());
+  for (int i = 0; i < cloud.size(); ++i) {
+    const Vector3f p_B = X_BC * Vector3f(xyzs.col(i));
+    if ((p_B.array() >= lower_xyz.array()).all() &&
+        (p_B.array() <= upper_xyz.array()).all() && IsFinite(xyzs, i)) {
+      indices.push_back(i);
+    }
+  }
+  CopySelected(cloud, indices, output);
+}
+
+void VoxelizedDownSample(const PointCloud& cloud, double voxel_size,
+                         PointCloud* output) {
+  CheckOutput(cloud, output);
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  const auto xyzs = cloud.xyzs();
+
+  // Assigns each finite point to its voxel, numbered by first appearance.
+  std::unordered_map<VoxelKey, int, VoxelKeyHash> voxel_indices;
+  std::vector<int> point_voxels(cloud.size(), -1);
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (!IsFinite(xyzs, i)) continue;
+    const Vector3d coordinates =
+        (xyzs.col(i).cast<double>() / voxel_size).array().floor();
+    const VoxelKey key{static_cast<int64_t>(coordinates(0)),
+                       static_cast<int64_t>(coordinates(1)),
+                       static_cast<int64_t>(coordinates(2))};
+    point_voxels[i] =
+        voxel_indices.emplace(key, static_cast<int>(voxel_indices.size()))
+            .first->second;
+  }
+  const int num_voxels = static_cast<int>(voxel_indices.size());
+
+  Eigen::VectorXd counts = Eigen::VectorXd::Zero(num_voxels);
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (point_voxels[i] >= 0) counts(point_voxels[i]) += 1;
+  }
+  // Averages a field over the points of each voxel, in double precision.
+  auto average = [&](const auto& values) {
+    Eigen::MatrixXd sums = Eigen::MatrixXd::Zero(values.rows(), num_voxels);
+    for (int i = 0; i < cloud.size(); ++i) {
+      if (point_voxels[i] >= 0) {
+        sums.col(point_voxels[i]) += values.col(i).template cast<double>();
+      }
+    }
+    return Eigen::MatrixXd(sums.array().rowwise() /
+                           counts.transpose().array());
+  };
+
+  output->resize(num_voxels, true);
+  output->mutable_xyzs() = average(xyzs).cast<T>();
+  if (cloud.has_normals()) {
+    output->mutable_normals() =
+        average(cloud.normals()).colwise().normalized().cast<T>();
+  }
+  if (cloud.has_rgbs()) {
+    output->mutable_rgbs() = average(cloud.rgbs()).array().round().cast<C>();
+  }
+  if (cloud.has_descriptors()) {
+    output->mutable_descriptors() = average(cloud.descriptors()).cast<T>();
+  }
+}
+
+void RemoveStatisticalOutliers(const PointCloud& cloud, int num_neighbors,
+                               double std_ratio, PointCloud* output,
+                               int num_threads) {
+  CheckOutput(cloud, output);
+  DRAKE_THROW_UNLESS(num_neighbors >= 1);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const auto xyzs = cloud.xyzs();
+  KdTree tree(&cloud);
+  tree.set_num_threads(num_threads);
+
+  // A point is its own nearest neighbor, so one more is searched for.
+  Eigen::MatrixXi neighbor_indices;
+  Eigen::MatrixXf squared_distances;
+  tree.FindNearest(xyzs, num_neighbors + 1, &neighbor_indices,
+                   &squared_distances);
+
+  // The mean distance of each point to its neighbors, or NaN for the
+  // non-finite points.
+  Eigen::VectorXd mean_distances(cloud.size());
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (!IsFinite(xyzs, i)) {
+      mean_distances(i) = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+    double sum = 0;
+    int count = -1;
+    for (int j = 0; j < neighbor_indices.rows(); ++j) {
+      if (neighbor_indices(j, i) < 0) break;
+      sum += std::sqrt(static_cast<double>(squared_distances(j, i)));
+      ++count;
+    }
+    mean_distances(i) = count > 0 ? sum / count : 0.0;
+  }
+
+  double sum = 0;
+  double sum_squares = 0;
+  int count = 0;
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (std::isnan(mean_distances(i))) continue;
+    sum += mean_distances(i);
+    sum_squares += mean_distances(i) * mean_distances(i);
+    ++count;
+  }
+  const double mean = count > 0 ? sum / count : 0.0;
+  const double variance =
+      count > 1 ? (sum_squares - sum * sum / count) / (count - 1) : 0.0;
+  const double threshold = mean + std_ratio * std::sqrt(std::max(0.0,
+                                                                 variance));
+
+  std::vector<int> indices;
+  indices.reserve(count);
+  for (int i = 0; i < cloud.size(); ++i) {
+    // NaN fails the comparison.
+    if (mean_distances(i) <= threshold) indices.push_back(i);
+  }
+  CopySelected(cloud, indices, output);
+}
+
+void EstimateNormals(int num_closest, PointCloud* cloud, int num_threads) {
+  DRAKE_THROW_UNLESS(cloud != nullptr);
+  DRAKE_THROW_UNLESS(num_closest >= 1);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  cloud->RequireFields(pc_flags::kXYZs | pc_flags::kNormals);
+  const auto xyzs = cloud->xyzs();
+  auto normals = cloud->mutable_normals();
+  KdTree tree(cloud);
+  tree.set_num_threads(num_threads);
+
+  Eigen::MatrixXi neighbor_indices;
+  Eigen::MatrixXf squared_distances;
+  tree.FindNearest(xyzs, num_closest, &neighbor_indices, &squared_distances);
+
+  for (int i = 0; i < cloud->size(); ++i) {
+    normals.col(i).setConstant(std::numeric_limits<T>::quiet_NaN());
+    if (!IsFinite(xyzs, i)) continue;
+    int count = 0;
+    while (count < num_closest && neighbor_indices(count, i) >= 0) ++count;
+    if (count < 3) continue;
+
+    Vector3d centroid = Vector3d::Zero();
+    for (int j = 0; j < count; ++j) {
+      centroid += xyzs.col(neighbor_indices(j, i)).cast<double>();
+    }
+    centroid /= count;
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (int j = 0; j < count; ++j) {
+      const Vector3d p =
+          xyzs.col(neighbor_indices(j, i)).cast<double>() - centroid;
+      covariance += p * p.transpose();
+    }
+    // The eigenvalues are sorted in increasing order.
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    solver.computeDirect(covariance);
+    Vector3d normal = solver.eigenvectors().col(0);
+    if (normal.dot(xyzs.col(i).cast<double>()) > 0) {
+      normal = -normal;
+    }
+    normals.col(i) = normal.cast<T>();
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
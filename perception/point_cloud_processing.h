@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+
+/// @file
+/// Basic processing stages for PointCloud: cropping, voxel-grid downsampling,
+/// statistical outlier removal and normal estimation. These follow the
+/// semantics of their namesakes in the Point Cloud Library (PCL).
+///
+/// Every stage that produces a new cloud writes it to an `output` cloud, which
+/// must have the same fields as the input, must not be the input itself and is
+/// resized as needed; a single output cloud may therefore be reused from one
+/// call to the next, keeping its storage. The stages that search for the
+/// nearest neighbors of every point take a `num_threads` argument, as those
+/// searches dominate their cost and are independent of each other; they are
+/// run by the KdTree of the call (see KdTree::set_num_threads()).
+///
+/// Points with a non-finite coordinate (see PointCloud::IsInvalidValue()) are
+/// never kept in the output of a stage.
+
+namespace drake {
+namespace perception {
+
+/// Keeps the points of @p cloud that lie within the axis-aligned box
+/// `lower_xyz ≤ p ≤ upper_xyz` (inclusive), in their original order.
+/// @pre `cloud` has XYZs.
+/// @throws std::runtime_error if `output` does not have the same fields as
+/// `cloud`, or is `cloud`.
+void CropBox(const PointCloud& cloud, const Eigen::Vector3f& lower_xyz,
+             const Eigen::Vector3f& upper_xyz, PointCloud* output);
+
+/// Keeps the points of @p cloud that lie within an oriented box, i.e. the
+/// points p_C such that `lower_xyz ≤ X_BC * p_C ≤ upper_xyz`, where B is the
+/// frame of the box and C the frame of the cloud; @p X_CB is the pose of the
+/// box in the cloud frame.
+/// @see CropBox() for the axis-aligned version and the preconditions.
+void CropBox(const PointCloud& cloud, const math::RigidTransformd& X_CB,
+             const Eigen::Vector3f& lower_xyz,
+             const Eigen::Vector3f& upper_xyz, PointCloud* output);
+
+/// Downsamples @p cloud on a grid of cubic voxels of side @p voxel_size: the
+/// points within each voxel are replaced by their centroid. The other fields
+/// are averaged as well, with the averaged normals normalized again. Voxels
+/// are output in the order in which their first point appears in `cloud`.
+/// @pre `cloud` has XYZs.
+/// @throws std::runtime_error if `voxel_size` is not positive, or if `output`
+/// does not have the same fields as `cloud`, or is `cloud`.
+void VoxelizedDownSample(const PointCloud& cloud, double voxel_size,
+                         PointCloud* output);
+
+/// Removes the outliers of @p cloud, found from the distribution of the mean
+/// distances of the points to their @p num_neighbors nearest neighbors: a
+/// point is an outlier if its mean distance exceeds `μ + std_ratio σ`, where μ
+/// and σ are the mean and standard deviation of the mean distances over the
+/// cloud. The remaining points are kept in their original order.
+/// @pre `cloud` has XYZs.
+/// @throws std::runtime_error if `num_neighbors` or `num_threads` is not
+/// positive, or if `output` does not have the same fields as `cloud`, or is
+/// `cloud`.
+void RemoveStatisticalOutliers(const PointCloud& cloud, int num_neighbors,
+                               double std_ratio, PointCloud* output,
+                               int num_threads = 1);
+
+/// Estimates the normal of every point of @p cloud as the direction of least
+/// variance of its @p num_closest nearest neighbors (itself included),
+/// oriented towards the origin of the cloud frame, i.e. towards the sensor
+/// for a cloud in the camera frame. The normals of the points with fewer than
+/// three finite neighbors, or with a non-finite coordinate, are NaN.
+/// @pre `cloud` has XYZs and normals.
+/// @throws std::runtime_error if `num_closest` or `num_threads` is not
+/// positive, or if `cloud` does not have normals.
+void EstimateNormals(int num_closest, PointCloud* cloud, int num_threads = 1);
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,136 @@
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/depth_image_to_point_cloud.h"
+
+DEFINE_int32(num_frames, 30, "The number of frames converted per case.");
+
+// Times DepthImageToPointCloud::Convert on VGA depth images, of which a tenth
+// of the pixels are invalid, against a reference implementation of the
+// conversion as a plain per-pixel loop.
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Isometry3f;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::sensors::CameraInfo;
+using systems::sensors::Image;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+constexpr int kWidth = 640;
+constexpr int kHeight = 480;
+
+// Back-projects every pixel on its own, as Convert used to.
+template <PixelType pixel_type>
+void ReferenceConvert(const CameraInfo& camera_info,
+                      const RigidTransformd& camera_pose,
+                      const Image<pixel_type>& depth_image, float scale,
+                      PointCloud* output) {
+  output->resize(depth_image.size(), true);
+  auto output_xyz = output->mutable_xyzs();
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  const Isometry3f X_PC = camera_pose.GetAsIsometry3().cast<float>();
+  for (int v = 0; v < depth_image.height(); ++v) {
+    for (int u = 0; u < depth_image.width(); ++u) {
+      const int col = v * depth_image.width() + u;
+      const auto z = depth_image.at(u, v)[0];
+      if ((z == ImageTraits<pixel_type>::kTooClose) ||
+          (z == ImageTraits<pixel_type>::kTooFar)) {
+        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
+      } else {
+        output_xyz.col(col) =
+            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
+                            scale * z * (v - cy) * fy_inv, scale * z);
+      }
+    }
+  }
+}
+
+template <PixelType pixel_type>
+void Benchmark(const std::string& name, float scale, float max_depth) {
+  using Traits = ImageTraits<pixel_type>;
+  const CameraInfo camera_info(kWidth, kHeight, M_PI / 4);
+  const RigidTransformd camera_pose(RollPitchYawd(0.1, -0.2, 0.3),
+                                    Eigen::Vector3d(1.1, -1.2, 1.3));
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> depth(1, max_depth);
+  std::bernoulli_distribution is_invalid(0.1);
+  Image<pixel_type> depth_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      depth_image.at(u, v)[0] =
+          is_invalid(generator)
+              ? Traits::kTooFar
+              : static_cast<typename Traits::ChannelType>(depth(generator));
+    }
+  }
+
+  PointCloud reference(0);
+  PointCloud result(0);
+  PointCloud compacted(0);
+  const double reference_time = common::test::MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_frames; ++i) {
+      ReferenceConvert(camera_info, camera_pose, depth_image, scale,
+                       &reference);
+    }
+  });
+  const double convert_time = common::test::MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_frames; ++i) {
+      DepthImageToPointCloud::Convert(camera_info, camera_pose, depth_image,
+                                      nullopt, scale, &result);
+    }
+  });
+  const double compacted_time = common::test::MeasureExecutionTime([&]() {
+    for (int i = 0; i < FLAGS_num_frames; ++i) {
+      DepthImageToPointCloud::Convert(camera_info, camera_pose, depth_image,
+                                      nullopt, scale, &compacted, true);
+    }
+  });
+
+  // Compares the finite points of both implementations.
+  const Eigen::ArrayXXf difference =
+      (result.xyzs() - reference.xyzs()).array().abs();
+  const float max_difference = difference.isFinite().select(difference, 0.f)
+                                   .maxCoeff();
+  std::cout << fmt::format("{:>6} {:16.3f} {:14.3f} {:22.3f} {:8d} {:14.2g}\n",
+                           name, 1e3 * reference_time / FLAGS_num_frames,
+                           1e3 * convert_time / FLAGS_num_frames,
+                           1e3 * compacted_time / FLAGS_num_frames,
+                           compacted.size(), max_difference);
+}
+
+int do_main() {
+  std::cout << "  type   reference [ms]   Convert [ms]"
+               "   Convert, compact [ms]   points   max difference\n";
+  Benchmark<PixelType::kDepth32F>("32F", 1.0, 5.0);
+  Benchmark<PixelType::kDepth16U>("16U", 1e-3, 5000.0);
+  return 0;
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the conversion of depth images to point clouds.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::perception::do_main();
+}
@@ -15,6 +15,7 @@ using drake::math::RigidTransformd;
 using drake::math::RollPitchYawd;
 using drake::systems::sensors::CameraInfo;
 using drake::systems::sensors::Image;
+using drake::systems::sensors::ImageDepth32F;
 using drake::systems::sensors::ImageRgba8U;
 using drake::systems::sensors::ImageTraits;
 using drake::systems::sensors::PixelType;
@@ -145,7 +146,7 @@ class DepthImageToPointCloudTest : public ::testing::Test {
       const optional<RigidTransformd>& camera_pose,
       const MatrixX<Pixel>& depth_image_matrix,
       const optional<systems::sensors::ImageRgba8U>& color_image,
-      const optional<float>& scale) {
+      const optional<float>& scale, bool drop_invalid_points = false) {
     const auto depth_image = MakeDepthImage(depth_image_matrix);
 
     // Call the DUT to convert Image to PointCloud.
@@ -153,7 +154,8 @@ class DepthImageToPointCloudTest : public ::testing::Test {
     if (kUseSystem) {
       PointCloud result(0, kFields);
       const DepthImageToPointCloud dut(camera_info, kConfiguredPixelType,
-                                       scale.value_or(1.0), kFields);
+                                       scale.value_or(1.0), kFields,
+                                       drop_invalid_points);
       auto context = dut.CreateDefaultContext();
       context->FixInputPort(0, Value<ConfiguredImage>(depth_image));
       if (kFields & pc_flags::kRGBs) {
@@ -168,10 +170,12 @@ class DepthImageToPointCloudTest : public ::testing::Test {
       PointCloud result(0, kFields);
       if (kFields & pc_flags::kRGBs) {
         DepthImageToPointCloud::Convert(camera_info, camera_pose, depth_image,
-                                        color_image, scale, &result);
+                                        color_image, scale, &result,
+                                        drop_invalid_points);
       } else {
         DepthImageToPointCloud::Convert(camera_info, camera_pose, depth_image,
-                                        nullopt, scale, &result);
+                                        nullopt, scale, &result,
+                                        drop_invalid_points);
       }
       return result;
     }
@@ -406,6 +410,56 @@ TYPED_TEST(DepthImageToPointCloudTest, TooNearFar) {
   EXPECT_TRUE(TestFixture::CompareClouds(result, expected_cloud));
 }
 
+// Verifies that invalid pixels are left out of the point cloud on request.
+TYPED_TEST(DepthImageToPointCloudTest, DropInvalidPoints) {
+  using Pixel = typename TestFixture::Pixel;
+  using Traits = typename TestFixture::ConfiguredImageTraits;
+  constexpr bool is_meaningful_nan = !std::is_same<Pixel, uint16_t>::value;
+
+  // A 4x1 image whose first and last pixels are valid; the second and third
+  // are too close and too far.
+  const CameraInfo camera(4, 1, 1.0, 1.0, 0.5, 0.5);
+  MatrixX<Pixel> depth_image(4, 1);
+  depth_image << 2, Traits::kTooClose, Traits::kTooFar, 3;
+  ImageRgba8U color_image = this->MakeRgbaImage(4, 1, 0, 0, 0);
+  for (int u = 0; u < 4; ++u) {
+    color_image.at(u, 0)[0] = static_cast<uint8_t>(10 * u);
+  }
+
+  PointCloud expected_cloud(2, TestFixture::kFields);
+  expected_cloud.mutable_xyzs().col(0) = Vector3f(-1, -1, 2);
+  expected_cloud.mutable_xyzs().col(1) = Vector3f(7.5, -1.5, 3);
+  if (TestFixture::kFields & pc_flags::kRGBs) {
+    expected_cloud.mutable_rgbs().col(0) = Vector3<uint8_t>(0, 0, 0);
+    expected_cloud.mutable_rgbs().col(1) = Vector3<uint8_t>(30, 0, 0);
+  }
+
+  PointCloud result(0, TestFixture::kFields);
+  result = this->DoConvert(camera, nullopt, depth_image, color_image, nullopt,
+                           true);
+  EXPECT_TRUE(TestFixture::CompareClouds(result, expected_cloud));
+
+  // NaN depths are dropped too.
+  if (is_meaningful_nan) {
+    depth_image(1) =
+        is_meaningful_nan ? kFloatNaN : throw std::runtime_error("");
+    result = this->DoConvert(camera, nullopt, depth_image, color_image,
+                             nullopt, true);
+    EXPECT_TRUE(TestFixture::CompareClouds(result, expected_cloud));
+  }
+
+  // With a pose, the valid points are transformed.
+  const RigidTransformd& pose = this->random_transform_;
+  result =
+      this->DoConvert(camera, pose, depth_image, color_image, nullopt, true);
+  ASSERT_EQ(result.size(), 2);
+  EXPECT_TRUE(CompareMatrices(
+      result.xyzs(),
+      (pose.GetAsMatrix34().cast<float>() *
+       expected_cloud.xyzs().colwise().homogeneous()).eval(),
+      1e-6));
+}
+
 // Verifies the System method CalcOutput resets invalid storage.
 TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   using Pixel = typename TestFixture::Pixel;
@@ -470,6 +524,39 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that one cloud may receive frames with more, fewer and as many
+// valid points as the previous one, when dropping invalid points.
+GTEST_TEST(DepthImageToPointCloudReuseTest, DropInvalidPoints) {
+  const CameraInfo camera(4, 3, 2.0, 2.0, 1.5, 1.0);
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  ImageRgba8U color_image(4, 3);
+  for (int v = 0; v < 3; ++v) {
+    for (int u = 0; u < 4; ++u) {
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(u, v)[c] = static_cast<uint8_t>(16 * v + 4 * u + c);
+      }
+    }
+  }
+
+  PointCloud reused(0, fields);
+  for (int num_valid : {12, 5, 9, 9, 2, 12}) {
+    ImageDepth32F depth_image(4, 3);
+    for (int i = 0; i < 12; ++i) {
+      depth_image.at(i % 4, i / 4)[0] =
+          i < num_valid ? 1.0f + 0.25f * i : kFloatInf;
+    }
+    DepthImageToPointCloud::Convert(camera, nullopt, depth_image, color_image,
+                                    nullopt, &reused, true);
+    PointCloud fresh(0, fields);
+    DepthImageToPointCloud::Convert(camera, nullopt, depth_image, color_image,
+                                    nullopt, &fresh, true);
+    ASSERT_EQ(reused.size(), num_valid);
+    ASSERT_EQ(fresh.size(), num_valid);
+    EXPECT_TRUE(CompareMatrices(reused.xyzs(), fresh.xyzs()));
+    EXPECT_TRUE(CompareMatrices(reused.rgbs(), fresh.rgbs()));
+  }
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
@@ -0,0 +1,75 @@
+#include "drake/perception/icp_tracker.h"
+
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// Returns `size` points drawn uniformly on the surface of a unit sphere
+// squashed along y and z, with their normals.
+PointCloud MakeEllipsoid(int size) {
+  const Vector3f radii(0.1, 0.06, 0.03);
+  std::mt19937 generator(0);
+  std::normal_distribution<float> coordinate;
+  PointCloud cloud(size, pc_flags::kXYZs | pc_flags::kNormals);
+  for (int i = 0; i < size; ++i) {
+    const Vector3f u = Vector3f(coordinate(generator), coordinate(generator),
+                                coordinate(generator))
+                           .normalized();
+    cloud.mutable_xyz(i) = u.cwiseProduct(radii);
+    cloud.mutable_normal(i) = u.cwiseQuotient(radii).normalized();
+  }
+  return cloud;
+}
+
+GTEST_TEST(IcpTrackerTest, Track) {
+  const PointCloud model = MakeEllipsoid(2000);
+  const double period = 1.0 / 30;
+  const RigidTransformd X_CM_guess(Vector3d(0, 0, 1));
+  const IcpTracker dut(model, X_CM_guess, period);
+  EXPECT_EQ(dut.point_cloud_input_port().get_name(), "point_cloud");
+  EXPECT_EQ(dut.pose_output_port().get_name(), "pose");
+  EXPECT_FALSE(dut.HasAnyDirectFeedthrough());
+  EXPECT_EQ(dut.icp().model().size(), model.size());
+
+  // The object, as seen by the camera, slightly away from the guess.
+  const RigidTransformd X_CM(RollPitchYawd(0.05, 0.02, -0.1),
+                             Vector3d(0.01, -0.02, 1.01));
+  PointCloud scene(model.size());
+  scene.mutable_xyzs() =
+      X_CM.GetAsIsometry3().cast<float>() * model.xyzs();
+
+  systems::Simulator<double> simulator(dut);
+  systems::Context<double>& context = simulator.get_mutable_context();
+  context.FixInputPort(0, Value<PointCloud>(scene));
+  EXPECT_TRUE(dut.pose_output_port()
+                  .Eval<RigidTransformd>(context)
+                  .IsExactlyEqualTo(X_CM_guess));
+  simulator.AdvanceTo(3 * period);
+  EXPECT_TRUE(dut.pose_output_port()
+                  .Eval<RigidTransformd>(context)
+                  .IsNearlyEqualTo(X_CM, 1e-4));
+
+  dut.SetPose(&context, X_CM_guess);
+  EXPECT_TRUE(dut.pose_output_port()
+                  .Eval<RigidTransformd>(context)
+                  .IsExactlyEqualTo(X_CM_guess));
+
+  EXPECT_THROW(IcpTracker(model, X_CM_guess, 0), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
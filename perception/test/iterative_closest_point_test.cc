@@ -0,0 +1,124 @@
+#include "drake/perception/iterative_closest_point.h"
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+// Returns `size` points drawn uniformly on the faces of a box of the given
+// half extents centered at the origin, with their normals.
+PointCloud MakeBox(const Vector3f& half_extents, int size, int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> face(0, 5);
+  std::uniform_real_distribution<float> coordinate(-1, 1);
+  PointCloud cloud(size, pc_flags::kXYZs | pc_flags::kNormals);
+  for (int i = 0; i < size; ++i) {
+    const int f = face(generator);
+    const int axis = f / 2;
+    const float sign = f % 2 == 0 ? 1 : -1;
+    Vector3f p(coordinate(generator), coordinate(generator),
+               coordinate(generator));
+    p(axis) = sign;
+    cloud.mutable_xyz(i) = p.cwiseProduct(half_extents);
+    cloud.mutable_normal(i) = sign * Vector3f::Unit(axis);
+  }
+  return cloud;
+}
+
+// Returns the points of `model` seen in a scene frame S.
+PointCloud MakeScene(const PointCloud& model, const RigidTransformd& X_SM) {
+  PointCloud scene(model.size());
+  const Eigen::Isometry3f X = X_SM.GetAsIsometry3().cast<float>();
+  for (int i = 0; i < model.size(); ++i) {
+    scene.mutable_xyz(i) = X * model.xyz(i);
+  }
+  return scene;
+}
+
+GTEST_TEST(IterativeClosestPointTest, Register) {
+  const PointCloud model = MakeBox(Vector3f(0.15, 0.1, 0.05), 3000, 0);
+  const RigidTransformd X_SM(RollPitchYawd(0.1, -0.05, 0.15),
+                             Vector3d(0.02, -0.01, 0.015));
+  PointCloud scene = MakeScene(model, X_SM);
+  // Points of the scene that are not on the model, e.g. sensor noise.
+  scene.Expand(2);
+  scene.mutable_xyz(model.size()) = Vector3f(1, 1, 1);
+  scene.mutable_xyz(model.size() + 1) = Vector3f(kNaN, 0, 0);
+
+  for (const IcpMetric metric :
+       {IcpMetric::kPointToPoint, IcpMetric::kPointToPlane}) {
+    for (int num_threads : {1, 3}) {
+      IcpOptions options;
+      options.metric = metric;
+      options.max_iterations = 100;
+      options.max_correspondence_distance = 0.1;
+      options.num_threads = num_threads;
+      const IterativeClosestPoint icp(model, options);
+      const IcpResult result = icp.Register(scene, RigidTransformd());
+      EXPECT_TRUE(result.converged);
+      EXPECT_TRUE(result.X_MS.IsNearlyEqualTo(X_SM.inverse(), 1e-4));
+      EXPECT_EQ(result.num_correspondences, model.size());
+      EXPECT_LT(result.rms_error, 1e-4);
+    }
+  }
+
+  // Point-to-plane needs far fewer iterations.
+  IcpOptions options;
+  options.max_correspondence_distance = 0.1;
+  options.metric = IcpMetric::kPointToPoint;
+  const int point_to_point_iterations =
+      IterativeClosestPoint(model, options)
+          .Register(scene, RigidTransformd())
+          .num_iterations;
+  options.metric = IcpMetric::kPointToPlane;
+  const int point_to_plane_iterations =
+      IterativeClosestPoint(model, options)
+          .Register(scene, RigidTransformd())
+          .num_iterations;
+  EXPECT_LT(point_to_plane_iterations, point_to_point_iterations);
+}
+
+GTEST_TEST(IterativeClosestPointTest, NoCorrespondences) {
+  const PointCloud model = MakeBox(Vector3f(0.15, 0.1, 0.05), 100, 1);
+  IcpOptions options;
+  options.max_correspondence_distance = 0.01;
+  const IterativeClosestPoint icp(model, options);
+  const RigidTransformd X_MS(Vector3d(1, 0, 0));
+  const IcpResult result = icp.Register(model, X_MS);
+  EXPECT_FALSE(result.converged);
+  EXPECT_EQ(result.num_correspondences, 0);
+  EXPECT_TRUE(result.X_MS.IsNearlyEqualTo(X_MS, 1e-12));
+}
+
+GTEST_TEST(IterativeClosestPointTest, BadArguments) {
+  const PointCloud xyzs_only(10);
+  EXPECT_THROW(IterativeClosestPoint{xyzs_only}, std::runtime_error);
+  IcpOptions options;
+  options.metric = IcpMetric::kPointToPoint;
+  EXPECT_NO_THROW(IterativeClosestPoint(xyzs_only, options));
+  options.max_iterations = 0;
+  EXPECT_THROW(IterativeClosestPoint(xyzs_only, options), std::runtime_error);
+
+  const IterativeClosestPoint icp(xyzs_only, IcpOptions{
+      IcpMetric::kPointToPoint});
+  const PointCloud no_xyzs(10, pc_flags::kRGBs);
+  EXPECT_THROW(icp.Register(no_xyzs, RigidTransformd()), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/perception/kd_tree.h"
+
+DEFINE_int32(num_points, 300000, "The number of points in the cloud.");
+DEFINE_int32(num_queries, 300000, "The number of queries per search.");
+
+// Times building, refitting and searching a KdTree over a cloud of random
+// points, as done for each frame by a registration algorithm such as ICP.
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Matrix3Xf;
+
+Matrix3Xf MakeRandomPoints(int size, std::mt19937* generator) {
+  std::uniform_real_distribution<float> coordinate(0, 1);
+  Matrix3Xf xyzs(3, size);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < 3; ++j) xyzs(j, i) = coordinate(*generator);
+  }
+  return xyzs;
+}
+
+int do_main() {
+  std::mt19937 generator(42);
+  PointCloud cloud(FLAGS_num_points);
+  cloud.mutable_xyzs() = MakeRandomPoints(FLAGS_num_points, &generator);
+  const Matrix3Xf queries = MakeRandomPoints(FLAGS_num_queries, &generator);
+
+  std::unique_ptr<KdTree> tree;
+  const double build_time = common::test::MeasureExecutionTime(
+      [&]() { tree = std::make_unique<KdTree>(&cloud); });
+  const double rebuild_time =
+      common::test::MeasureExecutionTime([&]() { tree->Rebuild(); });
+  const double refit_time =
+      common::test::MeasureExecutionTime([&]() { tree->Refit(); });
+  std::cout << fmt::format(
+      "{} points: build {:.1f} ms, rebuild {:.1f} ms, refit {:.1f} ms\n",
+      FLAGS_num_points, 1e3 * build_time, 1e3 * rebuild_time,
+      1e3 * refit_time);
+
+  std::cout << "  threads   k   queries / s\n";
+  const int max_threads =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    tree->set_num_threads(num_threads);
+    for (int k : {1, 10}) {
+      const double time = common::test::MeasureExecutionTime([&]() {
+        tree->FindNearest(queries, k, &indices, &squared_distances);
+      });
+      std::cout << fmt::format("{:>9} {:>3} {:13.3g}\n", num_threads, k,
+                               FLAGS_num_queries / time);
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage("Times the searches of a KdTree.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::perception::do_main();
+}
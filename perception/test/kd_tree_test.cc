@@ -0,0 +1,184 @@
+#include "drake/perception/kd_tree.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Matrix3Xf;
+using Eigen::Vector3f;
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+// Returns `size` points drawn uniformly in the unit cube.
+Matrix3Xf MakeRandomPoints(int size, int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> coordinate(0, 1);
+  Matrix3Xf xyzs(3, size);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < 3; ++j) xyzs(j, i) = coordinate(generator);
+  }
+  return xyzs;
+}
+
+// Returns all of the finite points of `cloud`, by increasing distance to `p`.
+std::vector<KdTree::Neighbor> SortAll(const PointCloud& cloud,
+                                      const Vector3f& p) {
+  std::vector<KdTree::Neighbor> neighbors;
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (cloud.xyz(i).array().isFinite().all()) {
+      neighbors.push_back({i, (cloud.xyz(i) - p).squaredNorm()});
+    }
+  }
+  std::sort(neighbors.begin(), neighbors.end(),
+            [](const KdTree::Neighbor& a, const KdTree::Neighbor& b) {
+              return a.squared_distance < b.squared_distance ||
+                     (a.squared_distance == b.squared_distance &&
+                      a.index < b.index);
+            });
+  return neighbors;
+}
+
+void ExpectEqual(const std::vector<KdTree::Neighbor>& neighbors,
+                 const std::vector<KdTree::Neighbor>& expected) {
+  ASSERT_EQ(neighbors.size(), expected.size());
+  for (int i = 0; i < static_cast<int>(neighbors.size()); ++i) {
+    EXPECT_EQ(neighbors[i].index, expected[i].index);
+    EXPECT_EQ(neighbors[i].squared_distance, expected[i].squared_distance);
+  }
+}
+
+// Checks the searches of `tree`, over `cloud`, against brute force.
+void CheckSearches(const KdTree& tree, const PointCloud& cloud,
+                   const Matrix3Xf& queries) {
+  const int k = 10;
+  const float radius = 0.15;
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  tree.FindNearest(queries, k, &indices, &squared_distances);
+  std::vector<std::vector<KdTree::Neighbor>> within_radius;
+  tree.FindWithinRadius(queries, radius, &within_radius);
+  ASSERT_EQ(indices.rows(), k);
+  ASSERT_EQ(indices.cols(), queries.cols());
+  ASSERT_EQ(static_cast<int>(within_radius.size()), queries.cols());
+
+  std::vector<KdTree::Neighbor> neighbors;
+  for (int j = 0; j < queries.cols(); ++j) {
+    const std::vector<KdTree::Neighbor> all = SortAll(cloud, queries.col(j));
+    const std::vector<KdTree::Neighbor> nearest(all.begin(),
+                                                all.begin() + k);
+    tree.FindNearest(queries.col(j), k, &neighbors);
+    ExpectEqual(neighbors, nearest);
+    for (int i = 0; i < k; ++i) {
+      EXPECT_EQ(indices(i, j), nearest[i].index);
+      EXPECT_EQ(squared_distances(i, j), nearest[i].squared_distance);
+    }
+
+    std::vector<KdTree::Neighbor> expected;
+    for (const auto& neighbor : all) {
+      if (neighbor.squared_distance <= radius * radius) {
+        expected.push_back(neighbor);
+      }
+    }
+    tree.FindWithinRadius(queries.col(j), radius, &neighbors);
+    ExpectEqual(neighbors, expected);
+    ExpectEqual(within_radius[j], expected);
+  }
+}
+
+GTEST_TEST(KdTreeTest, Search) {
+  const int size = 2000;
+  PointCloud cloud(size);
+  cloud.mutable_xyzs() = MakeRandomPoints(size, 0);
+  cloud.mutable_xyz(3) = Vector3f(kNaN, 0, 0);
+  cloud.mutable_xyz(7) = Vector3f(0, kInf, 0);
+  KdTree tree(&cloud);
+  EXPECT_EQ(tree.size(), size - 2);
+  EXPECT_EQ(tree.num_threads(), 1);
+  const Matrix3Xf queries = MakeRandomPoints(100, 1);
+  CheckSearches(tree, cloud, queries);
+
+  // The batched searches give the same results on several threads.
+  tree.set_num_threads(4);
+  EXPECT_EQ(tree.num_threads(), 4);
+  CheckSearches(tree, cloud, queries);
+  EXPECT_THROW(tree.set_num_threads(0), std::runtime_error);
+  EXPECT_EQ(tree.num_threads(), 4);
+}
+
+GTEST_TEST(KdTreeTest, FewPoints) {
+  PointCloud cloud(3);
+  // clang-format off
+  cloud.mutable_xyzs() <<
+      0, 1, 2,
+      0, 0, 0,
+      0, 0, 0;
+  // clang-format on
+  const KdTree tree(&cloud);
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  tree.FindNearest(Vector3f(1.9, 0, 0), 5, &indices, &squared_distances);
+  Eigen::VectorXi expected_indices(5);
+  expected_indices << 2, 1, 0, -1, -1;
+  EXPECT_EQ(indices, expected_indices);
+  EXPECT_NEAR(squared_distances(0), 0.01, 1e-6);
+  EXPECT_EQ(squared_distances(4), kInf);
+
+  PointCloud empty(0);
+  const KdTree empty_tree(&empty);
+  std::vector<KdTree::Neighbor> neighbors;
+  empty_tree.FindNearest(Vector3f::Zero(), 1, &neighbors);
+  EXPECT_TRUE(neighbors.empty());
+  empty_tree.FindWithinRadius(Vector3f::Zero(), 1, &neighbors);
+  EXPECT_TRUE(neighbors.empty());
+
+  PointCloud no_xyzs(1, pc_flags::kRGBs);
+  EXPECT_THROW(KdTree{&no_xyzs}, std::runtime_error);
+}
+
+GTEST_TEST(KdTreeTest, Update) {
+  const int size = 1000;
+  PointCloud cloud(size);
+  cloud.mutable_xyzs() = MakeRandomPoints(size, 2);
+  KdTree tree(&cloud, 8);
+  const Matrix3Xf queries = MakeRandomPoints(50, 3);
+
+  // Moves the points in place, including out of the boxes of their nodes.
+  const Eigen::Matrix3f rotation =
+      Eigen::AngleAxisf(0.5, Vector3f::UnitZ()).toRotationMatrix();
+  cloud.mutable_xyzs() = rotation * cloud.xyzs();
+  cloud.mutable_xyz(5) = Vector3f(kNaN, kNaN, kNaN);
+  tree.Refit();
+  CheckSearches(tree, cloud, queries);
+
+  // A point that becomes finite is only found after a rebuild.
+  tree.Rebuild();
+  EXPECT_EQ(tree.size(), size - 1);
+  cloud.mutable_xyz(5) = queries.col(0);
+  tree.Refit();
+  std::vector<KdTree::Neighbor> neighbors;
+  tree.FindNearest(queries.col(0), 1, &neighbors);
+  EXPECT_NE(neighbors[0].index, 5);
+  tree.Rebuild();
+  tree.FindNearest(queries.col(0), 1, &neighbors);
+  EXPECT_EQ(neighbors[0].index, 5);
+
+  // The cloud may only be resized ahead of a rebuild.
+  cloud.resize(size / 2);
+  EXPECT_THROW(tree.Refit(), std::runtime_error);
+  tree.Rebuild();
+  EXPECT_EQ(tree.size(), size / 2);
+  CheckSearches(tree, cloud, queries);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
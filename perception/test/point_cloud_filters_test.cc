@@ -0,0 +1,110 @@
+#include "drake/perception/point_cloud_filters.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/perception/point_cloud_processing.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// A cloud of points on the plane z = 1, with colors.
+PointCloud MakeCloud() {
+  const int size = 100;
+  PointCloud cloud(size, pc_flags::kXYZs | pc_flags::kRGBs);
+  for (int i = 0; i < size; ++i) {
+    cloud.mutable_xyz(i) = Vector3f(0.1 * (i % 10), 0.1 * (i / 10), 1);
+    cloud.mutable_rgb(i).setConstant(i);
+  }
+  return cloud;
+}
+
+// Checks that the output of `dut` for the input `cloud` matches `expected`.
+void CheckOutput(const systems::LeafSystem<double>& dut,
+                 const PointCloud& cloud, const PointCloud& expected) {
+  auto context = dut.CreateDefaultContext();
+  context->FixInputPort(0, Value<PointCloud>(cloud));
+  const auto& output = dut.get_output_port(0).Eval<PointCloud>(*context);
+  ASSERT_EQ(output.fields(), expected.fields());
+  ASSERT_EQ(output.size(), expected.size());
+  EXPECT_TRUE(CompareMatrices(output.xyzs(), expected.xyzs()));
+  if (expected.has_normals()) {
+    EXPECT_TRUE(CompareMatrices(output.normals(), expected.normals()));
+  }
+  if (expected.has_rgbs()) {
+    EXPECT_TRUE((output.rgbs().array() == expected.rgbs().array()).all());
+  }
+}
+
+GTEST_TEST(PointCloudFiltersTest, CropBoxFilter) {
+  const PointCloud cloud = MakeCloud();
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  PointCloud expected(0, fields);
+
+  const CropBoxFilter axis_aligned(Vector3f(0.25, 0.25, 0),
+                                   Vector3f(0.55, 0.55, 2),
+                                   RigidTransformd(), fields);
+  CropBox(cloud, Vector3f(0.25, 0.25, 0), Vector3f(0.55, 0.55, 2), &expected);
+  EXPECT_EQ(expected.size(), 9);
+  CheckOutput(axis_aligned, cloud, expected);
+
+  const RigidTransformd X_CB(RollPitchYawd(0, 0, M_PI / 4),
+                             Vector3d(0.5, 0.5, 1));
+  const CropBoxFilter oriented(Vector3f(-0.2, -0.2, -0.1),
+                               Vector3f(0.2, 0.2, 0.1), X_CB, fields);
+  CropBox(cloud, X_CB, Vector3f(-0.2, -0.2, -0.1), Vector3f(0.2, 0.2, 0.1),
+          &expected);
+  CheckOutput(oriented, cloud, expected);
+}
+
+GTEST_TEST(PointCloudFiltersTest, VoxelGridFilter) {
+  const PointCloud cloud = MakeCloud();
+  const VoxelGridFilter dut(0.25, pc_flags::kXYZs | pc_flags::kRGBs);
+  PointCloud expected(0, cloud.fields());
+  VoxelizedDownSample(cloud, 0.25, &expected);
+  EXPECT_EQ(expected.size(), 16);
+  CheckOutput(dut, cloud, expected);
+
+  EXPECT_THROW(VoxelGridFilter(0), std::runtime_error);
+}
+
+GTEST_TEST(PointCloudFiltersTest, StatisticalOutlierFilter) {
+  PointCloud cloud = MakeCloud();
+  cloud.mutable_xyz(42) = Vector3f(10, 10, 10);
+  const StatisticalOutlierFilter dut(5, 1.0,
+                                     pc_flags::kXYZs | pc_flags::kRGBs, 2);
+  PointCloud expected(0, cloud.fields());
+  RemoveStatisticalOutliers(cloud, 5, 1.0, &expected);
+  EXPECT_LT(expected.size(), cloud.size());
+  CheckOutput(dut, cloud, expected);
+
+  EXPECT_THROW(StatisticalOutlierFilter(0, 1.0), std::runtime_error);
+}
+
+GTEST_TEST(PointCloudFiltersTest, NormalEstimator) {
+  const PointCloud cloud = MakeCloud();
+  const NormalEstimator dut(8, pc_flags::kXYZs | pc_flags::kRGBs, 2);
+  PointCloud expected(
+      0, pc_flags::kXYZs | pc_flags::kRGBs | pc_flags::kNormals);
+  expected.SetFrom(cloud, pc_flags::kXYZs | pc_flags::kRGBs);
+  EstimateNormals(8, &expected);
+  // The plane z = 1 faces the origin along -z.
+  EXPECT_TRUE(CompareMatrices(expected.normal(0), Vector3f(0, 0, -1), 1e-6));
+  CheckOutput(dut, cloud, expected);
+
+  EXPECT_THROW(NormalEstimator(0), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
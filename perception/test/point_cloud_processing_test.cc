@@ -0,0 +1,210 @@
+#include "drake/perception/point_cloud_processing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Matrix3Xf;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+// Returns `size` points drawn uniformly in the unit cube.
+Matrix3Xf MakeRandomPoints(int size, int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> coordinate(0, 1);
+  Matrix3Xf xyzs(3, size);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < 3; ++j) xyzs(j, i) = coordinate(generator);
+  }
+  return xyzs;
+}
+
+GTEST_TEST(PointCloudProcessingTest, CropBox) {
+  PointCloud cloud(5, pc_flags::kXYZs | pc_flags::kRGBs);
+  // clang-format off
+  cloud.mutable_xyzs() <<
+      0.5, 2.0, 0.0, kNaN, kInf,
+      0.5, 0.5, 1.0, 0.5,  0.5,
+      0.5, 0.5, 0.0, 0.5,  0.5;
+  cloud.mutable_rgbs() <<
+      1, 2, 3, 4, 5,
+      1, 2, 3, 4, 5,
+      1, 2, 3, 4, 5;
+  // clang-format on
+  PointCloud output(0, cloud.fields());
+  CropBox(cloud, Vector3f::Zero(), Vector3f::Ones(), &output);
+  ASSERT_EQ(output.size(), 2);
+  EXPECT_TRUE(CompareMatrices(output.xyz(0), cloud.xyz(0)));
+  EXPECT_TRUE(CompareMatrices(output.xyz(1), cloud.xyz(2)));
+  EXPECT_EQ(output.rgb(0), cloud.rgb(0));
+  EXPECT_EQ(output.rgb(1), cloud.rgb(2));
+
+  // The box [0, 1]³ turned a quarter about z and moved to x = 2 contains
+  // the points with 1 ≤ x ≤ 2 and 0 ≤ y ≤ 1.
+  const RigidTransformd X_CB(RollPitchYawd(0, 0, M_PI / 2),
+                             Vector3d(2, 0, 0));
+  CropBox(cloud, X_CB, Vector3f::Zero(), Vector3f::Ones(), &output);
+  ASSERT_EQ(output.size(), 1);
+  EXPECT_TRUE(CompareMatrices(output.xyz(0), cloud.xyz(1)));
+
+  // The output must have the same fields as the input, and differ from it.
+  PointCloud xyz_only(0, pc_flags::kXYZs);
+  EXPECT_THROW(CropBox(cloud, Vector3f::Zero(), Vector3f::Ones(), &xyz_only),
+               std::runtime_error);
+  EXPECT_THROW(CropBox(cloud, Vector3f::Zero(), Vector3f::Ones(), &cloud),
+               std::runtime_error);
+}
+
+GTEST_TEST(PointCloudProcessingTest, VoxelizedDownSample) {
+  PointCloud cloud(5, pc_flags::kXYZs | pc_flags::kNormals | pc_flags::kRGBs);
+  // clang-format off
+  cloud.mutable_xyzs() <<
+      0.1, 1.5, 0.3, 1.7, kNaN,
+      0.1, 0.1, 0.3, 0.3, 0.0,
+      0.1, 0.1, 0.3, 0.1, 0.0;
+  cloud.mutable_normals() <<
+      1, 0, 0, 0, 0,
+      0, 0, 1, 0, 0,
+      0, 1, 0, 1, 1;
+  cloud.mutable_rgbs() <<
+      10, 20, 30, 40, 50,
+      10, 20, 30, 40, 50,
+      10, 20, 30, 40, 50;
+  // clang-format on
+  PointCloud output(0, cloud.fields());
+  VoxelizedDownSample(cloud, 1.0, &output);
+
+  // The voxels are output in the order of their first point.
+  ASSERT_EQ(output.size(), 2);
+  EXPECT_TRUE(CompareMatrices(output.xyz(0), Vector3f(0.2, 0.2, 0.2), 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.xyz(1), Vector3f(1.6, 0.2, 0.1), 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.normal(0),
+                              Vector3f(1, 1, 0).normalized(), 1e-6));
+  EXPECT_TRUE(CompareMatrices(output.normal(1), Vector3f(0, 0, 1), 1e-6));
+  EXPECT_EQ(output.rgb(0), PointCloud::C(20) * Vector3<PointCloud::C>::Ones());
+  EXPECT_EQ(output.rgb(1), PointCloud::C(30) * Vector3<PointCloud::C>::Ones());
+
+  // Each point is in its own voxel.
+  VoxelizedDownSample(cloud, 0.01, &output);
+  EXPECT_EQ(output.size(), 4);
+
+  EXPECT_THROW(VoxelizedDownSample(cloud, 0, &output), std::runtime_error);
+}
+
+GTEST_TEST(PointCloudProcessingTest, RemoveStatisticalOutliers) {
+  const int size = 500;
+  const int num_neighbors = 8;
+  const double std_ratio = 1.0;
+  PointCloud cloud(size + 2);
+  cloud.mutable_xyzs().leftCols(size) = MakeRandomPoints(size, 0);
+  cloud.mutable_xyz(size) = Vector3f(10, 10, 10);
+  cloud.mutable_xyz(size + 1) = Vector3f(kNaN, 0, 0);
+  const auto xyzs = cloud.xyzs();
+
+  // Finds the points to keep by brute force.
+  std::vector<double> mean_distances;
+  for (int i = 0; i <= size; ++i) {
+    std::vector<float> distances;
+    for (int j = 0; j <= size; ++j) {
+      if (j != i) distances.push_back((xyzs.col(i) - xyzs.col(j)).norm());
+    }
+    std::partial_sort(distances.begin(), distances.begin() + num_neighbors,
+                      distances.end());
+    double sum = 0;
+    for (int k = 0; k < num_neighbors; ++k) sum += distances[k];
+    mean_distances.push_back(sum / num_neighbors);
+  }
+  double mean = 0;
+  for (double d : mean_distances) mean += d;
+  mean /= mean_distances.size();
+  double variance = 0;
+  for (double d : mean_distances) variance += (d - mean) * (d - mean);
+  variance /= mean_distances.size() - 1;
+  const double threshold = mean + std_ratio * std::sqrt(variance);
+  std::vector<int> expected;
+  for (int i = 0; i <= size; ++i) {
+    if (mean_distances[i] <= threshold) expected.push_back(i);
+  }
+  // The far point is an outlier.
+  ASSERT_LT(expected.back(), size);
+
+  for (int num_threads : {1, 4}) {
+    PointCloud output(0);
+    RemoveStatisticalOutliers(cloud, num_neighbors, std_ratio, &output,
+                              num_threads);
+    ASSERT_EQ(output.size(), static_cast<int>(expected.size()));
+    for (int i = 0; i < output.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(output.xyz(i), cloud.xyz(expected[i])));
+    }
+  }
+
+  PointCloud output(0);
+  EXPECT_THROW(RemoveStatisticalOutliers(cloud, 0, std_ratio, &output),
+               std::runtime_error);
+  EXPECT_THROW(RemoveStatisticalOutliers(cloud, num_neighbors, std_ratio,
+                                         &output, 0),
+               std::runtime_error);
+}
+
+GTEST_TEST(PointCloudProcessingTest, EstimateNormals) {
+  // Points on a sphere of radius 1 centered at (0, 0, 2), as seen from the
+  // origin, and a point far away from the rest.
+  const int size = 1000;
+  Matrix3Xf directions = MakeRandomPoints(size, 1).array() - 0.5;
+  directions.colwise().normalize();
+  PointCloud cloud(size + 2, pc_flags::kXYZs | pc_flags::kNormals);
+  cloud.mutable_xyzs().leftCols(size) =
+      directions.colwise() + Vector3f(0, 0, 2);
+  cloud.mutable_xyz(size) = Vector3f(kInf, 0, 0);
+  cloud.mutable_xyz(size + 1) = Vector3f(100, 100, 100);
+
+  for (int num_threads : {1, 4}) {
+    cloud.mutable_normals().setZero();
+    EstimateNormals(10, &cloud, num_threads);
+    for (int i = 0; i < size; ++i) {
+      // The normals lie along the radii, towards the origin.
+      const Vector3f normal = cloud.normal(i);
+      const Vector3f p = cloud.xyz(i);
+      EXPECT_NEAR(std::abs(normal.dot(directions.col(i))), 1, 0.05);
+      EXPECT_LE(normal.dot(p), 0);
+    }
+    EXPECT_TRUE(cloud.normal(size).array().isNaN().all());
+  }
+
+  // Three points is the fewest that a normal is estimated from.
+  PointCloud small(3, pc_flags::kXYZs | pc_flags::kNormals);
+  // clang-format off
+  small.mutable_xyzs() <<
+      0, 1, 0,
+      0, 0, 1,
+      1, 1, 1;
+  // clang-format on
+  EstimateNormals(3, &small);
+  EXPECT_TRUE(CompareMatrices(small.normal(0), Vector3f(0, 0, -1), 1e-6));
+  EstimateNormals(2, &small);
+  EXPECT_TRUE(small.normal(0).array().isNaN().all());
+
+  PointCloud no_normals(3);
+  EXPECT_THROW(EstimateNormals(3, &no_normals), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -7,6 +7,8 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/drake_throw.h"
+#include "drake/common/thread_pool.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
@@ -323,6 +325,14 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
+  // Warm-start the children from the solution of this node.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    for (auto* child : {left_child_.get(), right_child_.get()}) {
+      child->prog_->SetInitialGuessForAllVariables(prog_result_->get_x_val());
+      child->prog_->SetInitialGuess(binary_variable,
+                                    child->fixed_binary_value_);
+    }
+  }
   left_child_->solution_result_ = SolveProgramWithSolver(
       *left_child_->prog_, left_child_->solver_id_,
       left_child_->prog_result_.get());
@@ -383,20 +393,38 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes(num_threads_);
+  while (!branching_nodes.empty()) {
+    // Found branching nodes, branch on these nodes. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    if (branching_nodes.size() == 1) {
+      const symbolic::Variable* branching_variable =
+          PickBranchingVariable(*branching_nodes[0]);
+      BranchAndUpdate(branching_nodes[0], *branching_variable);
+    } else {
+      // Only the optimization programs in the children are solved in
+      // parallel; the user-defined functions are all called on this thread.
+      std::vector<const symbolic::Variable*> branching_variables;
+      for (const auto* node : branching_nodes) {
+        branching_variables.push_back(PickBranchingVariable(*node));
+      }
+      thread_pool_->ParallelFor(
+          branching_nodes.size(),
+          [&branching_nodes, &branching_variables](int i) {
+            branching_nodes[i]->Branch(*branching_variables[i]);
+          });
+      for (const auto* node : branching_nodes) {
+        UpdateAfterBranching(*node);
+      }
+    }
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+    branching_nodes = PickBranchingNodes(num_threads_);
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -502,6 +530,59 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickBranchingNode()
   DRAKE_UNREACHABLE();
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(int max_num_nodes) const {
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  MixedIntegerBranchAndBoundNode* first_node = PickBranchingNode();
+  if (first_node == nullptr) {
+    return nodes;
+  }
+  nodes.push_back(first_node);
+  if (max_num_nodes == 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    return nodes;
+  }
+  // Collect the other un-fathomed leaf nodes.
+  std::vector<MixedIntegerBranchAndBoundNode*> candidates;
+  std::vector<const MixedIntegerBranchAndBoundNode*> stack{root_.get()};
+  while (!stack.empty()) {
+    const MixedIntegerBranchAndBoundNode* node = stack.back();
+    stack.pop_back();
+    if (node->IsLeaf()) {
+      if (node != first_node && !IsLeafNodeFathomed(*node)) {
+        candidates.push_back(const_cast<MixedIntegerBranchAndBoundNode*>(node));
+      }
+    } else {
+      stack.push_back(node->right_child());
+      stack.push_back(node->left_child());
+    }
+  }
+  // Order them as the node selection method would have picked them.
+  const auto lower_bound = [](const MixedIntegerBranchAndBoundNode* node) {
+    return node->prog_result()->get_optimal_cost();
+  };
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&lower_bound](const MixedIntegerBranchAndBoundNode* a,
+                                    const MixedIntegerBranchAndBoundNode* b) {
+                       return lower_bound(a) < lower_bound(b);
+                     });
+  } else {
+    DRAKE_DEMAND(node_selection_method_ == NodeSelectionMethod::kDepthFirst);
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->remaining_binary_variables().size() <
+                              b->remaining_binary_variables().size();
+                     });
+  }
+  const int num_candidates =
+      std::min<int>(candidates.size(), max_num_nodes - 1);
+  nodes.insert(nodes.end(), candidates.begin(),
+               candidates.begin() + num_candidates);
+  return nodes;
+}
+
 namespace {
 // Pick the non-fathomed leaf node in the tree with the smallest optimal cost.
 MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
@@ -679,6 +760,11 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
   node->Branch(branching_variable);
+  UpdateAfterBranching(*node);
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranching(
+    const MixedIntegerBranchAndBoundNode& node) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -686,7 +772,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (auto& child : {node.left_child(), node.right_child()}) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
@@ -731,6 +817,15 @@ void MixedIntegerBranchAndBound::UpdateIntegralSolution(
   }
 }
 
+void MixedIntegerBranchAndBound::set_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  num_threads_ = num_threads;
+  thread_pool_.reset();
+  if (num_threads > 1) {
+    thread_pool_ = std::make_shared<drake::internal::ThreadPool>(num_threads);
+  }
+}
+
 bool MixedIntegerBranchAndBound::HasConverged() const {
   if (best_upper_bound_ - best_lower_bound_ <= absolute_gap_tol_) {
     return true;
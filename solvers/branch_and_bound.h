@@ -5,10 +5,15 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
+namespace internal {
+class ThreadPool;
+}  // namespace internal
+
 namespace solvers {
 /**
  * A node in the branch-and-bound (bnb) tree.
@@ -561,6 +566,26 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Sets the number of threads, including the calling thread, on which
+   * Solve() explores the tree. With more than one thread, each iteration of
+   * Solve() branches on up to `num_threads` leaf nodes at once, solving their
+   * children's optimization programs in parallel: the node picked by the node
+   * selection method, followed by the next best un-fathomed leaf nodes in the
+   * order of that method (for NodeSelectionMethod::kUserDefined, only the
+   * user's node is branched). The bounds, the solutions, and the user-defined
+   * callbacks are then updated on the calling thread, one branched node at a
+   * time, so none of the user-defined functions are called concurrently.
+   * The default is 1.
+   * @note The solver passed to the constructor must support solving
+   * different programs concurrently.
+   * @throws std::exception if `num_threads` is not positive.
+   */
+  void set_num_threads(int num_threads);
+
+  /** Getter for the number of threads. */
+  int num_threads() const { return num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -570,6 +595,13 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickBranchingNode() const;
 
+  /**
+   * Pick up to `max_num_nodes` distinct nodes to branch, starting with the one
+   * returned by PickBranchingNode().
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_num_nodes) const;
+
   /**
    * Pick the node with the minimal lower bound.
    */
@@ -595,6 +627,12 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Update the best lower and upper bounds with the children of a node that
+   * has just been branched, and call the callback function on each child.
+   */
+  void UpdateAfterBranching(const MixedIntegerBranchAndBoundNode& node);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -687,6 +725,10 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  int num_threads_{1};
+  // Null iff num_threads_ is 1.
+  std::shared_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 }  // namespace solvers
 }  // namespace drake
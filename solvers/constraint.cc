@@ -3,6 +3,8 @@
 #include <cmath>
 #include <limits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "drake/math/matrix_util.h"
 #include "drake/solvers/symbolic_extraction.h"
@@ -122,11 +124,77 @@ void RotatedLorentzConeConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+LinearConstraint::LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                                   const Eigen::Ref<const Eigen::VectorXd>& ub)
+    : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
+  DRAKE_ASSERT(A.rows() == lb.rows());
+  UpdateGradientSparsityPattern();
+  set_is_thread_safe(true);
+}
+
+void LinearConstraint::UpdateCoefficients(
+    const Eigen::SparseMatrix<double>& new_A,
+    const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+    const Eigen::Ref<const Eigen::VectorXd>& new_ub) {
+  CheckNewCoefficientsDimensions(new_A.rows(), new_A.cols(), new_lb.rows(),
+                                 new_lb.cols(), new_ub.rows(), new_ub.cols());
+  A_.SetFromSparse(new_A);
+  set_num_outputs(A_.rows());
+  set_bounds(new_lb, new_ub);
+  UpdateGradientSparsityPattern();
+}
+
+void LinearConstraint::CheckNewCoefficientsDimensions(int A_rows, int A_cols,
+                                                      int lb_rows, int lb_cols,
+                                                      int ub_rows,
+                                                      int ub_cols) const {
+  if (A_rows != lb_rows || lb_rows != ub_rows || lb_cols != 1 ||
+      ub_cols != 1) {
+    throw std::runtime_error("New constraints have invalid dimensions");
+  }
+
+  if (A_cols != A_.cols()) {
+    throw std::runtime_error("Can't change the number of decision variables");
+  }
+}
+
 template <typename DerivedX, typename ScalarY>
 void LinearConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                      VectorX<ScalarY>* y) const {
   y->resize(num_constraints());
-  (*y) = A_ * x.template cast<ScalarY>();
+  // Use the dense matrix when there is one, which is faster for small and
+  // dense constraints.
+  if (A_.is_dense_constructed()) {
+    (*y) = A_.GetAsDense() * x.template cast<ScalarY>();
+  } else {
+    (*y) = A_.GetAsSparse() * x.template cast<ScalarY>();
+  }
+}
+
+void LinearConstraint::UpdateGradientSparsityPattern() {
+  std::vector<std::pair<int, int>> gradient_sparsity_pattern;
+  // Reads the pattern from whichever form of A is stored, so that a constraint
+  // built from a dense matrix does not build the sparse one.
+  if (A_.is_sparse_constructed()) {
+    const Eigen::SparseMatrix<double>& A = A_.GetAsSparse();
+    gradient_sparsity_pattern.reserve(A.nonZeros());
+    for (int j = 0; j < A.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        if (it.value() != 0) {
+          gradient_sparsity_pattern.emplace_back(it.row(), it.col());
+        }
+      }
+    }
+  } else {
+    const Eigen::MatrixXd& A = A_.GetAsDense();
+    for (int j = 0; j < A.cols(); ++j) {
+      for (int i = 0; i < A.rows(); ++i) {
+        if (A(i, j) != 0) gradient_sparsity_pattern.emplace_back(i, j);
+      }
+    }
+  }
+  SetGradientSparsityPattern(gradient_sparsity_pattern);
 }
 
 void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
@@ -145,6 +213,13 @@ void LinearConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+Eigen::SparseMatrix<double> BoundingBoxConstraint::MakeSparseIdentity(
+    int size) {
+  Eigen::SparseMatrix<double> identity(size, size);
+  identity.setIdentity();
+  return identity;
+}
+
 template <typename DerivedX, typename ScalarY>
 void BoundingBoxConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                           VectorX<ScalarY>* y) const {
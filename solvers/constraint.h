@@ -21,6 +21,7 @@
 #include "drake/solvers/decision_variable.h"
 #include "drake/solvers/evaluator_base.h"
 #include "drake/solvers/function.h"
+#include "drake/solvers/sparse_and_dense_matrix.h"
 
 namespace drake {
 namespace solvers {
@@ -213,6 +214,7 @@ class QuadraticConstraint : public Constraint {
         b_(b) {
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   ~QuadraticConstraint() override {}
@@ -300,6 +302,7 @@ class LorentzConeConstraint : public Constraint {
         b_(b) {
     DRAKE_DEMAND(A_.rows() >= 2);
     DRAKE_ASSERT(A_.rows() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   ~LorentzConeConstraint() override {}
@@ -359,6 +362,7 @@ class RotatedLorentzConeConstraint : public Constraint {
         b_(b) {
     DRAKE_DEMAND(A_.rows() >= 3);
     DRAKE_ASSERT(A_.rows() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   /** Getter for A. */
@@ -409,7 +413,9 @@ class EvaluatorConstraint : public Constraint {
                       Args&&... args)
       : Constraint(evaluator->num_outputs(), evaluator->num_vars(),
                    std::forward<Args>(args)...),
-        evaluator_(evaluator) {}
+        evaluator_(evaluator) {
+    set_is_thread_safe(evaluator->is_thread_safe());
+  }
 
   using Constraint::set_bounds;
   using Constraint::UpdateLowerBound;
@@ -480,6 +486,11 @@ class PolynomialConstraint : public EvaluatorConstraint<PolynomialEvaluator> {
 
 /**
  * Implements a constraint of the form @f$ lb <= Ax <= ub @f$
+ *
+ * A is stored in the form it was given in, by the constructor or by
+ * UpdateCoefficients(). The other form is built when first requested: the
+ * dense matrix by A() for a constraint given a sparse matrix, and the sparse
+ * matrix by get_sparse_A() for a constraint given a dense matrix.
  */
 class LinearConstraint : public Constraint {
  public:
@@ -491,18 +502,44 @@ class LinearConstraint : public Constraint {
                    const Eigen::MatrixBase<DerivedUB>& ub)
       : Constraint(a.rows(), a.cols(), lb, ub), A_(a) {
     DRAKE_ASSERT(a.rows() == lb.rows());
+    UpdateGradientSparsityPattern();
+    set_is_thread_safe(true);
   }
 
+  /**
+   * Constructs the constraint lb <= A * x <= ub from the sparse matrix @p A,
+   * without ever forming its dense counterpart.
+   */
+  LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                   const Eigen::Ref<const Eigen::VectorXd>& ub);
+
   ~LinearConstraint() override {}
 
+  /**
+   * Returns a copy of get_sparse_A().
+   */
   virtual Eigen::SparseMatrix<double> GetSparseMatrix() const {
-    // TODO(eric.cousineau): Consider storing or caching sparse matrix, such
-    // that we can return a const lvalue reference.
-    return A_.sparseView();
+    return get_sparse_A();
+  }
+
+  /**
+   * Returns the matrix A as a sparse matrix, without its zero entries. For a
+   * constraint given a dense matrix, the sparse matrix is built on the first
+   * call.
+   */
+  const Eigen::SparseMatrix<double>& get_sparse_A() const {
+    return A_.GetAsSparse();
   }
+
+  /**
+   * Returns the matrix A as a dense matrix. For a constraint constructed from
+   * a sparse matrix, the dense matrix is built on the first call; prefer
+   * get_sparse_A() for large, sparse constraints.
+   */
   virtual const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& A()
       const {
-    return A_;
+    return A_.GetAsDense();
   }
 
   /**
@@ -519,20 +556,22 @@ class LinearConstraint : public Constraint {
   void UpdateCoefficients(const Eigen::MatrixBase<DerivedA>& new_A,
                           const Eigen::MatrixBase<DerivedL>& new_lb,
                           const Eigen::MatrixBase<DerivedU>& new_ub) {
-    if (new_A.rows() != new_lb.rows() || new_lb.rows() != new_ub.rows() ||
-        new_lb.cols() != 1 || new_ub.cols() != 1) {
-      throw std::runtime_error("New constraints have invalid dimensions");
-    }
-
-    if (new_A.cols() != A_.cols()) {
-      throw std::runtime_error("Can't change the number of decision variables");
-    }
-
-    A_ = new_A;
+    CheckNewCoefficientsDimensions(new_A.rows(), new_A.cols(), new_lb.rows(),
+                                   new_lb.cols(), new_ub.rows(),
+                                   new_ub.cols());
+    A_.SetFromDense(new_A);
     set_num_outputs(A_.rows());
     set_bounds(new_lb, new_ub);
+    UpdateGradientSparsityPattern();
   }
 
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix @p new_A.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& new_A,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_ub);
+
   using Constraint::set_bounds;
   using Constraint::UpdateLowerBound;
   using Constraint::UpdateUpperBound;
@@ -547,12 +586,21 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
+  internal::SparseAndDenseMatrix A_;
 
  private:
   template <typename DerivedX, typename ScalarY>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                      VectorX<ScalarY>* y) const;
+
+  // Throws if new coefficients of the given dimensions cannot replace those of
+  // this constraint.
+  void CheckNewCoefficientsDimensions(int A_rows, int A_cols, int lb_rows,
+                                      int lb_cols, int ub_rows,
+                                      int ub_cols) const;
+
+  // Sets the gradient sparsity pattern to the nonzero entries of A.
+  void UpdateGradientSparsityPattern();
 };
 
 /**
@@ -571,6 +619,13 @@ class LinearEqualityConstraint : public LinearConstraint {
                            double beq)
       : LinearEqualityConstraint(a, Vector1d(beq)) {}
 
+  /**
+   * Constructs the constraint Aeq * x = beq from the sparse matrix @p Aeq.
+   */
+  LinearEqualityConstraint(const Eigen::SparseMatrix<double>& Aeq,
+                           const Eigen::Ref<const Eigen::VectorXd>& beq)
+      : LinearConstraint(Aeq, beq, beq) {}
+
   ~LinearEqualityConstraint() override {}
 
   /*
@@ -586,6 +641,14 @@ class LinearEqualityConstraint : public LinearConstraint {
     LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
   }
 
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix @p Aeq.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& Aeq,
+                          const Eigen::Ref<const Eigen::VectorXd>& beq) {
+    LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
+  }
+
  private:
   /**
    * The user should not call this function. Call UpdateCoefficients(Aeq, beq)
@@ -617,12 +680,13 @@ class BoundingBoxConstraint : public LinearConstraint {
   template <typename DerivedLB, typename DerivedUB>
   BoundingBoxConstraint(const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub)
-      : LinearConstraint(Eigen::MatrixXd::Identity(lb.rows(), lb.rows()), lb,
-                         ub) {}
+      : LinearConstraint(MakeSparseIdentity(lb.rows()), lb, ub) {}
 
   ~BoundingBoxConstraint() override {}
 
  private:
+  static Eigen::SparseMatrix<double> MakeSparseIdentity(int size);
+
   template <typename DerivedX, typename ScalarY>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                      VectorX<ScalarY>* y) const;
@@ -30,11 +30,57 @@ void LinearCost::DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
   DoEvalGeneric(x, y);
 }
 
+namespace {
+// Returns (Q + Qᵀ) / 2.
+Eigen::SparseMatrix<double> Symmetrize(const Eigen::SparseMatrix<double>& Q) {
+  const Eigen::SparseMatrix<double> Q_transpose = Q.transpose();
+  return (Q + Q_transpose) / 2;
+}
+}  // namespace
+
+QuadraticCost::QuadraticCost(const Eigen::SparseMatrix<double>& Q,
+                             const Eigen::Ref<const Eigen::VectorXd>& b,
+                             double c)
+    : Cost(Q.rows()), Q_(Symmetrize(Q)), b_(b), c_(c) {
+  DRAKE_ASSERT(Q_.rows() == Q_.cols());
+  DRAKE_ASSERT(Q_.cols() == b_.rows());
+}
+
+void QuadraticCost::UpdateCoefficients(
+    const Eigen::SparseMatrix<double>& new_Q,
+    const Eigen::Ref<const Eigen::VectorXd>& new_b, double new_c) {
+  CheckNewCoefficientsDimensions(new_Q.rows(), new_Q.cols(), new_b.rows(),
+                                 new_b.cols());
+  Q_.SetFromSparse(Symmetrize(new_Q));
+  b_ = new_b;
+  c_ = new_c;
+}
+
+void QuadraticCost::CheckNewCoefficientsDimensions(int Q_rows, int Q_cols,
+                                                   int b_rows,
+                                                   int b_cols) const {
+  if (Q_rows != Q_cols || Q_rows != b_rows || b_cols != 1) {
+    throw std::runtime_error("New constraints have invalid dimensions");
+  }
+
+  if (b_rows != b_.rows()) {
+    throw std::runtime_error("Can't change the number of decision variables");
+  }
+}
+
 template <typename DerivedX, typename U>
 void QuadraticCost::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                   VectorX<U>* y) const {
   y->resize(1);
-  *y = .5 * x.transpose() * Q_ * x + b_.transpose() * x;
+  // Use the dense matrix when there is one, which is faster for small and
+  // dense costs.
+  if (Q_.is_dense_constructed()) {
+    *y = .5 * x.transpose() * Q_.GetAsDense() * x + b_.transpose() * x;
+  } else {
+    const VectorX<U> x_cast = x.template cast<U>();
+    const VectorX<U> Qx = Q_.GetAsSparse() * x_cast;
+    *y = .5 * x_cast.transpose() * Qx + b_.transpose() * x_cast;
+  }
   (*y)(0) += c_;
 }
 
@@ -10,6 +10,7 @@
 #include <Eigen/SparseCore>
 
 #include "drake/solvers/evaluator_base.h"
+#include "drake/solvers/sparse_and_dense_matrix.h"
 
 namespace drake {
 namespace solvers {
@@ -96,6 +97,11 @@ class LinearCost : public Cost {
 
 /**
  * Implements a cost of the form @f[ .5 x'Qx + b'x + c @f].
+ *
+ * Q is stored in the form it was given in, by the constructor or by
+ * UpdateCoefficients(). The other form is built when first requested: the
+ * dense matrix by Q() for a cost given a sparse matrix, and the sparse matrix
+ * by get_sparse_Q() for a cost given a dense matrix.
  */
 class QuadraticCost : public Cost {
  public:
@@ -115,10 +121,26 @@ class QuadraticCost : public Cost {
     DRAKE_ASSERT(Q_.cols() == b_.rows());
   }
 
+  /**
+   * Constructs a cost of the form @f[ .5 x'Qx + b'x + c @f] from the sparse
+   * matrix @p Q, without ever forming its dense counterpart.
+   */
+  QuadraticCost(const Eigen::SparseMatrix<double>& Q,
+                const Eigen::Ref<const Eigen::VectorXd>& b, double c = 0.);
+
   ~QuadraticCost() override {}
 
-  /// Returns the symmetric matrix Q, as the Hessian of the cost.
-  const Eigen::MatrixXd& Q() const { return Q_; }
+  /// Returns the symmetric matrix Q, as the Hessian of the cost. For a cost
+  /// constructed from a sparse matrix, the dense matrix is built on the first
+  /// call; prefer get_sparse_Q() for large, sparse costs.
+  const Eigen::MatrixXd& Q() const { return Q_.GetAsDense(); }
+
+  /// Returns the symmetric matrix Q as a sparse matrix, without its zero
+  /// entries. For a cost given a dense matrix, the sparse matrix is built on
+  /// the first call.
+  const Eigen::SparseMatrix<double>& get_sparse_Q() const {
+    return Q_.GetAsSparse();
+  }
 
   const Eigen::VectorXd& b() const { return b_; }
 
@@ -135,20 +157,20 @@ class QuadraticCost : public Cost {
   void UpdateCoefficients(const Eigen::MatrixBase<DerivedQ>& new_Q,
                           const Eigen::MatrixBase<DerivedB>& new_b,
                           double new_c = 0.) {
-    if (new_Q.rows() != new_Q.cols() || new_Q.rows() != new_b.rows() ||
-        new_b.cols() != 1) {
-      throw std::runtime_error("New constraints have invalid dimensions");
-    }
-
-    if (new_b.rows() != b_.rows()) {
-      throw std::runtime_error("Can't change the number of decision variables");
-    }
-
-    Q_ = (new_Q + new_Q.transpose()) / 2;
+    CheckNewCoefficientsDimensions(new_Q.rows(), new_Q.cols(), new_b.rows(),
+                                   new_b.cols());
+    Q_.SetFromDense((new_Q + new_Q.transpose()) / 2);
     b_ = new_b;
     c_ = new_c;
   }
 
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix @p new_Q.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& new_Q,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_b,
+                          double new_c = 0.);
+
  private:
   template <typename DerivedX, typename U>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x, VectorX<U>* y) const;
@@ -162,7 +184,12 @@ class QuadraticCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
-  Eigen::MatrixXd Q_;
+  // Throws if new coefficients of the given dimensions cannot replace those of
+  // this cost.
+  void CheckNewCoefficientsDimensions(int Q_rows, int Q_cols, int b_rows,
+                                      int b_cols) const;
+
+  internal::SparseAndDenseMatrix Q_;
   Eigen::VectorXd b_;
   double c_{};
 };
@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <cmath>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "drake/common/symbolic.h"
 #include "drake/math/quadratic_form.h"
@@ -29,60 +32,102 @@ using symbolic::Polynomial;
 using symbolic::Variable;
 using symbolic::Variables;
 
+using internal::DecomposeAffineExpression;
 using internal::DecomposeLinearExpression;
 using internal::DecomposeQuadraticPolynomial;
-using internal::ExtractAndAppendVariablesFromExpression;
 using internal::ExtractVariablesFromExpression;
+using internal::SparseAffineExpression;
 using internal::SymbolicError;
 
 
+namespace {
+// Assigns indices to the variables of the expressions @p affine in the order
+// in which they first appear, and lowers the expressions to
+// `A * vars + constant`.
+void LowerAffineExpressions(const vector<SparseAffineExpression>& affine,
+                            Eigen::SparseMatrix<double>* A,
+                            Eigen::VectorXd* constant,
+                            VectorXDecisionVariable* vars) {
+  const int num_rows = affine.size();
+  unordered_map<Variable::Id, int> map_var_to_index;
+  vector<Variable> var_list;
+  vector<Eigen::Triplet<double>> triplets;
+  constant->resize(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    (*constant)(i) = affine[i].constant_term;
+    for (const auto& term : affine[i].linear_terms) {
+      const Variable& var = term.first;
+      const double coeff = term.second;
+      const auto insertion =
+          map_var_to_index.emplace(var.get_id(), var_list.size());
+      if (insertion.second) {
+        var_list.push_back(var);
+      }
+      if (coeff != 0) {
+        triplets.emplace_back(i, insertion.first->second, coeff);
+      }
+    }
+  }
+  vars->resize(var_list.size());
+  for (int j = 0; j < vars->size(); ++j) {
+    (*vars)(j) = var_list[j];
+  }
+  A->resize(num_rows, var_list.size());
+  A->setFromTriplets(triplets.begin(), triplets.end());
+}
+
+// Returns the number of variables of @p affine with a nonzero coefficient.
+int CountNonzeroTerms(const SparseAffineExpression& affine) {
+  return std::count_if(affine.linear_terms.begin(), affine.linear_terms.end(),
+                       [](const std::pair<Variable, double>& term) {
+                         return term.second != 0;
+                       });
+}
+
+Binding<LinearEqualityConstraint> DoParseLinearEqualityConstraint(
+    const vector<SparseAffineExpression>& affine,
+    const Eigen::Ref<const Eigen::VectorXd>& b) {
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd constant;
+  VectorXDecisionVariable vars;
+  LowerAffineExpressions(affine, &A, &constant, &vars);
+  return CreateBinding(make_shared<LinearEqualityConstraint>(A, b - constant),
+                       vars);
+}
+}  // namespace
+
 Binding<Constraint> ParseConstraint(
     const Eigen::Ref<const VectorX<Expression>>& v,
     const Eigen::Ref<const Eigen::VectorXd>& lb,
     const Eigen::Ref<const Eigen::VectorXd>& ub) {
   DRAKE_ASSERT(v.rows() == lb.rows() && v.rows() == ub.rows());
 
-  bool is_linear = true;
-  // Check that all elements are linear.
+  // Check that all elements are linear, decomposing them on the way.
+  vector<SparseAffineExpression> affine(v.size());
   for (int i = 0; i < v.size(); ++i) {
-    if (!v(i).is_polynomial()) {
-      is_linear = false;
-      break;
+    if (!DecomposeAffineExpression(v(i), &affine[i])) {
+      auto constraint = make_shared<ExpressionConstraint>(v, lb, ub);
+      return CreateBinding(constraint, constraint->vars());
     }
-    const Polynomial p{v(i)};
-    if (p.TotalDegree() > 1) {
-      is_linear = false;
-      break;
-    }
-  }
-  if (!is_linear) {
-    auto constraint = make_shared<ExpressionConstraint>(v, lb, ub);
-    return CreateBinding(constraint, constraint->vars());
   }  // else, continue on to linear-specific version below.
 
   if ((ub-lb).isZero()) {
-    return ParseLinearEqualityConstraint(v, lb);
-  }
-
-  // Setup map_var_to_index and var_vec.
-  // such that map_var_to_index[var(i)] = i
-  unordered_map<Variable::Id, int> map_var_to_index;
-  VectorXDecisionVariable vars(0);
-  for (int i = 0; i < v.size(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), &vars, &map_var_to_index);
+    return DoParseLinearEqualityConstraint(affine, lb);
   }
 
-  // Construct A, new_lb, new_ub. map_var_to_index is used here.
-  Eigen::MatrixXd A{Eigen::MatrixXd::Zero(v.size(), vars.size())};
+  // Construct A, new_lb, new_ub.
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd constant;
+  VectorXDecisionVariable vars;
+  LowerAffineExpressions(affine, &A, &constant, &vars);
   Eigen::VectorXd new_lb{v.size()};
   Eigen::VectorXd new_ub{v.size()};
   // We will determine if lb <= v <= ub is a bounding box constraint, namely
   // x_lb <= x <= x_ub.
   bool is_v_bounding_box = true;
   for (int i = 0; i < v.size(); ++i) {
-    double constant_term = 0;
-    int num_vi_variables = DecomposeLinearExpression(v(i), map_var_to_index,
-                                                     A.row(i), &constant_term);
+    const double constant_term = constant(i);
+    const int num_vi_variables = CountNonzeroTerms(affine[i]);
     if (num_vi_variables == 0 &&
         !(lb(i) <= constant_term && constant_term <= ub(i))) {
       // Unsatisfiable constraint with no variables, such as 1 <= 0 <= 2
@@ -107,11 +152,10 @@ Binding<Constraint> ParseConstraint(
     for (int i = 0; i < v.size(); ++i) {
       // v(i) is in the form of c * x
       double x_coeff = 0;
-      for (const auto& x : v(i).GetVariables()) {
-        const double coeff = A(i, map_var_to_index[x.get_id()]);
-        if (coeff != 0) {
-          x_coeff += coeff;
-          bounding_box_x(i) = x;
+      for (const auto& term : affine[i].linear_terms) {
+        if (term.second != 0) {
+          x_coeff += term.second;
+          bounding_box_x(i) = term.first;
         }
       }
       if (x_coeff > 0) {
@@ -134,30 +178,23 @@ Binding<Constraint> ParseConstraint(
 
 std::unique_ptr<Binding<Constraint>> MaybeParseLinearConstraint(
     const symbolic::Expression& e, double lb, double ub) {
-  if (!e.is_polynomial()) {
-    return std::unique_ptr<Binding<Constraint>>{nullptr};
-  }
-  const Polynomial p{e};
-  if (p.TotalDegree() > 1) {
+  SparseAffineExpression affine;
+  if (!DecomposeAffineExpression(e, &affine)) {
     return std::unique_ptr<Binding<Constraint>>{nullptr};
   }
-  // If p only has one indeterminates, then we can always return a bounding box
+  // Drop the variables whose terms cancel.
+  affine.linear_terms.erase(
+      std::remove_if(affine.linear_terms.begin(), affine.linear_terms.end(),
+                     [](const std::pair<Variable, double>& term) {
+                       return term.second == 0;
+                     }),
+      affine.linear_terms.end());
+  // If e only has one variable, then we can always return a bounding box
   // constraint.
-  if (p.indeterminates().size() == 1) {
-    // We decompose the polynomial `p` into `constant_term + coeff * var`.
-    double coeff = 0;
-    double constant_term = 0;
-    for (const auto& term : p.monomial_to_coefficient_map()) {
-      if (term.first.total_degree() == 0) {
-        constant_term += get_constant_value(term.second);
-      } else {
-        coeff += get_constant_value(term.second);
-      }
-    }
-    // coeff should not be 0. The symbolic polynomial should be able to detect
-    // when the coefficient is 0, and remove it from
-    // monomial_to_coefficient_map.
-    DRAKE_DEMAND(coeff != 0);
+  if (affine.linear_terms.size() == 1) {
+    // e is `constant_term + coeff * var`.
+    const double coeff = affine.linear_terms[0].second;
+    const double constant_term = affine.constant_term;
     double var_lower{}, var_upper{};
     if (coeff > 0) {
       var_lower = (lb - constant_term) / coeff;
@@ -169,30 +206,17 @@ std::unique_ptr<Binding<Constraint>> MaybeParseLinearConstraint(
     return std::make_unique<Binding<Constraint>>(
         std::make_shared<BoundingBoxConstraint>(Vector1d(var_lower),
                                                 Vector1d(var_upper)),
-        Vector1<symbolic::Variable>(*(p.indeterminates().begin())));
-  }
-  VectorX<symbolic::Variable> bound_variables(p.indeterminates().size());
-  std::unordered_map<symbolic::Variable::Id, int> map_var_to_index;
-  int index = 0;
-  for (const auto& var : p.indeterminates()) {
-    bound_variables(index) = var;
-    map_var_to_index.emplace(var.get_id(), index++);
+        Vector1<symbolic::Variable>(affine.linear_terms[0].first));
   }
-  Eigen::RowVectorXd a(p.indeterminates().size());
-  a.setZero();
-  double lower = lb;
-  double upper = ub;
-  for (const auto& term : p.monomial_to_coefficient_map()) {
-    if (term.first.total_degree() == 0) {
-      const double coeff = get_constant_value(term.second);
-      lower -= coeff;
-      upper -= coeff;
-    } else {
-      const int var_index =
-          map_var_to_index.at(term.first.GetVariables().begin()->get_id());
-      a(var_index) = get_constant_value(term.second);
-    }
+  const int num_variables = affine.linear_terms.size();
+  VectorX<symbolic::Variable> bound_variables(num_variables);
+  Eigen::RowVectorXd a(num_variables);
+  for (int i = 0; i < num_variables; ++i) {
+    bound_variables(i) = affine.linear_terms[i].first;
+    a(i) = affine.linear_terms[i].second;
   }
+  const double lower = lb - affine.constant_term;
+  const double upper = ub - affine.constant_term;
   if (lower == upper) {
     return std::make_unique<Binding<Constraint>>(
         std::make_shared<LinearEqualityConstraint>(a, Vector1d(lower)),
@@ -326,11 +350,6 @@ Binding<Constraint> ParseConstraint(const set<Formula>& formulas) {
   Eigen::VectorXd lb{n};
   Eigen::VectorXd ub{n};
   int i{0};  // index variable used in the loop
-  // After the following loop, we call `ParseLinearEqualityConstraint`
-  // if `are_all_formulas_equal` is still true. Otherwise, we call
-  // `ParseLinearConstraint`.  on the value of this Boolean flag.
-  bool are_all_formulas_equal{true};
-  bool is_linear{true};
   for (const Formula& f : formulas) {
     if (is_equal_to(f)) {
       // f := (lhs == rhs)
@@ -344,14 +363,12 @@ Binding<Constraint> ParseConstraint(const set<Formula>& formulas) {
       const Expression& rhs = get_rhs_expression(f);
       lb(i) = -numeric_limits<double>::infinity();
       FindBound(lhs, rhs, &v(i), &ub(i));
-      are_all_formulas_equal = false;
     } else if (is_greater_than_or_equal_to(f)) {
       // f := (lhs >= rhs)
       const Expression& lhs = get_lhs_expression(f);
       const Expression& rhs = get_rhs_expression(f);
       lb(i) = -numeric_limits<double>::infinity();
       FindBound(rhs, lhs, &v(i), &ub(i));
-      are_all_formulas_equal = false;
     } else {
       ostringstream oss;
       oss << "ParseConstraint(const set<Formula>& "
@@ -361,25 +378,11 @@ Binding<Constraint> ParseConstraint(const set<Formula>& formulas) {
           << "operators.";
       throw runtime_error(oss.str());
     }
-
-    // Check that elements are linear.
-    if (is_linear) {
-      if (!v(i).is_polynomial()) {
-        is_linear = false;
-      } else {
-        const Polynomial p{v(i)};
-        if (p.TotalDegree() > 1) {
-          is_linear = false;
-        }
-      }
-    }
     ++i;
   }
-  if (are_all_formulas_equal && is_linear) {
-    return ParseLinearEqualityConstraint(v, lb);
-  } else {
-    return ParseConstraint(v, lb, ub);
-  }
+  // ParseConstraint() returns a linear equality constraint if all the formulas
+  // are linear equalities.
+  return ParseConstraint(v, lb, ub);
 }
 
 Binding<Constraint> ParseConstraint(const Formula& f) {
@@ -461,20 +464,15 @@ Binding<LinearEqualityConstraint> DoParseLinearEqualityConstraint(
     const Eigen::Ref<const VectorX<Expression>>& v,
     const Eigen::Ref<const Eigen::VectorXd>& b) {
   DRAKE_DEMAND(v.rows() == b.rows());
-  VectorXDecisionVariable vars(0);
-  unordered_map<Variable::Id, int> map_var_to_index;
+  vector<SparseAffineExpression> affine(v.rows());
   for (int i = 0; i < v.rows(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), &vars, &map_var_to_index);
-  }
-  // TODO(hongkai.dai): use sparse matrix.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(v.rows(), vars.rows());
-  Eigen::VectorXd beq = Eigen::VectorXd::Zero(v.rows());
-  for (int i = 0; i < v.rows(); ++i) {
-    double constant_term(0);
-    DecomposeLinearExpression(v(i), map_var_to_index, A.row(i), &constant_term);
-    beq(i) = b(i) - constant_term;
+    if (!DecomposeAffineExpression(v(i), &affine[i])) {
+      ostringstream oss;
+      oss << "Expression " << v(i) << " is non-linear.";
+      throw runtime_error(oss.str());
+    }
   }
-  return CreateBinding(make_shared<LinearEqualityConstraint>(A, beq), vars);
+  return DoParseLinearEqualityConstraint(affine, b);
 }
 
 Binding<QuadraticConstraint> ParseQuadraticConstraint(
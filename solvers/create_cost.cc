@@ -1,8 +1,10 @@
 #include "drake/solvers/create_cost.h"
 
 #include <algorithm>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "drake/common/unused.h"
@@ -15,9 +17,11 @@ namespace internal {
 using std::make_shared;
 using std::numeric_limits;
 using std::ostringstream;
+using std::pair;
 using std::runtime_error;
 using std::set;
 using std::shared_ptr;
+using std::tuple;
 using std::unordered_map;
 using std::vector;
 
@@ -25,54 +29,124 @@ using symbolic::Expression;
 using symbolic::Formula;
 using symbolic::Variable;
 
-using internal::DecomposeLinearExpression;
-using internal::DecomposeQuadraticPolynomial;
-using internal::ExtractAndAppendVariablesFromExpression;
-using internal::ExtractVariablesFromExpression;
-using internal::SymbolicError;
+using internal::DecomposeAffineExpression;
+using internal::DecomposeQuadraticExpression;
+using internal::SparseAffineExpression;
+using internal::SparseQuadraticExpression;
 
 namespace {
 
+// Returns the variables of @p quadratic sorted by ID, which are the variables
+// of the expression it was decomposed from, together with the map from their
+// ID to their index.
+pair<VectorXDecisionVariable, unordered_map<Variable::Id, int>>
+ExtractVariables(const SparseQuadraticExpression& quadratic) {
+  vector<Variable> var_list;
+  var_list.reserve(quadratic.linear_terms.size() +
+                   2 * quadratic.quadratic_terms.size());
+  for (const auto& term : quadratic.linear_terms) {
+    var_list.push_back(term.first);
+  }
+  for (const auto& term : quadratic.quadratic_terms) {
+    var_list.push_back(std::get<0>(term));
+    var_list.push_back(std::get<1>(term));
+  }
+  std::sort(var_list.begin(), var_list.end(),
+            [](const Variable& x, const Variable& y) {
+              return x.get_id() < y.get_id();
+            });
+  var_list.erase(std::unique(var_list.begin(), var_list.end(),
+                             [](const Variable& x, const Variable& y) {
+                               return x.get_id() == y.get_id();
+                             }),
+                 var_list.end());
+  VectorXDecisionVariable vars(var_list.size());
+  unordered_map<Variable::Id, int> map_var_to_index;
+  map_var_to_index.reserve(var_list.size());
+  for (int i = 0; i < vars.size(); ++i) {
+    vars(i) = var_list[i];
+    map_var_to_index.emplace(vars(i).get_id(), i);
+  }
+  return std::make_pair(vars, map_var_to_index);
+}
+
 Binding<QuadraticCost> DoParseQuadraticCost(
-    const symbolic::Polynomial& poly, const VectorXDecisionVariable& vars_vec,
-    const unordered_map<Variable::Id, int>& map_var_to_index) {
+    const SparseQuadraticExpression& quadratic) {
+  VectorXDecisionVariable vars_vec;
+  unordered_map<Variable::Id, int> map_var_to_index;
+  std::tie(vars_vec, map_var_to_index) = ExtractVariables(quadratic);
   // We want to write the expression e in the form 0.5 * x' * Q * x + b' * x + c
-  // TODO(hongkai.dai): use a sparse matrix to represent Q and b.
-  Eigen::MatrixXd Q(vars_vec.size(), vars_vec.size());
-  Eigen::VectorXd b(vars_vec.size());
-  double constant_term;
-  DecomposeQuadraticPolynomial(poly, map_var_to_index, &Q, &b, &constant_term);
-  return CreateBinding(make_shared<QuadraticCost>(Q, b, constant_term),
-                       vars_vec);
+  std::vector<Eigen::Triplet<double>> Q_triplets;
+  Q_triplets.reserve(2 * quadratic.quadratic_terms.size());
+  Eigen::VectorXd b = Eigen::VectorXd::Zero(vars_vec.size());
+  for (const auto& term : quadratic.quadratic_terms) {
+    const int x_index = map_var_to_index.at(std::get<0>(term).get_id());
+    const int y_index = map_var_to_index.at(std::get<1>(term).get_id());
+    const double coeff = std::get<2>(term);
+    if (x_index == y_index) {
+      // quadratic term a * x^2
+      Q_triplets.emplace_back(x_index, x_index, 2 * coeff);
+    } else {
+      // cross term a * x * y
+      Q_triplets.emplace_back(x_index, y_index, coeff);
+      Q_triplets.emplace_back(y_index, x_index, coeff);
+    }
+  }
+  Eigen::SparseMatrix<double> Q(vars_vec.size(), vars_vec.size());
+  Q.setFromTriplets(Q_triplets.begin(), Q_triplets.end());
+  for (const auto& term : quadratic.linear_terms) {
+    b(map_var_to_index.at(term.first.get_id())) += term.second;
+  }
+  return CreateBinding(
+      make_shared<QuadraticCost>(Q, b, quadratic.constant_term), vars_vec);
 }
 
 Binding<LinearCost> DoParseLinearCost(
-    const Expression &e,
-    const VectorXDecisionVariable& vars_vec,
-    const unordered_map<Variable::Id, int>& map_var_to_index) {
-  Eigen::RowVectorXd c(vars_vec.size());
-  double constant_term{};
-  DecomposeLinearExpression(e, map_var_to_index, c, &constant_term);
-  return CreateBinding(make_shared<LinearCost>(c.transpose(), constant_term),
+    const SparseQuadraticExpression& quadratic) {
+  VectorXDecisionVariable vars_vec;
+  unordered_map<Variable::Id, int> map_var_to_index;
+  std::tie(vars_vec, map_var_to_index) = ExtractVariables(quadratic);
+  Eigen::VectorXd c = Eigen::VectorXd::Zero(vars_vec.size());
+  for (const auto& term : quadratic.linear_terms) {
+    c(map_var_to_index.at(term.first.get_id())) += term.second;
+  }
+  return CreateBinding(make_shared<LinearCost>(c, quadratic.constant_term),
                        vars_vec);
 }
 
+// Returns true if @p quadratic has a nonzero quadratic term.
+bool HasQuadraticTerm(const SparseQuadraticExpression& quadratic) {
+  return std::any_of(quadratic.quadratic_terms.begin(),
+                     quadratic.quadratic_terms.end(),
+                     [](const tuple<Variable, Variable, double>& term) {
+                       return std::get<2>(term) != 0;
+                     });
+}
+
 }  // anonymous namespace
 
 Binding<LinearCost> ParseLinearCost(const Expression& e) {
-  auto p = ExtractVariablesFromExpression(e);
-  return DoParseLinearCost(e, p.first, p.second);
+  SparseAffineExpression affine;
+  if (!DecomposeAffineExpression(e, &affine)) {
+    ostringstream oss;
+    oss << "Expression " << e << " is non-linear.";
+    throw runtime_error(oss.str());
+  }
+  SparseQuadraticExpression quadratic;
+  quadratic.constant_term = affine.constant_term;
+  quadratic.linear_terms = std::move(affine.linear_terms);
+  return DoParseLinearCost(quadratic);
 }
 
 Binding<QuadraticCost> ParseQuadraticCost(const Expression& e) {
-  // First build an Eigen vector, that contains all the bound variables.
-  auto p = ExtractVariablesFromExpression(e);
-  const auto& vars_vec = p.first;
-  const auto& map_var_to_index = p.second;
-
-  // Now decomposes the expression into coefficients and monomials.
-  const symbolic::Polynomial poly{e};
-  return DoParseQuadraticCost(poly, vars_vec, map_var_to_index);
+  // Decomposes the expression into its constant, linear and quadratic terms.
+  SparseQuadraticExpression quadratic;
+  if (!DecomposeQuadraticExpression(e, &quadratic)) {
+    ostringstream oss;
+    oss << "Expression " << e << " is not a quadratic polynomial.";
+    throw runtime_error(oss.str());
+  }
+  return DoParseQuadraticCost(quadratic);
 }
 
 Binding<PolynomialCost> ParsePolynomialCost(const symbolic::Expression& e) {
@@ -105,18 +179,13 @@ Binding<Cost> ParseCost(const symbolic::Expression& e) {
         << " support non-polynomial expression.\n";
     throw runtime_error(oss.str());
   }
-  const symbolic::Polynomial poly{e};
-  const int total_degree{poly.TotalDegree()};
-  auto e_extracted = ExtractVariablesFromExpression(e);
-  const VectorXDecisionVariable& vars_vec = e_extracted.first;
-  const auto& map_var_to_index = e_extracted.second;
-
-  if (total_degree > 2) {
+  SparseQuadraticExpression quadratic;
+  if (!DecomposeQuadraticExpression(e, &quadratic)) {
     return ParsePolynomialCost(e);
-  } else if (total_degree == 2) {
-    return DoParseQuadraticCost(poly, vars_vec, map_var_to_index);
+  } else if (HasQuadraticTerm(quadratic)) {
+    return DoParseQuadraticCost(quadratic);
   } else {
-    return DoParseLinearCost(e, vars_vec, map_var_to_index);
+    return DoParseLinearCost(quadratic);
   }
 }
 
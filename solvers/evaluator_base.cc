@@ -1,5 +1,9 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <vector>
+
+#include <fmt/format.h>
+
 using std::make_shared;
 using std::shared_ptr;
 using Eigen::MatrixXd;
@@ -8,6 +12,75 @@ using Eigen::VectorXd;
 namespace drake {
 namespace solvers {
 
+void EvaluatorBase::SetGradientSparsityPattern(
+    const std::vector<std::pair<int, int>>& gradient_sparsity_pattern) {
+  for (const auto& nonzero : gradient_sparsity_pattern) {
+    if (nonzero.first < 0 || nonzero.first >= num_outputs_ ||
+        nonzero.second < 0 ||
+        (num_vars_ != Eigen::Dynamic && nonzero.second >= num_vars_)) {
+      throw std::invalid_argument(fmt::format(
+          "EvaluatorBase::SetGradientSparsityPattern(): entry ({}, {}) is "
+          "out of range for a gradient of size {} x {}.",
+          nonzero.first, nonzero.second, num_outputs_, num_vars_));
+    }
+  }
+  gradient_sparsity_pattern_ = gradient_sparsity_pattern;
+}
+
+namespace internal {
+int EvalSparseGradient(const EvaluatorBase& evaluator,
+                       const Eigen::Ref<const Eigen::VectorXd>& x, double* y,
+                       double* gradient) {
+  const auto& pattern = evaluator.gradient_sparsity_pattern();
+  const int num_vars = x.rows();
+
+  // derivative_index[j] is the index of x(j) among the variables to
+  // differentiate with respect to, or -1 if ∂y/∂x(j) is structurally zero.
+  std::vector<int> derivative_index(num_vars, -1);
+  int num_derivatives = 0;
+  if (pattern) {
+    for (const auto& nonzero : *pattern) {
+      int& index = derivative_index[nonzero.second];
+      if (index < 0) index = num_derivatives++;
+    }
+  } else {
+    for (int j = 0; j < num_vars; ++j) derivative_index[j] = num_derivatives++;
+  }
+
+  AutoDiffVecXd tx(num_vars);
+  for (int j = 0; j < num_vars; ++j) {
+    tx(j).value() = x(j);
+    tx(j).derivatives() = Eigen::VectorXd::Zero(num_derivatives);
+    if (derivative_index[j] >= 0) tx(j).derivatives()(derivative_index[j]) = 1;
+  }
+  AutoDiffVecXd ty(evaluator.num_outputs());
+  evaluator.Eval(tx, &ty);
+
+  // An output that does not depend on x may have empty derivatives.
+  auto derivative = [&ty](int i, int index) {
+    return ty(i).derivatives().size() == 0 ? 0.0
+                                           : ty(i).derivatives()(index);
+  };
+  for (int i = 0; i < ty.rows(); ++i) {
+    y[i] = ty(i).value();
+  }
+  int num_entries = 0;
+  if (pattern) {
+    for (const auto& nonzero : *pattern) {
+      gradient[num_entries++] =
+          derivative(nonzero.first, derivative_index[nonzero.second]);
+    }
+  } else {
+    for (int i = 0; i < ty.rows(); ++i) {
+      for (int j = 0; j < num_vars; ++j) {
+        gradient[num_entries++] = derivative(i, j);
+      }
+    }
+  }
+  return num_entries;
+}
+}  // namespace internal
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                  Eigen::VectorXd* y) const {
   double_evaluation_point_temp_.clear();
@@ -10,6 +10,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
@@ -94,6 +95,35 @@ class EvaluatorBase {
    */
   int num_outputs() const { return num_outputs_; }
 
+  /**
+   * Returns whether Eval() may be called concurrently from several threads.
+   * Solvers that evaluate bindings in parallel (see, e.g.,
+   * IpoptSolver::set_num_threads()) evaluate the other evaluators serially.
+   * The default is false.
+   */
+  bool is_thread_safe() const { return is_thread_safe_; }
+
+  /**
+   * Sets the sparsity pattern of the gradient ∂y/∂x of the output y of
+   * Eval(x, y) with respect to its input x. The pattern lists *all* of the
+   * (row, column) entries of ∂y/∂x that may be nonzero; solvers that support
+   * sparse Jacobians (IPOPT and SNOPT) neither compute nor store the others.
+   * Setting the number of outputs clears the pattern.
+   * @throws std::invalid_argument if an entry of the pattern is out of range.
+   */
+  void SetGradientSparsityPattern(
+      const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
+
+  /**
+   * Returns the sparsity pattern of the gradient ∂y/∂x, or nullopt if every
+   * entry of ∂y/∂x may be nonzero.
+   * @see SetGradientSparsityPattern()
+   */
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity_pattern()
+      const {
+    return gradient_sparsity_pattern_;
+  }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -139,19 +169,46 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  // Declares whether Eval() may be called concurrently. Only sub-classes
+  // whose evaluation neither mutates shared state nor calls non-reentrant
+  // code should declare themselves thread safe.
+  void set_is_thread_safe(bool is_thread_safe) {
+    is_thread_safe_ = is_thread_safe;
+  }
+
   // Setter for the number of outputs.
   // This method is only meant to be called, if the sub-class structure permits
   // to change the number of outputs. One example is LinearConstraint in
   // solvers/Constraint.h, which can change the number of outputs, if the
   // matrix in the linear constraint is resized.
-  void set_num_outputs(int num_outputs) { num_outputs_ = num_outputs; }
+  void set_num_outputs(int num_outputs) {
+    num_outputs_ = num_outputs;
+    gradient_sparsity_pattern_ = nullopt;
+  }
 
  private:
   int num_vars_{};
   int num_outputs_{};
   std::string description_;
+  optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  bool is_thread_safe_{false};
 };
 
+namespace internal {
+/*
+ * Evaluates `evaluator` at `x`, storing its output y in `y` and the entries of
+ * the gradient ∂y/∂x in `gradient`: the entries of the evaluator's gradient
+ * sparsity pattern in the order of the pattern if it has one, or else all of
+ * them in row-major order. The evaluation is differentiated only with respect
+ * to the entries of x whose columns are in the pattern, so no storage or work
+ * is spent on the structural zeros of ∂y/∂x.
+ * @returns The number of entries written to `gradient`.
+ */
+int EvalSparseGradient(const EvaluatorBase& evaluator,
+                       const Eigen::Ref<const Eigen::VectorXd>& x, double* y,
+                       double* gradient);
+}  // namespace internal
+
 /**
  * Implements an evaluator of the form P(x, y...) where P is a multivariate
  * polynomial in x, y, ...
@@ -0,0 +1,59 @@
+#include "drake/solvers/evaluator_codegen.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace solvers {
+using symbolic::Expression;
+using symbolic::Variable;
+
+std::string CodeGenEvaluator(
+    const std::string& function_name, const std::vector<Variable>& parameters,
+    const Eigen::Ref<const VectorX<Expression>>& f) {
+  std::unordered_map<Variable::Id, int> map_var_to_index;
+  for (int j = 0; j < static_cast<int>(parameters.size()); ++j) {
+    map_var_to_index.emplace(parameters[j].get_id(), j);
+  }
+
+  // Only differentiates each fᵢ with respect to the variables it contains, so
+  // that the identically zero entries of ∂f/∂p are never built.
+  std::vector<Eigen::Triplet<Expression>> jacobian_triplets;
+  for (int i = 0; i < f.rows(); ++i) {
+    for (const Variable& var : f(i).GetVariables()) {
+      const auto it = map_var_to_index.find(var.get_id());
+      if (it == map_var_to_index.end()) {
+        throw std::runtime_error("CodeGenEvaluator: the variable " +
+                                 var.get_name() + " is not a parameter.");
+      }
+      Expression derivative = f(i).Differentiate(var);
+      if (!symbolic::is_zero(derivative)) {
+        jacobian_triplets.emplace_back(i, it->second, std::move(derivative));
+      }
+    }
+  }
+  Eigen::SparseMatrix<Expression> jacobian(f.rows(), parameters.size());
+  jacobian.setFromTriplets(jacobian_triplets.begin(), jacobian_triplets.end());
+  jacobian.makeCompressed();
+
+  std::ostringstream oss;
+  oss << symbolic::CodeGen(function_name, parameters, VectorX<Expression>(f));
+  oss << symbolic::CodeGen(function_name + "_jacobian", parameters, jacobian);
+  return oss.str();
+}
+
+std::string CodeGenEvaluator(const std::string& function_name,
+                             const ExpressionConstraint& constraint) {
+  const VectorXDecisionVariable& vars = constraint.vars();
+  const std::vector<Variable> parameters(vars.data(),
+                                         vars.data() + vars.size());
+  return CodeGenEvaluator(function_name, parameters, constraint.expressions());
+}
+}  // namespace solvers
+}  // namespace drake
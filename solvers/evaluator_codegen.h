@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+#include "drake/solvers/constraint.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * For a vector of symbolic expressions @p f, generates the C functions
+ * evaluating f and its Jacobian ∂f/∂p with respect to @p parameters, which
+ * GeneratedEvaluator wraps into an evaluator. Four functions are emitted:
+ *
+ *  - `<function_name>` and `<function_name>_meta`, evaluating f as a dense
+ *    column vector, as done by symbolic::CodeGen() for a dense matrix.
+ *  - `<function_name>_jacobian` and `<function_name>_jacobian_meta`,
+ *    evaluating ∂f/∂p as a sparse matrix in compressed column storage, as done
+ *    by symbolic::CodeGen() for a sparse matrix. Only the entries of ∂f/∂p
+ *    that are not identically zero are stored.
+ *
+ * The intended use is a build-time generator: a small program prints the
+ * generated code into a header, which a `genrule` produces for the library
+ * that needs the evaluator. That library then only depends on
+ * `//solvers:generated_evaluator`, e.g.
+ * @code
+ * // my_constraint_codegen.cc, run by a genrule into my_constraint.h.
+ * std::cout << "#include <cmath>\n"
+ *           << CodeGenEvaluator("my_constraint", {x, y}, f);
+ *
+ * // Consumer.
+ * #include "my_constraint.h"
+ * auto evaluator = MakeGeneratedEvaluator(
+ *     &my_constraint, my_constraint_meta(), &my_constraint_jacobian,
+ *     my_constraint_jacobian_meta());
+ * prog.AddConstraint(
+ *     std::make_shared<EvaluatorConstraint<GeneratedEvaluator>>(
+ *         evaluator, lb, ub),
+ *     vars);
+ * @endcode
+ *
+ * The dynamics of a systems::SymbolicVectorSystem are generated the same way,
+ * by passing its dynamics() and the concatenation of its state and input
+ * variables.
+ *
+ * @throws std::runtime_error if f uses a variable not in @p parameters, or an
+ * operation that cannot be differentiated or generated (e.g. if-then-else).
+ */
+std::string CodeGenEvaluator(
+    const std::string& function_name,
+    const std::vector<symbolic::Variable>& parameters,
+    const Eigen::Ref<const VectorX<symbolic::Expression>>& f);
+
+/**
+ * Generates the evaluator code for the expressions of @p constraint, with the
+ * parameters ordered as `constraint.vars()`. The bounds of the constraint are
+ * not part of the generated code.
+ * @see CodeGenEvaluator()
+ */
+std::string CodeGenEvaluator(const std::string& function_name,
+                             const ExpressionConstraint& constraint);
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,118 @@
+#include "drake/solvers/generated_evaluator.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+
+namespace drake {
+namespace solvers {
+struct GeneratedEvaluator::Scratch {
+  Scratch(int num_vars, int jacobian_non_zeros)
+      : outer_indices(num_vars + 1),
+        inner_indices(jacobian_non_zeros),
+        values(jacobian_non_zeros) {}
+
+  // The output arguments of the generated Jacobian function.
+  std::vector<int> outer_indices;
+  std::vector<int> inner_indices;
+  std::vector<double> values;
+  Eigen::VectorXd x_value;
+  Eigen::VectorXd y_value;
+  Eigen::MatrixXd dxdz;
+  Eigen::MatrixXd dydz;
+};
+
+GeneratedEvaluator::GeneratedEvaluator(int num_outputs, int num_vars,
+                                       int jacobian_non_zeros,
+                                       ValueFunction value,
+                                       JacobianFunction jacobian,
+                                       const std::string& description)
+    : EvaluatorBase(num_outputs, num_vars, description),
+      value_(value),
+      jacobian_(jacobian),
+      jacobian_non_zeros_(jacobian_non_zeros),
+      scratch_(std::make_unique<Scratch>(num_vars, jacobian_non_zeros)) {
+  DRAKE_THROW_UNLESS(value != nullptr);
+  DRAKE_THROW_UNLESS(jacobian != nullptr);
+  // The generated code writes the same structure for any input, so a single
+  // evaluation at the origin gives it; the values are discarded.
+  const Eigen::VectorXd origin = Eigen::VectorXd::Zero(num_vars);
+  jacobian_(origin.data(), scratch_->outer_indices.data(),
+            scratch_->inner_indices.data(), scratch_->values.data());
+  std::vector<std::pair<int, int>> gradient_sparsity_pattern;
+  gradient_sparsity_pattern.reserve(jacobian_non_zeros);
+  for (int j = 0; j < num_vars; ++j) {
+    for (int k = scratch_->outer_indices[j];
+         k < scratch_->outer_indices[j + 1]; ++k) {
+      gradient_sparsity_pattern.emplace_back(scratch_->inner_indices[k], j);
+    }
+  }
+  SetGradientSparsityPattern(gradient_sparsity_pattern);
+  set_is_thread_safe(true);
+}
+
+GeneratedEvaluator::~GeneratedEvaluator() = default;
+
+void GeneratedEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+                                Eigen::VectorXd* y) const {
+  DRAKE_ASSERT(x.rows() == num_vars());
+  y->resize(num_outputs());
+  value_(x.data(), y->data());
+}
+
+void GeneratedEvaluator::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+                                AutoDiffVecXd* y) const {
+  DRAKE_ASSERT(x.rows() == num_vars());
+  // Use the scratch space of this evaluator if it isn't in use by another
+  // thread; otherwise, use scratch space of our own.
+  std::unique_lock<std::mutex> lock(scratch_mutex_, std::try_to_lock);
+  std::unique_ptr<Scratch> own_scratch;
+  Scratch* scratch = scratch_.get();
+  if (!lock.owns_lock()) {
+    own_scratch = std::make_unique<Scratch>(num_vars(), jacobian_non_zeros_);
+    scratch = own_scratch.get();
+  }
+
+  // Resizing the scratch vectors and matrices to the sizes they already have
+  // does not allocate.
+  Eigen::VectorXd& x_value = scratch->x_value;
+  x_value.resize(num_vars());
+  int num_z = 0;
+  for (int i = 0; i < num_vars(); ++i) {
+    x_value(i) = x(i).value();
+    num_z = std::max(num_z, static_cast<int>(x(i).derivatives().size()));
+  }
+  Eigen::VectorXd& y_value = scratch->y_value;
+  y_value.resize(num_outputs());
+  value_(x_value.data(), y_value.data());
+
+  jacobian_(x_value.data(), scratch->outer_indices.data(),
+            scratch->inner_indices.data(), scratch->values.data());
+  const Eigen::Map<const Eigen::SparseMatrix<double>> dfdx(
+      num_outputs(), num_vars(), jacobian_non_zeros_,
+      scratch->outer_indices.data(), scratch->inner_indices.data(),
+      scratch->values.data());
+
+  // Entries of x without derivatives have zero gradient, as in
+  // math::autoDiffToGradientMatrix().
+  Eigen::MatrixXd& dxdz = scratch->dxdz;
+  dxdz.setZero(num_vars(), num_z);
+  for (int i = 0; i < num_vars(); ++i) {
+    const int size = x(i).derivatives().size();
+    dxdz.row(i).head(size) = x(i).derivatives().transpose();
+  }
+
+  // Using ∂yᵢ/∂zⱼ = ∑ₖ ∂fᵢ/∂xₖ ∂xₖ/∂zⱼ.
+  Eigen::MatrixXd& dydz = scratch->dydz;
+  dydz.resize(num_outputs(), num_z);
+  dydz.noalias() = dfdx * dxdz;
+  y->resize(num_outputs());
+  math::initializeAutoDiffGivenGradientMatrix(y_value, dydz, *y);
+}
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+#include "drake/solvers/evaluator_base.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * An evaluator whose value and Jacobian are computed by C functions generated
+ * with CodeGenEvaluator() (see evaluator_codegen.h) and compiled into the
+ * program. Evaluating it needs neither the symbolic expressions it was
+ * generated from nor the symbolic runtime, and evaluating it for double does
+ * not allocate once the output has the right size. Evaluating it for AutoDiff
+ * reuses scratch space held by the evaluator, and only allocates the
+ * derivatives of the output.
+ *
+ * The evaluator is thread-safe, and declares the sparsity pattern of its
+ * gradient to be that of the generated Jacobian. Symbolic evaluation is not
+ * supported.
+ *
+ * Consider constructing instances with MakeGeneratedEvaluator(), which reads
+ * the sizes from the generated `_meta()` functions.
+ */
+class GeneratedEvaluator : public EvaluatorBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GeneratedEvaluator)
+
+  /** The signature of the generated function evaluating y = f(x). */
+  using ValueFunction = void (*)(const double* p, double* m);
+
+  /**
+   * The signature of the generated function evaluating the Jacobian ∂f/∂x, in
+   * compressed column storage.
+   */
+  using JacobianFunction = void (*)(const double* p, int* outer_indices,
+                                    int* inner_indices, double* values);
+
+  /**
+   * @param num_outputs The size of y.
+   * @param num_vars The size of x.
+   * @param jacobian_non_zeros The number of entries of ∂f/∂x that @p jacobian
+   * stores.
+   * @param value The generated function evaluating f.
+   * @param jacobian The generated function evaluating ∂f/∂x.
+   * @param description A human-friendly description.
+   */
+  GeneratedEvaluator(int num_outputs, int num_vars, int jacobian_non_zeros,
+                     ValueFunction value, JacobianFunction jacobian,
+                     const std::string& description = "");
+
+  ~GeneratedEvaluator() override;
+
+ private:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override;
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override;
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
+              VectorX<symbolic::Expression>*) const override {
+    throw std::logic_error(
+        "GeneratedEvaluator does not support symbolic evaluation.");
+  }
+
+  struct Scratch;
+
+  const ValueFunction value_;
+  const JacobianFunction jacobian_;
+  const int jacobian_non_zeros_;
+  // The scratch space of the AutoDiff evaluation. An evaluation that finds it
+  // in use by another thread allocates its own.
+  mutable std::mutex scratch_mutex_;
+  const std::unique_ptr<Scratch> scratch_;
+};
+
+/**
+ * Creates a GeneratedEvaluator from the functions `<name>`, `<name>_meta`,
+ * `<name>_jacobian` and `<name>_jacobian_meta` emitted by CodeGenEvaluator().
+ * For example, for a function generated with the name "f":
+ * @code
+ * auto evaluator = MakeGeneratedEvaluator(&f, f_meta(), &f_jacobian,
+ *                                         f_jacobian_meta());
+ * @endcode
+ * @throws std::runtime_error if the two meta descriptions are inconsistent.
+ * @relates GeneratedEvaluator
+ */
+template <typename ValueMeta, typename JacobianMeta>
+std::shared_ptr<GeneratedEvaluator> MakeGeneratedEvaluator(
+    GeneratedEvaluator::ValueFunction value, const ValueMeta& value_meta,
+    GeneratedEvaluator::JacobianFunction jacobian,
+    const JacobianMeta& jacobian_meta, const std::string& description = "") {
+  DRAKE_THROW_UNLESS(value_meta.m.cols == 1);
+  DRAKE_THROW_UNLESS(jacobian_meta.p.size == value_meta.p.size);
+  DRAKE_THROW_UNLESS(jacobian_meta.m.rows == value_meta.m.rows);
+  DRAKE_THROW_UNLESS(jacobian_meta.m.cols == value_meta.p.size);
+  return std::make_shared<GeneratedEvaluator>(
+      value_meta.m.rows, value_meta.p.size, jacobian_meta.m.non_zeros, value,
+      jacobian, description);
+}
+}  // namespace solvers
+}  // namespace drake
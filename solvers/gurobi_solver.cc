@@ -207,34 +207,37 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
  * @return error as an integer. The full set of error values are
  * described here :
  * https://www.gurobi.com/documentation/7.5/refman/error_codes.html
- *
- * TODO(hongkai.dai): Use a sparse matrix A.
  */
-template <typename DerivedA, typename DerivedLB, typename DerivedUB>
+template <typename DerivedLB, typename DerivedUB>
 int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
-                        const Eigen::MatrixBase<DerivedA>& A,
+                        const Eigen::SparseMatrix<double>& A,
                         const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub,
                         const Eigen::Ref<const VectorXDecisionVariable>& vars,
                         bool is_equality, double sparseness_threshold) {
+  const std::vector<int> var_indices = prog.FindDecisionVariableIndices(vars);
+  // Gurobi takes the constraints row by row.
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> A_row_major = A;
+  std::vector<int> nonzero_var_index;
+  std::vector<double> nonzero_coeff;
   for (int i = 0; i < A.rows(); i++) {
-    int nonzero_coeff_count = 0;
-    std::vector<int> nonzero_var_index(A.cols(), 0);
-    std::vector<double> nonzero_coeff(A.cols(), 0.0);
-
-    for (int j = 0; j < A.cols(); j++) {
-      if (std::abs(A(i, j)) > sparseness_threshold) {
-        nonzero_coeff[nonzero_coeff_count] = A(i, j);
-        nonzero_var_index[nonzero_coeff_count++] =
-            prog.FindDecisionVariableIndex(vars(j));
+    nonzero_var_index.clear();
+    nonzero_coeff.clear();
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+             A_row_major, i);
+         it; ++it) {
+      if (std::abs(it.value()) > sparseness_threshold) {
+        nonzero_coeff.push_back(it.value());
+        nonzero_var_index.push_back(var_indices[it.col()]);
       }
     }
+    const int nonzero_coeff_count = nonzero_coeff.size();
     // The sense of the constraint could be ==, <= or >=
     int error = 0;
     if (is_equality) {
       // Adds equality constraint.
-      error = GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_EQUAL, lb(i), nullptr);
+      error = GRBaddconstr(model, nonzero_coeff_count, nonzero_var_index.data(),
+                           nonzero_coeff.data(), GRB_EQUAL, lb(i), nullptr);
       DRAKE_ASSERT(!error);
       if (error) return error;
     } else {
@@ -242,16 +245,16 @@ int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
         if (!std::isinf(lb(i))) {
           // Adds A.row(i)*x >= lb(i).
           error = GRBaddconstr(model, nonzero_coeff_count,
-                               &nonzero_var_index[0], &nonzero_coeff[0],
+                               nonzero_var_index.data(), nonzero_coeff.data(),
                                GRB_GREATER_EQUAL, lb(i), nullptr);
           DRAKE_ASSERT(!error);
           if (error) return error;
         }
         if (!std::isinf(ub(i))) {
           // Adds A.row(i)*x <= ub(i).
-          error =
-              GRBaddconstr(model, nonzero_coeff_count, &nonzero_var_index[0],
-                           &nonzero_coeff[0], GRB_LESS_EQUAL, ub(i), nullptr);
+          error = GRBaddconstr(model, nonzero_coeff_count,
+                               nonzero_var_index.data(), nonzero_coeff.data(),
+                               GRB_LESS_EQUAL, ub(i), nullptr);
           DRAKE_ASSERT(!error);
           if (error) return error;
         }
@@ -403,7 +406,7 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
   for (const auto& binding : prog.quadratic_costs()) {
     const auto& constraint = binding.evaluator();
     const int constraint_variable_dimension = binding.GetNumElements();
-    const Eigen::MatrixXd& Q = constraint->Q();
+    const Eigen::SparseMatrix<double>& Q = constraint->get_sparse_Q();
     const Eigen::VectorXd& b = constraint->b();
     constant_cost += constraint->c();
 
@@ -418,14 +421,12 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
           prog.FindDecisionVariableIndex(binding.variables()(i));
     }
 
-    for (int i = 0; i < Q.rows(); i++) {
-      const double Qii = 0.5 * Q(i, i);
-      if (abs(Qii) > sparseness_threshold) {
-        Q_nonzero_coefs.push_back(Eigen::Triplet<double>(
-            constraint_variable_index[i], constraint_variable_index[i], Qii));
-      }
-      for (int j = i + 1; j < Q.cols(); j++) {
-        const double Qij = 0.5 * (Q(i, j) + Q(j, i));
+    // Q is symmetric, so its upper triangle determines it.
+    for (int j = 0; j < Q.outerSize(); j++) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Q, j); it; ++it) {
+        const int i = it.row();
+        if (i > j) continue;
+        const double Qij = i == j ? 0.5 * it.value() : it.value();
         if (abs(Qij) > sparseness_threshold) {
           Q_nonzero_coefs.push_back(Eigen::Triplet<double>(
               constraint_variable_index[i], constraint_variable_index[j], Qij));
@@ -508,7 +509,7 @@ int ProcessLinearConstraints(GRBmodel* model, const MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), true,
         sparseness_threshold);
     if (error) {
@@ -520,7 +521,7 @@ int ProcessLinearConstraints(GRBmodel* model, const MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), false,
         sparseness_threshold);
     if (error) {
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <unordered_map>
@@ -13,6 +14,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
@@ -40,11 +42,14 @@ int GetConstraintBounds(const Constraint& c, Number* lb, Number* ub) {
   return c.num_constraints();
 }
 
-/// @param[out] num_grad number of gradients
+/// @param[out] num_grad number of gradients, i.e., the number of entries of
+/// the constraint's gradient sparsity pattern if it has one, or else the size
+/// of its (dense) gradient.
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  const auto& pattern = c.gradient_sparsity_pattern();
+  *num_grad = pattern ? pattern->size() : num_constraints * var_count;
   return num_constraints;
 }
 
@@ -59,6 +64,10 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// described in
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
+/// The pairs are those of the constraint's gradient sparsity pattern if it
+/// has one, or else all of them in row-major order, matching the order of
+/// the values written by EvaluateConstraint().
+///
 /// @return the number of row/column pairs filled in.
 size_t GetGradientMatrix(
     const MathematicalProgram& prog, const Constraint& c,
@@ -67,6 +76,16 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  if (c.gradient_sparsity_pattern()) {
+    for (const auto& nonzero : *c.gradient_sparsity_pattern()) {
+      iRow[grad_index] = constraint_idx + nonzero.first;
+      jCol[grad_index] =
+          prog.FindDecisionVariableIndex(variables(nonzero.second));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -109,26 +128,10 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     this_x(i) = xvec(prog.FindDecisionVariableIndex(variables(i)));
   }
 
-  AutoDiffVecXd ty(c.num_constraints());
-  c.Eval(math::initializeAutoDiff(this_x), &ty);
-
-  // Store the results.  Since IPOPT directly knows the bounds of the
-  // constraint, we don't need to apply any bounding information here.
-  for (int i = 0; i < c.num_constraints(); i++) {
-    result[i] = ty(i).value();
-  }
-
-  // Extract the appropriate derivatives from our result into the
-  // gradient array.
-  size_t grad_idx = 0;
-
-  for (int i = 0; i < c.num_constraints(); i++) {
-    for (int j = 0; j < variables.rows(); j++) {
-      grad[grad_idx++] = ty(i).derivatives()(j);
-    }
-  }
-
-  return grad_idx;
+  // Store the results and the gradient entries.  Since IPOPT directly knows
+  // the bounds of the constraint, we don't need to apply any bounding
+  // information here.
+  return internal::EvalSparseGradient(c, this_x, result, grad);
 }
 
 // IPOPT uses separate callbacks to get the result and the gradients.
@@ -162,10 +165,16 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(const MathematicalProgram& problem,
-                           const Eigen::VectorXd& x_init,
-                           MathematicalProgramResult* result)
-      : problem_(&problem), x_init_{x_init}, result_(result) {}
+  // @param thread_pool If non-null, evaluates the thread-safe constraints in
+  // parallel.
+  IpoptSolver_NLP(const MathematicalProgram& problem,
+                  const Eigen::VectorXd& x_init,
+                  MathematicalProgramResult* result,
+                  drake::internal::ThreadPool* thread_pool)
+      : problem_(&problem),
+        x_init_{x_init},
+        result_(result),
+        thread_pool_(thread_pool) {}
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -481,30 +490,50 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* result = constraint_cache_->result.data();
     Number* grad = constraint_cache_->grad.data();
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
+    std::vector<std::function<void()>> parallel_evaluations;
+    EvaluateConstraintList(problem_->generic_constraints(), xvec, &result,
+                           &grad, &parallel_evaluations);
+    EvaluateConstraintList(problem_->lorentz_cone_constraints(), xvec, &result,
+                           &grad, &parallel_evaluations);
+    EvaluateConstraintList(problem_->rotated_lorentz_cone_constraints(), xvec,
+                           &result, &grad, &parallel_evaluations);
+    EvaluateConstraintList(problem_->linear_constraints(), xvec, &result,
+                           &grad, &parallel_evaluations);
+    EvaluateConstraintList(problem_->linear_equality_constraints(), xvec,
+                           &result, &grad, &parallel_evaluations);
+    if (!parallel_evaluations.empty()) {
+      thread_pool_->ParallelFor(
+          parallel_evaluations.size(),
+          [&parallel_evaluations](int i) { parallel_evaluations[i](); });
     }
-    for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
+  }
+
+  // Evaluates each of the `constraints` into `*result` and `*grad`, and
+  // advances them past it. If there is a thread pool, the evaluations of the
+  // thread-safe constraints are appended to `parallel_evaluations` instead of
+  // being run.
+  template <typename C>
+  void EvaluateConstraintList(
+      const std::vector<Binding<C>>& constraints, const Eigen::VectorXd& xvec,
+      Number** result, Number** grad,
+      std::vector<std::function<void()>>* parallel_evaluations) const {
+    for (const auto& c : constraints) {
+      const Constraint& constraint = *c.evaluator();
+      Index num_grad = 0;
+      const int num_constraints =
+          GetNumGradients(constraint, c.variables().rows(), &num_grad);
+      if (thread_pool_ != nullptr && constraint.is_thread_safe()) {
+        parallel_evaluations->emplace_back(
+            [this, &xvec, &constraint, &c, result = *result, grad = *grad]() {
+              EvaluateConstraint(*problem_, xvec, constraint, c.variables(),
+                                 result, grad);
+            });
+      } else {
+        EvaluateConstraint(*problem_, xvec, constraint, c.variables(), *result,
+                           *grad);
+      }
+      *result += num_constraints;
+      *grad += num_grad;
     }
   }
 
@@ -513,6 +542,7 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   std::unique_ptr<ResultCache> constraint_cache_;
   Eigen::VectorXd x_init_;
   MathematicalProgramResult* const result_;
+  drake::internal::ThreadPool* const thread_pool_;
 };
 
 template <typename T>
@@ -655,7 +685,7 @@ void IpoptSolver::DoSolve(
   }
 
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
-      new IpoptSolver_NLP(prog, initial_guess, result);
+      new IpoptSolver_NLP(prog, initial_guess, result, thread_pool_.get());
   status = app->OptimizeTNLP(nlp);
 }
 
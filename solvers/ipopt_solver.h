@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <ostream>
 #include <string>
 
@@ -9,6 +10,10 @@
 #include "drake/solvers/solver_base.h"
 
 namespace drake {
+namespace internal {
+class ThreadPool;
+}  // namespace internal
+
 namespace solvers {
 
 /**
@@ -60,9 +65,25 @@ class IpoptSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets the number of threads, including the calling thread, on which
+  /// Solve() evaluates the program's constraints. Constraints whose
+  /// evaluators are thread safe (see EvaluatorBase::is_thread_safe()) are
+  /// evaluated in parallel; the others are evaluated on the calling thread.
+  /// The default is 1, i.e., no parallelism.
+  /// @throws std::exception if `num_threads` is not positive.
+  void set_num_threads(int num_threads);
+
+  /// Returns the number of threads set by set_num_threads().
+  int num_threads() const { return num_threads_; }
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  int num_threads_{1};
+  // Null iff num_threads_ is 1. This is a shared_ptr so that ~IpoptSolver()
+  // does not need the ThreadPool definition.
+  std::shared_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 
 }  // namespace solvers
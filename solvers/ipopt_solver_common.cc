@@ -2,7 +2,9 @@
 #include "drake/solvers/ipopt_solver.h"
 /* clang-format on */
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/thread_pool.h"
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
@@ -13,6 +15,15 @@ IpoptSolver::IpoptSolver()
 
 IpoptSolver::~IpoptSolver() = default;
 
+void IpoptSolver::set_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  num_threads_ = num_threads;
+  thread_pool_.reset();
+  if (num_threads > 1) {
+    thread_pool_ = std::make_shared<drake::internal::ThreadPool>(num_threads);
+  }
+}
+
 SolverId IpoptSolver::id() {
   static const never_destroyed<SolverId> singleton{"IPOPT"};
   return singleton.access();
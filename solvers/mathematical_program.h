@@ -933,6 +933,18 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& b,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds a cost term of the form 0.5*x'*Q*x + b'x + c, with a sparse matrix Q,
+   * applied to a subset of the variables. Q is never converted to a dense
+   * matrix, neither here nor by the solvers which accept sparse matrices.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<QuadraticCost> AddQuadraticCost(
+      const Eigen::SparseMatrix<double>& Q,
+      const Eigen::Ref<const Eigen::VectorXd>& b, double c,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds a cost term in the polynomial form.
    * @param e A symbolic expression in the polynomial form.
@@ -1118,6 +1130,19 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& ub,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear constraints lb <= A * vars <= ub, with a sparse matrix A. A is
+   * never converted to a dense matrix, neither here nor by the solvers which
+   * accept sparse matrices.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear constraint referencing potentially a
    * subset of the decision variables (defined in the vars parameter).
@@ -1397,6 +1422,18 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& beq,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear equality constraints Aeq * vars = beq, with a sparse matrix
+   * Aeq. Aeq is never converted to a dense matrix, neither here nor by the
+   * solvers which accept sparse matrices.
+   *
+   * @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear equality constraint referencing potentially a subset
    * of decision variables.
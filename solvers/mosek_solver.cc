@@ -369,14 +369,14 @@ MSKrescodee AddLinearConstraintsFromBindings(
   MSKrescodee rescode{MSK_RES_OK};
   for (const auto& binding : constraint_list) {
     const auto& constraint = binding.evaluator();
-    const Eigen::MatrixXd& A = constraint->A();
+    const Eigen::SparseMatrix<double>& A = constraint->get_sparse_A();
     const Eigen::VectorXd& lb = constraint->lower_bound();
     const Eigen::VectorXd& ub = constraint->upper_bound();
     Eigen::SparseMatrix<double> B_zero(A.rows(), 0);
     B_zero.setZero();
     rescode = AddLinearConstraintToMosek(
-        prog, A.sparseView(), B_zero, lb, ub, binding.variables(), {},
-        bound_type, decision_variable_index_to_mosek_matrix_variable,
+        prog, A, B_zero, lb, ub, binding.variables(), {}, bound_type,
+        decision_variable_index_to_mosek_matrix_variable,
         decision_variable_index_to_mosek_nonmatrix_variable,
         matrix_variable_entry_to_selection_matrix_id, *task);
   }
@@ -733,7 +733,7 @@ MSKrescodee AggregateQuadraticCosts(
   for (const auto& binding : prog.quadratic_costs()) {
     const auto& cost = binding.evaluator();
     // The quadratic cost is of form 0.5*x'*Q*x + b*x.
-    const auto& Q = cost->Q();
+    const Eigen::SparseMatrix<double>& Q = cost->get_sparse_Q();
     const auto& b = cost->b();
     *constant_cost += cost->c();
     std::vector<int> var_indices(Q.rows());
@@ -753,27 +753,26 @@ MSKrescodee AggregateQuadraticCosts(
       var_indices[i] = it->second;
     }
 
-    for (int i = 0; i < Q.rows(); ++i) {
-      int var_index_i = var_indices[i];
-      for (int j = 0; j < i; ++j) {
-        const double Qij = (Q(i, j) + Q(j, i)) / 2;
-        if (std::abs(Qij) > Eigen::NumTraits<double>::epsilon()) {
-          if (var_index_i > var_indices[j]) {
-            Q_lower_triplets->push_back(
-                Eigen::Triplet<double>(var_index_i, var_indices[j], Qij));
-          } else {
-            Q_lower_triplets->push_back(
-                Eigen::Triplet<double>(var_indices[j], var_index_i, Qij));
-          }
+    // Q is symmetric, so its lower triangle, visited column by column,
+    // determines it.
+    for (int j = 0; j < Q.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Q, j); it; ++it) {
+        const int i = it.row();
+        if (i < j ||
+            std::abs(it.value()) <= Eigen::NumTraits<double>::epsilon()) {
+          continue;
         }
+        const int var_index_i = var_indices[i];
+        const int var_index_j = var_indices[j];
+        Q_lower_triplets->push_back(Eigen::Triplet<double>(
+            std::max(var_index_i, var_index_j),
+            std::min(var_index_i, var_index_j), it.value()));
       }
-      if (std::abs(Q(i, i)) > Eigen::NumTraits<double>::epsilon()) {
-        Q_lower_triplets->push_back(
-            Eigen::Triplet<double>(var_index_i, var_index_i, Q(i, i)));
-      }
+    }
+    for (int i = 0; i < b.rows(); ++i) {
       if (std::abs(b(i)) > Eigen::NumTraits<double>::epsilon()) {
         linear_term_triplets->push_back(
-            Eigen::Triplet<double>(var_index_i, 0, b(i)));
+            Eigen::Triplet<double>(var_indices[i], 0, b(i)));
       }
     }
   }
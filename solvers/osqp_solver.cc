@@ -1,5 +1,8 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <osqp.h>
@@ -24,14 +27,20 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
     // this quadratic cost) in the program decision variables.
     const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
 
-    // Add quadratic_cost.Q to the Hessian P.
+    // Add the upper triangle of quadratic_cost.Q to the Hessian P. OSQP only
+    // reads the upper triangle of P, and osqp_update_P() takes the values of
+    // that triangle, so P holds nothing else.
     const std::vector<Eigen::Triplet<double>> Qi_triplets =
-        math::SparseMatrixToTriplets(quadratic_cost.evaluator()->Q());
+        math::SparseMatrixToTriplets(
+            quadratic_cost.evaluator()->get_sparse_Q());
     P_triplets.reserve(P_triplets.size() + Qi_triplets.size());
     for (int i = 0; i < static_cast<int>(Qi_triplets.size()); ++i) {
-      P_triplets.emplace_back(x_indices[Qi_triplets[i].row()],
-                              x_indices[Qi_triplets[i].col()],
-                              static_cast<c_float>(Qi_triplets[i].value()));
+      const int row = x_indices[Qi_triplets[i].row()];
+      const int col = x_indices[Qi_triplets[i].col()];
+      if (row <= col) {
+        P_triplets.emplace_back(row, col,
+                                static_cast<c_float>(Qi_triplets[i].value()));
+      }
     }
 
     // Add quadratic_cost.b to the linear cost term q.
@@ -90,7 +99,7 @@ void ParseLinearConstraints(const MathematicalProgram& prog,
     const std::vector<int> x_indices =
         prog.FindDecisionVariableIndices(constraint.variables());
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->A());
+        math::SparseMatrixToTriplets(constraint.evaluator()->get_sparse_A());
     // Append constraint.A to osqp A.
     for (const auto& Ai_triplet : Ai_triplets) {
       A_triplets->emplace_back(*num_A_rows + Ai_triplet.row(),
@@ -215,8 +224,130 @@ void SetOsqpSolverSettings(const SolverOptions& solver_options,
   SetOsqpSolverSettingWithDefaultValue(options_int, "polish",
                                        &(settings->polish), 1);
 }
+
+bool SameSettings(const OSQPSettings& a, const OSQPSettings& b) {
+  // These are all of the settings that SetOsqpSolverSettings() may change.
+  return a.rho == b.rho && a.sigma == b.sigma && a.scaling == b.scaling &&
+         a.max_iter == b.max_iter &&
+         a.polish_refine_iter == b.polish_refine_iter &&
+         a.verbose == b.verbose && a.polish == b.polish;
+}
+
+bool SameSparsityPattern(const Eigen::SparseMatrix<c_float>& a,
+                         const Eigen::SparseMatrix<c_float>& b) {
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+bool SameValues(const Eigen::SparseMatrix<c_float>& a,
+                const Eigen::SparseMatrix<c_float>& b) {
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
 }  // namespace
 
+// An OSQP workspace, together with the sparsity pattern and settings it was
+// set up for, and the matrix values it currently holds.
+class OsqpSolver::Workspace {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace() = default;
+
+  ~Workspace() { Reset(); }
+
+  // The OSQP workspace, or null if Setup() failed or was never called.
+  OSQPWorkspace* get() const { return work_; }
+
+  // Reports true if this workspace was set up for matrices with the sparsity
+  // patterns of `P` and `A`, and for the given settings.
+  bool Matches(const Eigen::SparseMatrix<c_float>& P,
+               const Eigen::SparseMatrix<c_float>& A,
+               const OSQPSettings& settings) const {
+    return work_ != nullptr && SameSettings(settings, settings_) &&
+           SameSparsityPattern(P, P_) && SameSparsityPattern(A, A_);
+  }
+
+  // Frees the OSQP workspace, if any; it no longer Matches() any problem.
+  void Reset() {
+    if (work_ != nullptr) osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+
+  // Sets up a new OSQP workspace for the given problem, replacing the
+  // existing one, if any.
+  void Setup(const Eigen::SparseMatrix<c_float>& P, std::vector<c_float>* q,
+             const Eigen::SparseMatrix<c_float>& A, std::vector<c_float>* l,
+             std::vector<c_float>* u, const OSQPSettings& settings) {
+    Reset();
+    P_ = P;
+    A_ = A;
+    settings_ = settings;
+
+    // osqp_setup() copies the problem data into the workspace.
+    OSQPData* data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+    data->n = P.cols();
+    data->m = A.rows();
+    data->P = EigenSparseToCSC(P);
+    data->q = q->data();
+    data->A = EigenSparseToCSC(A);
+    data->l = l->data();
+    data->u = u->data();
+    OSQPSettings settings_copy = settings;
+    work_ = osqp_setup(data, &settings_copy);
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+  }
+
+  // Replaces the problem data of the workspace, which must Match() the given
+  // matrices; `P` holds only its upper triangle, as OSQP stores it. The KKT
+  // system is only refactored if `P` or `A` changed.
+  // Returns OSQP's error flag; zero on success. On failure, the workspace
+  // holds partially updated data, so it is Reset().
+  c_int Update(const Eigen::SparseMatrix<c_float>& P,
+               const std::vector<c_float>& q,
+               const Eigen::SparseMatrix<c_float>& A,
+               const std::vector<c_float>& l, const std::vector<c_float>& u) {
+    DRAKE_ASSERT(SameSparsityPattern(P, P_) && SameSparsityPattern(A, A_));
+    const bool P_changed = !SameValues(P, P_);
+    const bool A_changed = !SameValues(A, A_);
+    c_int exitflag = 0;
+    if (P_changed && A_changed) {
+      exitflag = osqp_update_P_A(work_, P.valuePtr(), OSQP_NULL, P.nonZeros(),
+                                 A.valuePtr(), OSQP_NULL, A.nonZeros());
+    } else if (P_changed) {
+      exitflag = osqp_update_P(work_, P.valuePtr(), OSQP_NULL, P.nonZeros());
+    } else if (A_changed) {
+      exitflag = osqp_update_A(work_, A.valuePtr(), OSQP_NULL, A.nonZeros());
+    }
+    if (exitflag == 0) exitflag = osqp_update_lin_cost(work_, q.data());
+    if (exitflag == 0) exitflag = osqp_update_bounds(work_, l.data(), u.data());
+    if (exitflag != 0) {
+      Reset();
+      return exitflag;
+    }
+    if (P_changed) P_ = P;
+    if (A_changed) A_ = A;
+    return exitflag;
+  }
+
+ private:
+  OSQPWorkspace* work_{};
+  Eigen::SparseMatrix<c_float> P_;
+  Eigen::SparseMatrix<c_float> A_;
+  OSQPSettings settings_{};
+};
+
 bool OsqpSolver::is_available() { return true; }
 
 void OsqpSolver::DoSolve(
@@ -224,9 +355,6 @@ void OsqpSolver::DoSolve(
     const Eigen::VectorXd& initial_guess,
     const SolverOptions& merged_options,
     MathematicalProgramResult* result) const {
-  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
-  unused(initial_guess);
-
   // OSQP solves a convex quadratic programming problem
   // min 0.5 xᵀPx + qᵀx
   // s.t l ≤ Ax ≤ u
@@ -245,47 +373,77 @@ void OsqpSolver::DoSolve(
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data;  // OSQPData
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
   // Define Solver settings as default.
   // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
-
-  SetOsqpSolverSettings(merged_options, settings);
-
-  // Setup workspace.
-  // OSQP structures.
-  OSQPWorkspace* work;  // Workspace
-  work = osqp_setup(data, settings);
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
+
+  SetOsqpSolverSettings(merged_options, &settings);
+
+  // Use the workspace of the previous solve if it isn't in use by another
+  // thread; otherwise, solve in a workspace of our own.
+  std::unique_lock<std::mutex> lock(workspace_mutex_, std::try_to_lock);
+  std::shared_ptr<Workspace> workspace;
+  if (lock.owns_lock()) {
+    if (workspace_ == nullptr) workspace_ = std::make_shared<Workspace>();
+    workspace = workspace_;
+  } else {
+    workspace = std::make_shared<Workspace>();
+  }
 
-  // Solve Problem.
-  c_int osqp_exitflag = osqp_solve(work);
+  c_int osqp_exitflag = 0;
+  const bool reused_workspace =
+      workspace->Matches(P_sparse, A_sparse, settings);
+  if (reused_workspace) {
+    osqp_exitflag = workspace->Update(P_sparse, q, A_sparse, l, u);
+  } else {
+    workspace->Setup(P_sparse, &q, A_sparse, &l, &u, settings);
+  }
+  OSQPWorkspace* work = workspace->get();
 
   SolutionResult solution_result;
   OsqpSolverDetails& solver_details =
       result->SetSolverDetailsType<OsqpSolverDetails>();
+  if (work == nullptr || osqp_exitflag) {
+    result->set_solution_result(SolutionResult::kInvalidInput);
+    return;
+  }
+
+  if (!initial_guess.array().isNaN().all()) {
+    // Warm start the primal solution with the initial guess. Variables without
+    // a guess (NaN) start at zero, OSQP's default. A reused workspace also
+    // keeps the dual solution of its previous solve.
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1> x_guess =
+        initial_guess.array()
+            .isNaN()
+            .select(0.0, initial_guess.array())
+            .matrix()
+            .cast<c_float>();
+    osqp_warm_start_x(work, x_guess.data());
+  } else if (reused_workspace) {
+    // Without an initial guess, a reused workspace solves exactly as a new one
+    // would: from zero, and with the initial step size rather than the one
+    // adapted during the previous solve.
+    osqp_update_warm_start(work, 0);
+    if (work->settings->rho != settings.rho) {
+      osqp_update_rho(work, settings.rho);
+    }
+  }
+
+  // Solve Problem.
+  osqp_exitflag = osqp_solve(work);
+
   solver_details.iter = work->info->iter;
   solver_details.status_val = work->info->status_val;
   solver_details.primal_res = work->info->pri_res;
   solver_details.dual_res = work->info->dua_res;
-  solver_details.setup_time = work->info->setup_time;
+  solver_details.setup_time = reused_workspace ? 0 : work->info->setup_time;
+  solver_details.update_time = reused_workspace ? work->info->update_time : 0;
   solver_details.solve_time = work->info->solve_time;
   solver_details.polish_time = work->info->polish_time;
   solver_details.run_time = work->info->run_time;
+  solver_details.reused_workspace = reused_workspace;
+
   if (osqp_exitflag) {
     solution_result = SolutionResult::kInvalidInput;
   } else {
@@ -318,19 +476,6 @@ void OsqpSolver::DoSolve(
     }
   }
   result->set_solution_result(solution_result);
-
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
 }
 
 }  // namespace solvers
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/solver_base.h"
 
@@ -20,16 +23,38 @@ struct OsqpSolverDetails {
   double primal_res{};
   /// Norm of dual residue.
   double dual_res{};
-  /// Time taken for setup phase (seconds).
+  /// Time taken for setup phase (seconds). Zero if the workspace of the
+  /// previous solve was reused.
   double setup_time{};
+  /// Time taken to update the data of a reused workspace (seconds). Zero if a
+  /// new workspace was set up.
+  double update_time{};
   /// Time taken for solve phase (seconds).
   double solve_time{};
   /// Time taken for polish phase (seconds).
   double polish_time{};
   /// Total OSQP time (seconds).
   double run_time{};
+  /// Whether the workspace of the previous solve was reused; see OsqpSolver.
+  bool reused_workspace{};
 };
 
+/**
+ * Solves convex quadratic programs with OSQP.
+ *
+ * Each OsqpSolver keeps the OSQP workspace of its most recent solve. When the
+ * next program it solves has the same sparsity pattern (the same number of
+ * variables and constraints, and the same nonzero entries of the cost Hessian
+ * and of the constraint matrix) and the same solver options, that workspace is
+ * updated in place instead of being set up again, which skips the symbolic
+ * factorization of the KKT system and also skips the numerical factorization
+ * if only the linear costs or the bounds changed. This suits controllers that
+ * solve a QP of fixed structure at every step; to also warm-start such a
+ * solve, pass the previous result's solution as the initial guess.
+ *
+ * Solve() may be called concurrently; a call made while another thread is
+ * using the kept workspace solves in a workspace of its own.
+ */
 class OsqpSolver final : public SolverBase {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolver)
@@ -53,6 +78,14 @@ class OsqpSolver final : public SolverBase {
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  class Workspace;
+
+  // The workspace of the most recent solve, guarded by workspace_mutex_. This
+  // is a shared_ptr so that ~OsqpSolver() does not need the Workspace
+  // definition, which only exists when OSQP is available.
+  mutable std::shared_ptr<Workspace> workspace_;
+  mutable std::mutex workspace_mutex_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -171,7 +171,11 @@ void ParseLinearConstraint(const MathematicalProgram& prog,
     const Eigen::VectorXd& ub = linear_constraint.evaluator()->upper_bound();
     const Eigen::VectorXd& lb = linear_constraint.evaluator()->lower_bound();
     const VectorXDecisionVariable& x = linear_constraint.variables();
-    const Eigen::MatrixXd& Ai = linear_constraint.evaluator()->A();
+    // x_indices[j] is the index of x(j).
+    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    // Visit Ai row by row.
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> Ai =
+        linear_constraint.evaluator()->get_sparse_A();
     for (int i = 0; i < linear_constraint.evaluator()->num_constraints();
          ++i) {
       const bool is_ub_finite{!std::isinf(ub(i))};
@@ -185,17 +189,17 @@ void ParseLinearConstraint(const MathematicalProgram& prog,
         // matrix A, in the row upper_bound_row_index.
         const int upper_bound_row_index =
             *A_row_count + num_linear_constraint_rows + (is_lb_finite ? 1 : 0);
-        for (int j = 0; j < x.rows(); ++j) {
-          if (Ai(i, j) != 0) {
-            const int xj_index = prog.FindDecisionVariableIndex(x(j));
-            if (is_ub_finite) {
-              A_triplets->emplace_back(upper_bound_row_index, xj_index,
-                                       Ai(i, j));
-            }
-            if (is_lb_finite) {
-              A_triplets->emplace_back(lower_bound_row_index, xj_index,
-                                       -Ai(i, j));
-            }
+        for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+                 Ai, i);
+             it; ++it) {
+          const int xj_index = x_indices[it.col()];
+          if (is_ub_finite) {
+            A_triplets->emplace_back(upper_bound_row_index, xj_index,
+                                     it.value());
+          }
+          if (is_lb_finite) {
+            A_triplets->emplace_back(lower_bound_row_index, xj_index,
+                                     -it.value());
           }
         }
         if (is_lb_finite) {
@@ -222,10 +226,9 @@ void ParseLinearEqualityConstraint(
   // A x + s = b. s in zero cone.
   for (const auto& linear_equality_constraint :
        prog.linear_equality_constraints()) {
-    const Eigen::SparseMatrix<double> Ai =
-        linear_equality_constraint.evaluator()->GetSparseMatrix();
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(Ai);
+        math::SparseMatrixToTriplets(
+            linear_equality_constraint.evaluator()->get_sparse_A());
     A_triplets->reserve(A_triplets->size() + Ai_triplets.size());
     const solvers::VectorXDecisionVariable& x =
         linear_equality_constraint.variables();
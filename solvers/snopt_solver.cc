@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <deque>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -17,6 +18,7 @@
 #include "snopt.h"
 
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
 
@@ -236,12 +238,18 @@ class SnoptUserFunInfo {
   // Pointers to the parameters ('prog' and 'nonlinear_cost_gradient_indices')
   // are retained internally, so the supplied objects must have lifetimes longer
   // than the SnoptUserFuncInfo object.
-  explicit SnoptUserFunInfo(const MathematicalProgram* prog)
+  // If `thread_pool` is non-null, the thread-safe constraints are evaluated
+  // in parallel on it.
+  SnoptUserFunInfo(const MathematicalProgram* prog,
+                   drake::internal::ThreadPool* thread_pool)
       : this_pointer_as_int_array_(MakeThisAsInts()),
-        prog_(*prog) {}
+        prog_(*prog),
+        thread_pool_(thread_pool) {}
 
   const MathematicalProgram& mathematical_program() const { return prog_; }
 
+  drake::internal::ThreadPool* thread_pool() const { return thread_pool_; }
+
   std::set<int>& nonlinear_cost_gradient_indices() {
     return nonlinear_cost_gradient_indices_;
   }
@@ -291,6 +299,7 @@ class SnoptUserFunInfo {
 
   const std::array<int, kIntCount> this_pointer_as_int_array_;
   const MathematicalProgram& prog_;
+  drake::internal::ThreadPool* const thread_pool_;
   std::set<int> nonlinear_cost_gradient_indices_;
 };
 
@@ -339,27 +348,48 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
   return 1;
 }
 
-// Evaluate a single nonlinear constraints. For generic Constraint,
-// LorentzConeConstraint, RotatedLorentzConeConstraint, we call Eval function
-// of the constraint directly. For some other constraint, such as
-// LinearComplementaryConstraint, we will evaluate its nonlinear constraint
-// differently, than its Eval function.
+// Return the number of nonzero entries in the gradient of the nonlinear
+// constraint, which is bound to `num_variables` variables.
 template <typename C>
-void EvaluateSingleNonlinearConstraint(const C& constraint,
-                                       const Eigen::VectorXd& this_x,
-                                       AutoDiffVecXd* ty) {
-  ty->resize(SingleNonlinearConstraintSize(constraint));
-  constraint.Eval(math::initializeAutoDiff(this_x), ty);
+int SingleNonlinearConstraintNumGradients(const C& constraint,
+                                          int num_variables) {
+  const auto& pattern = constraint.gradient_sparsity_pattern();
+  return pattern ? pattern->size()
+                 : constraint.num_constraints() * num_variables;
 }
 
 template <>
-void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
+int SingleNonlinearConstraintNumGradients<LinearComplementarityConstraint>(
+    const LinearComplementarityConstraint& constraint, int) {
+  return constraint.M().rows();
+}
+
+// Evaluate a single nonlinear constraints, storing its value in F and the
+// nonzero entries of its gradient in G, in the order given by
+// UpdateConstraintBoundsAndGradients(). Return the number of gradient entries.
+// For generic Constraint, LorentzConeConstraint, RotatedLorentzConeConstraint,
+// we call Eval function of the constraint directly. For some other
+// constraint, such as LinearComplementaryConstraint, we will evaluate its
+// nonlinear constraint differently, than its Eval function.
+template <typename C>
+int EvaluateSingleNonlinearConstraint(const C& constraint,
+                                      const Eigen::VectorXd& this_x,
+                                      double F[], double G[]) {
+  return internal::EvalSparseGradient(constraint, this_x, F, G);
+}
+
+template <>
+int EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
     const LinearComplementarityConstraint& constraint,
-    const Eigen::VectorXd& this_x, AutoDiffVecXd* ty) {
-  ty->resize(1);
+    const Eigen::VectorXd& this_x, double F[], double G[]) {
   auto tx = math::initializeAutoDiff(this_x);
-  (*ty)(0) = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
-                    constraint.q().cast<AutoDiffXd>());
+  const AutoDiffXd ty = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
+                               constraint.q().cast<AutoDiffXd>());
+  F[0] = ty.value();
+  for (int j = 0; j < this_x.rows(); ++j) {
+    G[j] = ty.derivatives()(j);
+  }
+  return this_x.rows();
 }
 
 /*
@@ -374,36 +404,34 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
  * @param xvec the value of the decision variables.
+ * @param parallel_evaluations If non-null, the evaluations of the thread-safe
+ * constraints are appended to it instead of being run.
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, double F[], double G[],
-    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
-  Eigen::VectorXd this_x;
+    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec,
+    std::vector<std::function<void()>>* parallel_evaluations) {
   for (const auto& binding : constraint_list) {
     const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
-
     const int num_variables = binding.GetNumElements();
-    this_x.resize(num_variables);
-    for (int i = 0; i < num_variables; ++i) {
-      this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
-    }
-
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
-
-    for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
-    }
-
-    for (int i = 0; i < num_constraints; i++) {
-      for (int j = 0; j < num_variables; ++j) {
-        G[(*grad_index)++] = ty(i).derivatives()(j);
+    auto evaluate = [&prog, &binding, &xvec, num_variables,
+                     F = F + *constraint_index, G = G + *grad_index]() {
+      Eigen::VectorXd this_x(num_variables);
+      for (int i = 0; i < num_variables; ++i) {
+        this_x(i) =
+            xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
       }
+      EvaluateSingleNonlinearConstraint(*binding.evaluator(), this_x, F, G);
+    };
+    if (parallel_evaluations != nullptr && c->is_thread_safe()) {
+      parallel_evaluations->emplace_back(std::move(evaluate));
+    } else {
+      evaluate();
     }
+    *constraint_index += SingleNonlinearConstraintSize(*c);
+    *grad_index += SingleNonlinearConstraintNumGradients(*c, num_variables);
   }
 }
 
@@ -519,18 +547,26 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   // first row.
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
+  std::vector<std::function<void()>> parallel_evaluations;
+  std::vector<std::function<void()>>* const parallel =
+      info.thread_pool() != nullptr ? &parallel_evaluations : nullptr;
   EvaluateNonlinearConstraints(current_problem,
                                current_problem.generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec, parallel);
   EvaluateNonlinearConstraints(current_problem,
                                current_problem.lorentz_cone_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec, parallel);
   EvaluateNonlinearConstraints(
       current_problem, current_problem.rotated_lorentz_cone_constraints(), F, G,
-      &constraint_index, &grad_index, xvec);
+      &constraint_index, &grad_index, xvec, parallel);
   EvaluateNonlinearConstraints(
       current_problem, current_problem.linear_complementarity_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+      G, &constraint_index, &grad_index, xvec, parallel);
+  if (!parallel_evaluations.empty()) {
+    info.thread_pool()->ParallelFor(
+        parallel_evaluations.size(),
+        [&parallel_evaluations](int i) { parallel_evaluations[i](); });
+  }
 }
 
 /*
@@ -548,7 +584,8 @@ void UpdateNumNonlinearConstraintsAndGradients(
   for (auto const& binding : constraint_list) {
     auto const& c = binding.evaluator();
     int n = c->num_constraints();
-    *max_num_gradients += n * binding.GetNumElements();
+    *max_num_gradients +=
+        SingleNonlinearConstraintNumGradients(*c, binding.GetNumElements());
     *num_nonlinear_constraints += n;
   }
 }
@@ -586,14 +623,24 @@ void UpdateConstraintBoundsAndGradients(
       (*Fupp)[constraint_index_i] = ub(i);
     }
 
-    for (int i = 0; i < n; i++) {
-      for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+    if (c->gradient_sparsity_pattern()) {
+      for (const auto& nonzero : *c->gradient_sparsity_pattern()) {
         // Fortran is 1-indexed.
-        (*iGfun)[*grad_index] = 1 + *constraint_index + i;  // row order
-        (*jGvar)[*grad_index] =
-            1 + prog.FindDecisionVariableIndex(binding.variables()(j));
+        (*iGfun)[*grad_index] = 1 + *constraint_index + nonzero.first;
+        (*jGvar)[*grad_index] = 1 + prog.FindDecisionVariableIndex(
+                                        binding.variables()(nonzero.second));
         (*grad_index)++;
       }
+    } else {
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+          // Fortran is 1-indexed.
+          (*iGfun)[*grad_index] = 1 + *constraint_index + i;  // row order
+          (*jGvar)[*grad_index] =
+              1 + prog.FindDecisionVariableIndex(binding.variables()(j));
+          (*grad_index)++;
+        }
+      }
     }
 
     (*constraint_index) += n;
@@ -727,11 +774,12 @@ void SolveWithGivenOptions(
     const std::unordered_map<std::string, std::string>& snopt_options_string,
     const std::unordered_map<std::string, int>& snopt_options_int,
     const std::unordered_map<std::string, double>& snopt_options_double,
-    int* snopt_status, double* objective, EigenPtr<Eigen::VectorXd> x_val,
+    drake::internal::ThreadPool* thread_pool, int* snopt_status,
+    double* objective, EigenPtr<Eigen::VectorXd> x_val,
     SnoptSolverDetails* solver_details) {
   DRAKE_ASSERT(x_val->rows() == prog.num_vars());
 
-  SnoptUserFunInfo user_info(&prog);
+  SnoptUserFunInfo user_info(&prog, thread_pool);
   WorkspaceStorage storage(&user_info);
 
   std::string print_file_name;
@@ -1017,8 +1065,9 @@ void SnoptSolver::DoSolve(
       result->SetSolverDetailsType<SnoptSolverDetails>();
   SolveWithGivenOptions(prog, initial_guess, merged_options.GetOptionsStr(id()),
                         merged_options.GetOptionsInt(id()),
-                        merged_options.GetOptionsDouble(id()), &snopt_status,
-                        &objective, &x_val, &solver_details);
+                        merged_options.GetOptionsDouble(id()),
+                        thread_pool_.get(), &snopt_status, &objective, &x_val,
+                        &solver_details);
 
   // Populate our results structure.
   const SolutionResult solution_result =
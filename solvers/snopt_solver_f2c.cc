@@ -6,6 +6,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <map>
 #include <unordered_set>
@@ -13,6 +14,7 @@
 #include <vector>
 
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
 
@@ -161,6 +163,8 @@ struct SNOPTData final {
 struct SnoptUserFunInfo {
   const MathematicalProgram* prog_;
   const std::unordered_set<int>* cost_gradient_indices_;
+  // If non-null, the thread-safe constraints are evaluated in parallel on it.
+  drake::internal::ThreadPool* thread_pool_;
 };
 
 struct SNOPTRun {
@@ -249,7 +253,25 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
   return 1;
 }
 
-// Evaluate a single nonlinear constraints. For generic Constraint,
+// Return the number of nonzero entries in the gradient of the nonlinear
+// constraint, which is bound to `num_variables` variables.
+template <typename C>
+int SingleNonlinearConstraintNumGradients(const C& constraint,
+                                          int num_variables) {
+  const auto& pattern = constraint.gradient_sparsity_pattern();
+  return pattern ? pattern->size()
+                 : constraint.num_constraints() * num_variables;
+}
+
+template <>
+int SingleNonlinearConstraintNumGradients<LinearComplementarityConstraint>(
+    const LinearComplementarityConstraint& constraint, int) {
+  return constraint.M().rows();
+}
+
+// Evaluate a single nonlinear constraints, storing its value in F and the
+// nonzero entries of its gradient in G, in the order given by
+// UpdateConstraintBoundsAndGradients(). For generic Constraint,
 // LorentzConeConstraint, RotatedLorentzConeConstraint, we call Eval function
 // of the constraint directly. For some other constraint, such as
 // LinearComplementaryConstraint, we will evaluate its nonlinear constraint
@@ -257,19 +279,23 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
 template <typename C>
 void EvaluateSingleNonlinearConstraint(const C& constraint,
                                        const Eigen::VectorXd& this_x,
-                                       AutoDiffVecXd* ty) {
-  ty->resize(SingleNonlinearConstraintSize(constraint));
-  constraint.Eval(math::initializeAutoDiff(this_x), ty);
+                                       snopt::doublereal F[],
+                                       snopt::doublereal G[]) {
+  internal::EvalSparseGradient(constraint, this_x, F, G);
 }
 
 template <>
 void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
     const LinearComplementarityConstraint& constraint,
-    const Eigen::VectorXd& this_x, AutoDiffVecXd* ty) {
-  ty->resize(1);
+    const Eigen::VectorXd& this_x, snopt::doublereal F[],
+    snopt::doublereal G[]) {
   auto tx = math::initializeAutoDiff(this_x);
-  (*ty)(0) = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
-                    constraint.q().cast<AutoDiffXd>());
+  const AutoDiffXd ty = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
+                               constraint.q().cast<AutoDiffXd>());
+  F[0] = static_cast<snopt::doublereal>(ty.value());
+  for (int j = 0; j < this_x.rows(); ++j) {
+    G[j] = static_cast<snopt::doublereal>(ty.derivatives()(j));
+  }
 }
 
 /*
@@ -283,42 +309,36 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * optimization problem.
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
- * @param tx the AutoDiffMatrixType that stores the value of the decision
- * variable.
+ * @param xvec the value of the decision variables.
+ * @param parallel_evaluations If non-null, the evaluations of the thread-safe
+ * constraints are appended to it instead of being run.
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, snopt::doublereal F[],
     snopt::doublereal G[], size_t* constraint_index, size_t* grad_index,
-    const Eigen::VectorXd& xvec) {
-  Eigen::VectorXd this_x;
+    const Eigen::VectorXd& xvec,
+    std::vector<std::function<void()>>* parallel_evaluations) {
   for (const auto& binding : constraint_list) {
     const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
-
-    int num_v_variables = binding.GetNumElements();
-    this_x.resize(num_v_variables);
-    for (int i = 0; i < num_v_variables; ++i) {
-      this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
-    }
-
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
-
-    for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
-         i++) {
-      F[(*constraint_index)++] = static_cast<snopt::doublereal>(ty(i).value());
-    }
-
-    for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
-         i++) {
-      for (int j = 0; j < num_v_variables; ++j) {
-        G[(*grad_index)++] =
-            static_cast<snopt::doublereal>(ty(i).derivatives()(j));
+    const int num_v_variables = binding.GetNumElements();
+    auto evaluate = [&prog, &binding, &xvec, num_v_variables,
+                     F = F + *constraint_index, G = G + *grad_index]() {
+      Eigen::VectorXd this_x(num_v_variables);
+      for (int i = 0; i < num_v_variables; ++i) {
+        this_x(i) =
+            xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
       }
+      EvaluateSingleNonlinearConstraint(*binding.evaluator(), this_x, F, G);
+    };
+    if (parallel_evaluations != nullptr && c->is_thread_safe()) {
+      parallel_evaluations->emplace_back(std::move(evaluate));
+    } else {
+      evaluate();
     }
+    *constraint_index += SingleNonlinearConstraintSize(*c);
+    *grad_index += SingleNonlinearConstraintNumGradients(*c, num_v_variables);
   }
 }
 
@@ -415,18 +435,29 @@ int snopt_userfun(snopt::integer* Status, snopt::integer* n,
   // first row.
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
+  drake::internal::ThreadPool* const thread_pool =
+      snopt_userfun_info->thread_pool_;
+  std::vector<std::function<void()>> parallel_evaluations;
+  std::vector<std::function<void()>>* const parallel =
+      thread_pool != nullptr ? &parallel_evaluations : nullptr;
   EvaluateNonlinearConstraints(*current_problem,
                                current_problem->generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+                               &constraint_index, &grad_index, xvec, parallel);
   EvaluateNonlinearConstraints(*current_problem,
                                current_problem->lorentz_cone_constraints(), F,
-                               G, &constraint_index, &grad_index, xvec);
+                               G, &constraint_index, &grad_index, xvec,
+                               parallel);
   EvaluateNonlinearConstraints(
       *current_problem, current_problem->rotated_lorentz_cone_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+      G, &constraint_index, &grad_index, xvec, parallel);
   EvaluateNonlinearConstraints(
       *current_problem, current_problem->linear_complementarity_constraints(),
-      F, G, &constraint_index, &grad_index, xvec);
+      F, G, &constraint_index, &grad_index, xvec, parallel);
+  if (!parallel_evaluations.empty()) {
+    thread_pool->ParallelFor(
+        parallel_evaluations.size(),
+        [&parallel_evaluations](int k) { parallel_evaluations[k](); });
+  }
 
   return 0;
 }
@@ -446,7 +477,8 @@ void UpdateNumNonlinearConstraintsAndGradients(
   for (auto const& binding : constraint_list) {
     auto const& c = binding.evaluator();
     int n = c->num_constraints();
-    *max_num_gradients += n * binding.GetNumElements();
+    *max_num_gradients +=
+        SingleNonlinearConstraintNumGradients(*c, binding.GetNumElements());
     *num_nonlinear_constraints += n;
   }
 }
@@ -483,13 +515,22 @@ void UpdateConstraintBoundsAndGradients(
       Fupp[*constraint_index + i] = static_cast<snopt::doublereal>(ub(i));
     }
 
-    for (int i = 0; i < n; i++) {
-      for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
-        iGfun[*grad_index] = *constraint_index + i + 1;  // row order
-        jGvar[*grad_index] =
-            prog.FindDecisionVariableIndex(binding.variables()(j)) + 1;
+    if (c->gradient_sparsity_pattern()) {
+      for (const auto& nonzero : *c->gradient_sparsity_pattern()) {
+        iGfun[*grad_index] = *constraint_index + nonzero.first + 1;
+        jGvar[*grad_index] = prog.FindDecisionVariableIndex(
+                                 binding.variables()(nonzero.second)) + 1;
         (*grad_index)++;
       }
+    } else {
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+          iGfun[*grad_index] = *constraint_index + i + 1;  // row order
+          jGvar[*grad_index] =
+              prog.FindDecisionVariableIndex(binding.variables()(j)) + 1;
+          (*grad_index)++;
+        }
+      }
     }
 
     (*constraint_index) += n;
@@ -619,6 +660,7 @@ void SnoptSolver::DoSolve(
   SnoptUserFunInfo snopt_userfun_info;
   snopt_userfun_info.prog_ = &prog;
   snopt_userfun_info.cost_gradient_indices_ = &cost_gradient_indices;
+  snopt_userfun_info.thread_pool_ = thread_pool_.get();
   SNOPTRun cur(d, &snopt_userfun_info);
 
   snopt::integer nx = prog.num_vars();
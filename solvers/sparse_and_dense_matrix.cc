@@ -0,0 +1,63 @@
+#include "drake/solvers/sparse_and_dense_matrix.h"
+
+#include <utility>
+
+namespace drake {
+namespace solvers {
+namespace internal {
+SparseAndDenseMatrix::SparseAndDenseMatrix(
+    const Eigen::Ref<const Eigen::MatrixXd>& dense) {
+  SetFromDense(dense);
+}
+
+SparseAndDenseMatrix::SparseAndDenseMatrix(Eigen::SparseMatrix<double> sparse) {
+  SetFromSparse(std::move(sparse));
+}
+
+SparseAndDenseMatrix::~SparseAndDenseMatrix() = default;
+
+void SparseAndDenseMatrix::SetFromDense(
+    const Eigen::Ref<const Eigen::MatrixXd>& dense) {
+  rows_ = dense.rows();
+  cols_ = dense.cols();
+  dense_ = dense;
+  sparse_ = Eigen::SparseMatrix<double>();
+  is_dense_constructed_.store(true, std::memory_order_release);
+  is_sparse_constructed_.store(false, std::memory_order_release);
+}
+
+void SparseAndDenseMatrix::SetFromSparse(Eigen::SparseMatrix<double> sparse) {
+  rows_ = sparse.rows();
+  cols_ = sparse.cols();
+  sparse_ = std::move(sparse);
+  // Drops the zeros stored explicitly, which also compresses the matrix.
+  sparse_.prune(0.0);
+  dense_.resize(0, 0);
+  is_sparse_constructed_.store(true, std::memory_order_release);
+  is_dense_constructed_.store(false, std::memory_order_release);
+}
+
+const Eigen::SparseMatrix<double>& SparseAndDenseMatrix::GetAsSparse() const {
+  if (!is_sparse_constructed_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!is_sparse_constructed_.load(std::memory_order_relaxed)) {
+      sparse_ = dense_.sparseView();
+      is_sparse_constructed_.store(true, std::memory_order_release);
+    }
+  }
+  return sparse_;
+}
+
+const Eigen::MatrixXd& SparseAndDenseMatrix::GetAsDense() const {
+  if (!is_dense_constructed_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!is_dense_constructed_.load(std::memory_order_relaxed)) {
+      dense_ = sparse_;
+      is_dense_constructed_.store(true, std::memory_order_release);
+    }
+  }
+  return dense_;
+}
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
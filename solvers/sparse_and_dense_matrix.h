@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+/*
+ * Stores a matrix in either its sparse or its dense form, whichever it was
+ * given, and builds the other form only when it is first requested.
+ *
+ * LinearConstraint and QuadraticCost hold their coefficients in this class, so
+ * that the solvers consuming sparse matrices never pay for a dense copy, and
+ * the costs and constraints built from dense matrices never pay for a sparse
+ * one unless a solver asks for it. The missing form is built once, under a
+ * lock, since it may be requested concurrently from the evaluation of a
+ * thread-safe constraint.
+ */
+class SparseAndDenseMatrix {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseAndDenseMatrix)
+
+  /*
+   * Stores @p dense. The sparse form is built on the first call to
+   * GetAsSparse().
+   */
+  explicit SparseAndDenseMatrix(const Eigen::Ref<const Eigen::MatrixXd>& dense);
+
+  /*
+   * Stores @p sparse, without its explicitly stored zeros. The dense form is
+   * built on the first call to GetAsDense().
+   */
+  explicit SparseAndDenseMatrix(Eigen::SparseMatrix<double> sparse);
+
+  ~SparseAndDenseMatrix();
+
+  /*
+   * Replaces the matrix by @p dense. Must not be called concurrently with any
+   * other method.
+   */
+  void SetFromDense(const Eigen::Ref<const Eigen::MatrixXd>& dense);
+
+  /*
+   * Replaces the matrix by @p sparse. Must not be called concurrently with any
+   * other method.
+   */
+  void SetFromSparse(Eigen::SparseMatrix<double> sparse);
+
+  int rows() const { return rows_; }
+
+  int cols() const { return cols_; }
+
+  /*
+   * Returns the sparse form of the matrix, without its zero entries, building
+   * it if needed.
+   */
+  const Eigen::SparseMatrix<double>& GetAsSparse() const;
+
+  /*
+   * Returns the dense form of the matrix, building it if needed.
+   */
+  const Eigen::MatrixXd& GetAsDense() const;
+
+  /*
+   * Returns true if the sparse form of the matrix has been built, either at
+   * construction or by GetAsSparse().
+   */
+  bool is_sparse_constructed() const {
+    return is_sparse_constructed_.load(std::memory_order_acquire);
+  }
+
+  /*
+   * Returns true if the dense form of the matrix has been built, either at
+   * construction or by GetAsDense().
+   */
+  bool is_dense_constructed() const {
+    return is_dense_constructed_.load(std::memory_order_acquire);
+  }
+
+ private:
+  int rows_{};
+  int cols_{};
+  // The two forms of the matrix, each of which is only valid once its flag is
+  // true. At least one of them is always valid.
+  mutable Eigen::SparseMatrix<double> sparse_;
+  mutable Eigen::MatrixXd dense_;
+  mutable std::atomic<bool> is_sparse_constructed_{false};
+  mutable std::atomic<bool> is_dense_constructed_{false};
+  mutable std::mutex mutex_;
+};
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
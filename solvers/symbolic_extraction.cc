@@ -1,11 +1,13 @@
 #include "drake/solvers/symbolic_extraction.h"
 
+#include <algorithm>
 #include <ostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -23,7 +25,9 @@ using std::ostringstream;
 using std::pair;
 using std::runtime_error;
 using std::string;
+using std::tuple;
 using std::unordered_map;
+using std::vector;
 
 using symbolic::Expression;
 using symbolic::Formula;
@@ -149,6 +153,212 @@ void DecomposeQuadraticPolynomial(
   }
 }
 
+namespace {
+
+// Adds `scale * e` to @p quadratic when @p e is a sum of constant multiples
+// of constants, variables and, if @p max_degree is 2, products of two
+// variables or squares of a variable, in any nesting. The terms are appended
+// unsorted and may repeat.
+//
+// @retval false if @p e is not of that form, in which case @p quadratic holds
+// a part of its terms.
+bool AppendTerms(const Expression& e, double scale, int max_degree,
+                 SparseQuadraticExpression* quadratic) {
+  if (is_constant(e)) {
+    quadratic->constant_term += scale * get_constant_value(e);
+    return true;
+  }
+  if (is_variable(e)) {
+    quadratic->linear_terms.emplace_back(get_variable(e), scale);
+    return true;
+  }
+  if (is_addition(e)) {
+    quadratic->constant_term += scale * get_constant_in_addition(e);
+    for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+      if (!AppendTerms(p.first, scale * p.second, max_degree, quadratic)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (is_multiplication(e)) {
+    const double c = scale * get_constant_in_multiplication(e);
+    const map<Expression, Expression>& base_to_exponent =
+        get_base_to_exponent_map_in_multiplication(e);
+    auto it = base_to_exponent.begin();
+    if (base_to_exponent.size() == 1) {
+      // c * base^exponent.
+      if (is_one(it->second)) {
+        return AppendTerms(it->first, c, max_degree, quadratic);
+      }
+      if (max_degree == 2 && is_two(it->second) && is_variable(it->first)) {
+        const Variable& x = get_variable(it->first);
+        quadratic->quadratic_terms.emplace_back(x, x, c);
+        return true;
+      }
+    } else if (max_degree == 2 && base_to_exponent.size() == 2) {
+      // c * x * y.
+      const Expression& base1 = it->first;
+      const Expression& exponent1 = it->second;
+      ++it;
+      const Expression& base2 = it->first;
+      const Expression& exponent2 = it->second;
+      if (is_variable(base1) && is_one(exponent1) && is_variable(base2) &&
+          is_one(exponent2)) {
+        quadratic->quadratic_terms.emplace_back(get_variable(base1),
+                                                get_variable(base2), c);
+        return true;
+      }
+    }
+    return false;
+  }
+  if (is_pow(e)) {
+    // x^2.
+    const Expression& base = get_first_argument(e);
+    if (max_degree == 2 && is_two(get_second_argument(e)) &&
+        is_variable(base)) {
+      const Variable& x = get_variable(base);
+      quadratic->quadratic_terms.emplace_back(x, x, scale);
+      return true;
+    }
+    return false;
+  }
+  if (is_division(e)) {
+    const Expression& denominator = get_second_argument(e);
+    if (is_constant(denominator)) {
+      return AppendTerms(get_first_argument(e),
+                         scale / get_constant_value(denominator), max_degree,
+                         quadratic);
+    }
+    return false;
+  }
+  return false;
+}
+
+// Sorts the linear terms by variable ID and sums those of the same variable.
+void MergeLinearTerms(vector<pair<Variable, double>>* linear_terms) {
+  std::sort(linear_terms->begin(), linear_terms->end(),
+            [](const pair<Variable, double>& a,
+               const pair<Variable, double>& b) {
+              return a.first.get_id() < b.first.get_id();
+            });
+  auto last = linear_terms->begin();
+  for (auto it = linear_terms->begin(); it != linear_terms->end(); ++it) {
+    if (it == last) continue;
+    if (it->first.get_id() == last->first.get_id()) {
+      last->second += it->second;
+    } else if (++last != it) {
+      *last = std::move(*it);
+    }
+  }
+  if (!linear_terms->empty()) {
+    linear_terms->erase(last + 1, linear_terms->end());
+  }
+}
+
+// Orders the variables of each quadratic term by ID, then sorts the terms and
+// sums those of the same pair of variables.
+void MergeQuadraticTerms(
+    vector<tuple<Variable, Variable, double>>* quadratic_terms) {
+  for (auto& term : *quadratic_terms) {
+    if (std::get<1>(term).get_id() < std::get<0>(term).get_id()) {
+      std::swap(std::get<0>(term), std::get<1>(term));
+    }
+  }
+  auto ids = [](const tuple<Variable, Variable, double>& term) {
+    return std::make_pair(std::get<0>(term).get_id(),
+                          std::get<1>(term).get_id());
+  };
+  std::sort(quadratic_terms->begin(), quadratic_terms->end(),
+            [&ids](const tuple<Variable, Variable, double>& a,
+                   const tuple<Variable, Variable, double>& b) {
+              return ids(a) < ids(b);
+            });
+  auto last = quadratic_terms->begin();
+  for (auto it = quadratic_terms->begin(); it != quadratic_terms->end();
+       ++it) {
+    if (it == last) continue;
+    if (ids(*it) == ids(*last)) {
+      std::get<2>(*last) += std::get<2>(*it);
+    } else if (++last != it) {
+      *last = std::move(*it);
+    }
+  }
+  if (!quadratic_terms->empty()) {
+    quadratic_terms->erase(last + 1, quadratic_terms->end());
+  }
+}
+
+// Decomposes @p e, of degree at most @p max_degree, by expanding it into a
+// symbolic::Polynomial. Every variable of @p e which the expansion cancels is
+// given a zero linear coefficient.
+bool DecomposeByExpansion(const Expression& e, int max_degree,
+                          SparseQuadraticExpression* quadratic) {
+  if (!e.is_polynomial()) {
+    return false;
+  }
+  const symbolic::Polynomial poly{e};
+  if (poly.TotalDegree() > max_degree) {
+    return false;
+  }
+  *quadratic = SparseQuadraticExpression{};
+  for (const auto& p : poly.monomial_to_coefficient_map()) {
+    const double coefficient = get_constant_value(p.second);
+    const auto& powers = p.first.get_powers();
+    if (powers.empty()) {
+      quadratic->constant_term += coefficient;
+    } else if (powers.size() == 2) {
+      quadratic->quadratic_terms.emplace_back(
+          powers.begin()->first, std::next(powers.begin())->first,
+          coefficient);
+    } else if (powers.begin()->second == 2) {
+      quadratic->quadratic_terms.emplace_back(
+          powers.begin()->first, powers.begin()->first, coefficient);
+    } else {
+      quadratic->linear_terms.emplace_back(powers.begin()->first, coefficient);
+    }
+  }
+  const symbolic::Variables poly_variables = poly.indeterminates();
+  for (const Variable& var : e.GetVariables()) {
+    if (!poly_variables.include(var)) {
+      quadratic->linear_terms.emplace_back(var, 0.0);
+    }
+  }
+  MergeLinearTerms(&quadratic->linear_terms);
+  MergeQuadraticTerms(&quadratic->quadratic_terms);
+  return true;
+}
+
+bool DoDecomposeQuadraticExpression(const Expression& e, int max_degree,
+                                    SparseQuadraticExpression* quadratic) {
+  *quadratic = SparseQuadraticExpression{};
+  if (!AppendTerms(e, 1.0, max_degree, quadratic)) {
+    return DecomposeByExpansion(e, max_degree, quadratic);
+  }
+  MergeLinearTerms(&quadratic->linear_terms);
+  MergeQuadraticTerms(&quadratic->quadratic_terms);
+  return true;
+}
+
+}  // namespace
+
+bool DecomposeAffineExpression(const Expression& e,
+                               SparseAffineExpression* affine) {
+  SparseQuadraticExpression quadratic;
+  if (!DoDecomposeQuadraticExpression(e, 1, &quadratic)) {
+    return false;
+  }
+  DRAKE_ASSERT(quadratic.quadratic_terms.empty());
+  affine->constant_term = quadratic.constant_term;
+  affine->linear_terms = std::move(quadratic.linear_terms);
+  return true;
+}
+
+bool DecomposeQuadraticExpression(const Expression& e,
+                                  SparseQuadraticExpression* quadratic) {
+  return DoDecomposeQuadraticExpression(e, 2, quadratic);
+}
+
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
@@ -3,9 +3,11 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -176,6 +178,59 @@ DecomposeLinearExpression(
   return num_variable;
 }
 
+/*
+ * An affine expression c + a₁ x₁ + ... + aₙ xₙ, stored as its constant term
+ * and the list of its linear terms. It is the sparse, lightweight counterpart
+ * of a symbolic::Expression known to be affine, from which the rows of
+ * LinearConstraint and LinearCost are assembled.
+ */
+struct SparseAffineExpression {
+  double constant_term{0};
+  // The pairs (xᵢ, aᵢ), sorted by the ID of xᵢ, with no variable repeated.
+  // Some aᵢ may be zero, for a variable whose terms cancel.
+  std::vector<std::pair<symbolic::Variable, double>> linear_terms;
+};
+
+/*
+ * A quadratic expression c + ∑ aᵢ xᵢ + ∑ qᵢⱼ xᵢ xⱼ, stored as its constant
+ * term and the lists of its linear and quadratic terms.
+ */
+struct SparseQuadraticExpression {
+  double constant_term{0};
+  // As in SparseAffineExpression.
+  std::vector<std::pair<symbolic::Variable, double>> linear_terms;
+  // The triples (xᵢ, xⱼ, qᵢⱼ) with ID(xᵢ) <= ID(xⱼ), sorted by those IDs,
+  // with no pair of variables repeated.
+  std::vector<std::tuple<symbolic::Variable, symbolic::Variable, double>>
+      quadratic_terms;
+};
+
+/*
+ * Decomposes the expression @p e into @p affine if it is affine.
+ *
+ * Sums, products with and divisions by constants of affine expressions are
+ * read off the expression tree directly, which is much cheaper than expanding
+ * @p e into a symbolic::Polynomial as DecomposeLinearExpression() does. Only
+ * the remaining expressions (e.g. `(x + 1) * (x - 1) - x * x`) are expanded.
+ * Either way, the variables of @p affine are those of `e.GetVariables()`.
+ *
+ * @retval true if @p e is affine, and then @p affine holds its terms.
+ */
+bool DecomposeAffineExpression(const symbolic::Expression& e,
+                               SparseAffineExpression* affine);
+
+/*
+ * Decomposes the expression @p e into @p quadratic if it is a polynomial of
+ * degree at most two, in the manner of DecomposeAffineExpression(). Products
+ * of two variables and squares of a variable are read off the expression tree
+ * as well. The variables of `e.GetVariables()` are those of the linear and
+ * quadratic terms together.
+ *
+ * @retval true if @p e is quadratic, and then @p quadratic holds its terms.
+ */
+bool DecomposeQuadraticExpression(const symbolic::Expression& e,
+                                  SparseQuadraticExpression* quadratic);
+
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -27,6 +28,11 @@ class MixedIntegerBranchAndBoundTester {
     return bnb_->PickBranchingNode();
   }
 
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_num_nodes) const {
+    return bnb_->PickBranchingNodes(max_num_nodes);
+  }
+
   const symbolic::Variable* PickBranchingVariable(
       const MixedIntegerBranchAndBoundNode& node) const {
     return bnb_->PickBranchingVariable(node);
@@ -680,6 +686,39 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingNode2) {
   EXPECT_EQ(dut.PickBranchingNode(), dut.bnb()->root()->right_child());
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingNodes) {
+  // Test choosing several nodes to branch in parallel.
+  auto prog = ConstructMathematicalProgram2();
+
+  MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id());
+  VectorDecisionVariable<5> x = dut.bnb()->root()->prog()->decision_variables();
+
+  dut.bnb()->SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kMinLowerBound);
+  using Nodes = std::vector<MixedIntegerBranchAndBoundNode*>;
+  EXPECT_EQ(dut.PickBranchingNodes(3), Nodes({dut.mutable_root()}));
+
+  // The left node has optimal cost -4.9, the right node has optimal cost -47.0
+  // / 30. Both are un-fathomed.
+  dut.mutable_root()->Branch(x(4));
+  MixedIntegerBranchAndBoundNode* left =
+      dut.mutable_root()->mutable_left_child();
+  MixedIntegerBranchAndBoundNode* right =
+      dut.mutable_root()->mutable_right_child();
+  EXPECT_EQ(dut.PickBranchingNodes(1), Nodes({left}));
+  EXPECT_EQ(dut.PickBranchingNodes(2), Nodes({left, right}));
+  EXPECT_EQ(dut.PickBranchingNodes(3), Nodes({left, right}));
+
+  // A user-defined node selection function picks a single node.
+  dut.bnb()->SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kUserDefined);
+  dut.bnb()->SetUserDefinedNodeSelectionFunction(
+      [right](const MixedIntegerBranchAndBound&) { return right; });
+  EXPECT_EQ(dut.PickBranchingNodes(3), Nodes({right}));
+
+  EXPECT_THROW(dut.bnb()->set_num_threads(0), std::exception);
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingVariable1) {
   // Test picking branching variable for prog 2.
   auto prog = ConstructMathematicalProgram2();
@@ -890,6 +929,30 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve2) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+
+  MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id());
+  dut.bnb()->set_num_threads(3);
+  EXPECT_EQ(dut.bnb()->num_threads(), 3);
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      dut.bnb()->SetNodeSelectionMethod(pick_node);
+      dut.bnb()->SetVariableSelectionMethod(pick_variable);
+
+      const SolutionResult solution_result = dut.bnb()->Solve();
+      EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+      const double tol{1E-3};
+      EXPECT_NEAR(dut.bnb()->GetOptimalCost(), -13.0 / 3, tol);
+      Eigen::Matrix<double, 5, 1> x_expected0;
+      x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+      EXPECT_TRUE(CompareMatrices(dut.bnb()->GetSolution(x, 0), x_expected0,
+                                  tol, MatrixCompareType::absolute));
+    }
+  }
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve3) {
   auto prog = ConstructMathematicalProgram3();
   const VectorDecisionVariable<4> x = prog->decision_variables();
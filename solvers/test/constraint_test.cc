@@ -1,5 +1,8 @@
 #include "drake/solvers/constraint.h"
 
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/symbolic.h"
@@ -49,6 +52,10 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), b));
   EXPECT_TRUE(CompareMatrices(constraint.A(), A));
   EXPECT_EQ(constraint.num_constraints(), 2);
+  // The gradient sparsity pattern is the nonzero entries of A.
+  using Pattern = std::vector<std::pair<int, int>>;
+  ASSERT_TRUE(constraint.gradient_sparsity_pattern());
+  EXPECT_EQ(*constraint.gradient_sparsity_pattern(), Pattern({{0, 0}, {1, 1}}));
 
   // Test Eval/CheckSatisfied using Expression.
   const VectorX<Variable> x_sym{symbolic::MakeVectorContinuousVariable(2, "x")};
@@ -75,6 +82,71 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), b3));
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
+  ASSERT_TRUE(constraint.gradient_sparsity_pattern());
+  EXPECT_EQ(*constraint.gradient_sparsity_pattern(),
+            Pattern({{0, 0}, {1, 0}, {2, 0}, {0, 1}, {1, 1}, {2, 1}}));
+}
+
+GTEST_TEST(testConstraint, testLinearConstraintSparse) {
+  // Constructs the constraint from a sparse matrix.
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.insert(0, 2) = 3;
+  A.insert(1, 0) = -1;
+  const Eigen::Vector2d lb(-1, 0);
+  const Eigen::Vector2d ub(1, 2);
+  const LinearConstraint constraint(A, lb, ub);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), MatrixXd(A)));
+  EXPECT_TRUE(CompareMatrices(constraint.lower_bound(), lb));
+  EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), ub));
+  EXPECT_EQ(constraint.num_vars(), 3);
+  using Pattern = std::vector<std::pair<int, int>>;
+  ASSERT_TRUE(constraint.gradient_sparsity_pattern());
+  EXPECT_EQ(*constraint.gradient_sparsity_pattern(), Pattern({{1, 0}, {0, 2}}));
+
+  const LinearEqualityConstraint equality(A, ub);
+  EXPECT_TRUE(CompareMatrices(equality.A(), MatrixXd(A)));
+  EXPECT_TRUE(CompareMatrices(equality.lower_bound(), ub));
+  EXPECT_TRUE(CompareMatrices(equality.upper_bound(), ub));
+}
+
+GTEST_TEST(testConstraint, testLinearConstraintSparseStorage) {
+  // A constraint constructed from a sparse matrix evaluates without building
+  // the dense matrix.
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.insert(0, 2) = 3;
+  A.insert(1, 0) = -1;
+  LinearConstraint constraint(A, Eigen::Vector2d::Zero(),
+                              Eigen::Vector2d::Ones());
+  const Eigen::Vector3d x(1, 2, 3);
+  Eigen::VectorXd y;
+  constraint.Eval(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, Eigen::Vector2d(9, -1)));
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(math::initializeAutoDiff(x), &y_autodiff);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y_autodiff), y));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y_autodiff),
+                              MatrixXd(A)));
+  EXPECT_EQ(constraint.get_sparse_A().nonZeros(), 2);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), MatrixXd(A)));
+
+  // Updates with a sparse matrix of a different number of rows.
+  Eigen::SparseMatrix<double> new_A(1, 3);
+  new_A.insert(0, 1) = 2;
+  constraint.UpdateCoefficients(new_A, Vector1d(0), Vector1d(1));
+  EXPECT_EQ(constraint.num_constraints(), 1);
+  constraint.Eval(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, Vector1d(4)));
+  using Pattern = std::vector<std::pair<int, int>>;
+  EXPECT_EQ(*constraint.gradient_sparsity_pattern(), Pattern({{0, 1}}));
+  EXPECT_THROW(constraint.UpdateCoefficients(Eigen::SparseMatrix<double>(1, 2),
+                                             Vector1d(0), Vector1d(1)),
+               std::runtime_error);
+
+  // A bounding box constraint stores a sparse identity matrix.
+  const BoundingBoxConstraint bounding_box(Eigen::Vector3d::Zero(),
+                                           Eigen::Vector3d::Ones());
+  EXPECT_EQ(bounding_box.get_sparse_A().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(bounding_box.A(), Eigen::Matrix3d::Identity()));
 }
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
@@ -194,6 +194,47 @@ GTEST_TEST(testCost, testQuadraticCost) {
   EXPECT_NEAR(y(0), obj_expected + c, tol);
 }
 
+GTEST_TEST(testCost, testQuadraticCostSparse) {
+  // Constructs the cost of testQuadraticCost from a sparse, asymmetric Q.
+  Eigen::Matrix2d Q;
+  Q << 1, 2, 3, 4;
+  const Eigen::SparseMatrix<double> Q_sparse = Q.sparseView();
+  const Eigen::Vector2d b(5, 6);
+  const Eigen::Vector2d x0(7, 8);
+  const double c = 100;
+  const double obj_expected = 375.5 + c;
+
+  QuadraticCost cost(Q_sparse, b, c);
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(cost.get_sparse_Q()),
+                              (Q + Q.transpose()) / 2, 1E-10,
+                              MatrixCompareType::absolute));
+  Eigen::VectorXd y(1);
+  cost.Eval(x0, &y);
+  EXPECT_NEAR(y(0), obj_expected, 1E-12);
+  // Evaluates with AutoDiffXd as well, before and after the dense Q is built.
+  const AutoDiffVecXd x0_autodiff = math::initializeAutoDiff(x0);
+  AutoDiffVecXd y_autodiff;
+  cost.Eval(x0_autodiff, &y_autodiff);
+  EXPECT_NEAR(y_autodiff(0).value(), obj_expected, 1E-12);
+  EXPECT_TRUE(CompareMatrices(cost.Q(), (Q + Q.transpose()) / 2, 1E-10,
+                              MatrixCompareType::absolute));
+  const Eigen::RowVector2d gradient =
+      x0.transpose() * cost.Q() + b.transpose();
+  EXPECT_TRUE(CompareMatrices(y_autodiff(0).derivatives().transpose(),
+                              gradient, 1E-12));
+
+  // Update with a sparse Q of a single entry.
+  Eigen::SparseMatrix<double> new_Q(2, 2);
+  new_Q.insert(1, 0) = 2;
+  cost.UpdateCoefficients(new_Q, b);
+  EXPECT_EQ(cost.get_sparse_Q().nonZeros(), 2);
+  cost.Eval(x0, &y);
+  EXPECT_NEAR(y(0), x0(0) * x0(1) + b.dot(x0), 1E-12);
+  EXPECT_THROW(
+      cost.UpdateCoefficients(Eigen::SparseMatrix<double>(3, 3), b, c),
+      runtime_error);
+}
+
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
 // MathematicalProgram.
 
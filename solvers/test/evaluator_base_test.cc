@@ -4,6 +4,8 @@
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -166,6 +168,60 @@ GTEST_TEST(EvaluatorBaseTest, FunctionEvaluatorTest) {
   VerifyFunctionEvaluator(MakeFunctionWrapped(callable, 3, 3), x);
 }
 
+GTEST_TEST(EvaluatorBaseTest, GradientSparsityPattern) {
+  // y = (x₀², x₁x₂, 3).
+  auto callable = [](const auto& x, auto* y) {
+    using T = typename std::decay_t<decltype(x)>::Scalar;
+    y->resize(3);
+    (*y)(0) = x(0) * x(0);
+    (*y)(1) = x(1) * x(2);
+    (*y)(2) = T(3);
+  };
+  shared_ptr<EvaluatorBase> evaluator =
+      MakeFunctionEvaluator(MakeFunctionWrapped(callable, 3, 3));
+  EXPECT_FALSE(evaluator->gradient_sparsity_pattern());
+
+  const Eigen::Vector3d x(2, 3, 5);
+  Eigen::Vector3d y;
+  const Eigen::Vector3d y_expected(4, 15, 3);
+  Eigen::Matrix3d dy_expected;
+  // clang-format off
+  dy_expected << 4, 0, 0,
+                 0, 5, 3,
+                 0, 0, 0;
+  // clang-format on
+
+  // Without a pattern, the whole gradient is evaluated in row-major order.
+  std::vector<double> gradient(9);
+  EXPECT_EQ(internal::EvalSparseGradient(*evaluator, x, y.data(),
+                                         gradient.data()),
+            9);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  EXPECT_TRUE(CompareMatrices(
+      Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>(
+          gradient.data()),
+      dy_expected));
+
+  // With a pattern, only its entries are evaluated, in its order.
+  const std::vector<std::pair<int, int>> pattern{{1, 2}, {0, 0}, {1, 1}};
+  evaluator->SetGradientSparsityPattern(pattern);
+  ASSERT_TRUE(evaluator->gradient_sparsity_pattern());
+  EXPECT_EQ(*evaluator->gradient_sparsity_pattern(), pattern);
+  gradient.assign(3, 0);
+  EXPECT_EQ(internal::EvalSparseGradient(*evaluator, x, y.data(),
+                                         gradient.data()),
+            3);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  EXPECT_EQ(gradient, std::vector<double>({3, 4, 5}));
+
+  // Entries must be in range.
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{3, 0}}),
+               std::invalid_argument);
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{0, -1}}),
+               std::invalid_argument);
+  EXPECT_EQ(*evaluator->gradient_sparsity_pattern(), pattern);
+}
+
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,75 @@
+#include "drake/solvers/evaluator_codegen.h"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace solvers {
+namespace {
+using symbolic::Expression;
+using symbolic::Variable;
+
+class EvaluatorCodeGenTest : public ::testing::Test {
+ protected:
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+};
+
+TEST_F(EvaluatorCodeGenTest, Code) {
+  // f(x, y) = [3x, y²].
+  const Vector2<Expression> f(3 * x_, y_ * y_);
+  EXPECT_EQ(CodeGenEvaluator("f", {x_, y_}, f),
+            R"""(void f(const double* p, double* m) {
+    m[0] = (3 * p[0]);
+    m[1] = pow(p[1], 2.000000);
+}
+typedef struct {
+    /* p: input, vector */
+    struct { int size; } p;
+    /* m: output, matrix */
+    struct { int rows; int cols; } m;
+} f_meta_t;
+f_meta_t f_meta() { return {{2}, {2, 1}}; }
+void f_jacobian(const double* p, int* outer_indices, int* )"""
+            R"""(inner_indices, double* values) {
+    outer_indices[0] = 0;
+    outer_indices[1] = 1;
+    outer_indices[2] = 2;
+    inner_indices[0] = 0;
+    inner_indices[1] = 1;
+    values[0] = 3.000000;
+    values[1] = (2 * p[1]);
+}
+typedef struct {
+    /* p: input, vector */
+    struct { int size; } p;
+    /* m: output, matrix */
+    struct {
+        int rows;
+        int cols;
+        int non_zeros;
+        int outer_indices;
+        int inner_indices;
+    } m;
+} f_jacobian_meta_t;
+f_jacobian_meta_t f_jacobian_meta() { return {{2}, {2, 2, 2, 3, 2}}; }
+)""");
+}
+
+TEST_F(EvaluatorCodeGenTest, ExpressionConstraint) {
+  const Vector2<Expression> f(x_ * y_, sin(y_));
+  const ExpressionConstraint constraint(f, Eigen::Vector2d::Zero(),
+                                        Eigen::Vector2d::Ones());
+  const VectorXDecisionVariable& vars = constraint.vars();
+  EXPECT_EQ(CodeGenEvaluator("g", constraint),
+            CodeGenEvaluator("g", {vars(0), vars(1)}, f));
+}
+
+TEST_F(EvaluatorCodeGenTest, UnknownVariable) {
+  const Vector1<Expression> f(x_ + y_);
+  EXPECT_THROW(CodeGenEvaluator("f", {x_}, f), std::runtime_error);
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,102 @@
+#include "drake/solvers/generated_evaluator.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/solvers/test/generated_evaluator_test_functions.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+namespace {
+// The evaluator is generated for f(x, y) = [x sin(y), x² + 3, 2y].
+std::shared_ptr<GeneratedEvaluator> MakeEvaluator() {
+  return MakeGeneratedEvaluator(&f, f_meta(), &f_jacobian, f_jacobian_meta(),
+                                "f");
+}
+
+GTEST_TEST(GeneratedEvaluatorTest, Sizes) {
+  const auto evaluator = MakeEvaluator();
+  EXPECT_EQ(evaluator->num_outputs(), 3);
+  EXPECT_EQ(evaluator->num_vars(), 2);
+  EXPECT_EQ(evaluator->get_description(), "f");
+  EXPECT_TRUE(evaluator->is_thread_safe());
+  // ∂f₂/∂y and ∂f₃/∂x are identically zero.
+  const std::vector<std::pair<int, int>> expected_pattern{
+      {0, 0}, {1, 0}, {0, 1}, {2, 1}};
+  ASSERT_TRUE(evaluator->gradient_sparsity_pattern().has_value());
+  EXPECT_EQ(evaluator->gradient_sparsity_pattern().value(), expected_pattern);
+}
+
+GTEST_TEST(GeneratedEvaluatorTest, EvalDouble) {
+  const auto evaluator = MakeEvaluator();
+  const Eigen::Vector2d x(2, 0.5);
+  Eigen::VectorXd y;
+  evaluator->Eval(x, &y);
+  EXPECT_TRUE(CompareMatrices(
+      y, Eigen::Vector3d(2 * std::sin(0.5), 7, 1), 1E-14));
+}
+
+GTEST_TEST(GeneratedEvaluatorTest, EvalAutoDiff) {
+  const auto evaluator = MakeEvaluator();
+  // Differentiates with respect to z, where x = [z₀ + z₂, z₁].
+  AutoDiffVecXd x(2);
+  x(0).value() = 2;
+  x(0).derivatives() = Eigen::Vector3d(1, 0, 1);
+  x(1).value() = 0.5;
+  x(1).derivatives() = Eigen::Vector3d(0, 1, 0);
+  AutoDiffVecXd y;
+  evaluator->Eval(x, &y);
+
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y),
+                              Eigen::Vector3d(2 * std::sin(0.5), 7, 1),
+                              1E-14));
+  Eigen::Matrix<double, 3, 2> dfdx;
+  // clang-format off
+  dfdx << std::sin(0.5), 2 * std::cos(0.5),
+          4,             0,
+          0,             2;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y),
+                              dfdx * math::autoDiffToGradientMatrix(x),
+                              1E-14));
+}
+
+GTEST_TEST(GeneratedEvaluatorTest, ConcurrentEval) {
+  const auto evaluator = MakeEvaluator();
+  std::vector<Eigen::VectorXd> results(4);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+    threads.emplace_back([&evaluator, &results, i]() {
+      AutoDiffVecXd y;
+      evaluator->Eval(math::initializeAutoDiff(Eigen::Vector2d(i, 1)), &y);
+      results[i] = math::autoDiffToGradientMatrix(y).col(0);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+    EXPECT_TRUE(CompareMatrices(results[i],
+                                Eigen::Vector3d(std::sin(1), 2 * i, 0)));
+  }
+}
+
+GTEST_TEST(GeneratedEvaluatorTest, InconsistentMeta) {
+  f_meta_t value_meta = f_meta();
+  value_meta.p.size = 3;
+  EXPECT_THROW(MakeGeneratedEvaluator(&f, value_meta, &f_jacobian,
+                                      f_jacobian_meta()),
+               std::runtime_error);
+}
+}  // namespace
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
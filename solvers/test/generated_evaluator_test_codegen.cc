@@ -0,0 +1,30 @@
+// Prints the code of the evaluator used by generated_evaluator_test.
+
+#include <iostream>
+
+#include "drake/solvers/evaluator_codegen.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+int do_main() {
+  const symbolic::Variable x("x");
+  const symbolic::Variable y("y");
+  // f(x, y) = [x sin(y), x² + 3, 2y].
+  Vector3<symbolic::Expression> f(x * sin(y), x * x + 3, 2 * y);
+  std::cout << "#pragma once\n"
+            << "#include <math.h>\n"
+            << "namespace drake {\n"
+            << "namespace solvers {\n"
+            << "namespace test {\n"
+            << CodeGenEvaluator("f", {x, y}, f)
+            << "}  // namespace test\n"
+            << "}  // namespace solvers\n"
+            << "}  // namespace drake\n";
+  return 0;
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
+
+int main() { return drake::solvers::do_main(); }
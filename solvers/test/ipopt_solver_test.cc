@@ -1,7 +1,10 @@
 #include "drake/solvers/ipopt_solver.h"
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -75,6 +78,43 @@ GTEST_TEST(QPtest, TestUnitBallExample) {
   }
 }
 
+// Minimizes the sum of x subject to each consecutive pair of entries of x lying
+// in the unit disc, with the (thread-safe) Lorentz cone constraints evaluated
+// serially and in parallel.
+GTEST_TEST(IpoptSolverTest, ParallelConstraintEvaluation) {
+  IpoptSolver solver;
+  EXPECT_EQ(solver.num_threads(), 1);
+  EXPECT_THROW(solver.set_num_threads(0), std::exception);
+  if (solver.available()) {
+    const int kNumDiscs = 8;
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(2 * kNumDiscs);
+    prog.AddLinearCost(Eigen::VectorXd::Ones(2 * kNumDiscs), x);
+    Eigen::Matrix<double, 3, 2> A;
+    A << 0, 0, 1, 0, 0, 1;
+    const Eigen::Vector3d b(1, 0, 0);
+    for (int i = 0; i < kNumDiscs; ++i) {
+      const auto binding =
+          prog.AddLorentzConeConstraint(A, b, x.segment<2>(2 * i));
+      EXPECT_TRUE(binding.evaluator()->is_thread_safe());
+    }
+    const Eigen::VectorXd x_init = Eigen::VectorXd::Constant(2 * kNumDiscs, 0.1);
+
+    const auto serial_result = solver.Solve(prog, x_init, {});
+    solver.set_num_threads(3);
+    EXPECT_EQ(solver.num_threads(), 3);
+    const auto parallel_result = solver.Solve(prog, x_init, {});
+
+    ASSERT_TRUE(serial_result.is_success());
+    ASSERT_TRUE(parallel_result.is_success());
+    EXPECT_TRUE(CompareMatrices(
+        serial_result.GetSolution(x),
+        Eigen::VectorXd::Constant(2 * kNumDiscs, -std::sqrt(0.5)), 1e-6));
+    EXPECT_TRUE(CompareMatrices(parallel_result.GetSolution(x),
+                                serial_result.GetSolution(x), 0.0));
+  }
+}
+
 class NoisyQuadraticCost {
  public:
   explicit NoisyQuadraticCost(const double max_noise)
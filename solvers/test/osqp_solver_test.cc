@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -139,6 +141,142 @@ GTEST_TEST(OsqpSolverTest, SolverOptionsTest) {
     EXPECT_NE(result.get_solver_details<OsqpSolver>().status_val, OSQP_SOLVED);
   }
 }
+
+GTEST_TEST(OsqpSolverTest, WarmStartTest) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  prog.AddLinearConstraint(x(0) + 2 * x(1) - 3 * x(2) <= 3);
+  prog.AddLinearConstraint(4 * x(0) - 2 * x(1) - 6 * x(2) >= -3);
+  prog.AddQuadraticCost(x(0) * x(0) + 2 * x(1) * x(1) + 5 * x(2) * x(2) +
+                        2 * x(1) * x(2));
+  prog.AddLinearConstraint(8 * x(0) - x(1) == 2);
+
+  OsqpSolver osqp_solver;
+  if (osqp_solver.available()) {
+    MathematicalProgramResult cold_result;
+    osqp_solver.Solve(prog, {}, {}, &cold_result);
+    ASSERT_TRUE(cold_result.is_success());
+
+    // Starting from the solution, or from a partial guess, converges to the
+    // same solution.
+    const Eigen::Vector3d x_sol = cold_result.GetSolution(x);
+    const double kNaN = std::numeric_limits<double>::quiet_NaN();
+    for (const Eigen::Vector3d& guess :
+         {x_sol, Eigen::Vector3d(x_sol(0), kNaN, x_sol(2))}) {
+      MathematicalProgramResult warm_result;
+      osqp_solver.Solve(prog, guess, {}, &warm_result);
+      ASSERT_TRUE(warm_result.is_success());
+      EXPECT_TRUE(CompareMatrices(warm_result.GetSolution(x), x_sol, 1e-5));
+    }
+  }
+}
+
+GTEST_TEST(OsqpSolverTest, WorkspaceReuseTest) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddQuadraticCost(
+      Eigen::Matrix2d::Identity(), Eigen::Vector2d(1, -1), x);
+  auto constraint = prog.AddLinearConstraint(
+      Eigen::RowVector2d(1, 1), -1, 1, x);
+
+  OsqpSolver osqp_solver;
+  if (osqp_solver.available()) {
+    // Each solve by osqp_solver must match the solve by a fresh solver.
+    auto check_solve = [&](bool expect_reused) {
+      MathematicalProgramResult result;
+      osqp_solver.Solve(prog, {}, {}, &result);
+      ASSERT_TRUE(result.is_success());
+      const OsqpSolverDetails& details =
+          result.get_solver_details<OsqpSolver>();
+      EXPECT_EQ(details.reused_workspace, expect_reused);
+      if (expect_reused) {
+        EXPECT_EQ(details.setup_time, 0);
+      } else {
+        EXPECT_EQ(details.update_time, 0);
+      }
+
+      MathematicalProgramResult fresh_result;
+      OsqpSolver().Solve(prog, {}, {}, &fresh_result);
+      ASSERT_TRUE(fresh_result.is_success());
+      EXPECT_FALSE(
+          fresh_result.get_solver_details<OsqpSolver>().reused_workspace);
+      EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                  fresh_result.GetSolution(x), 1e-5));
+      EXPECT_NEAR(result.get_optimal_cost(), fresh_result.get_optimal_cost(),
+                  1e-5);
+    };
+
+    check_solve(false);
+    // Same program.
+    check_solve(true);
+    // New bounds.
+    constraint.evaluator()->set_bounds(Vector1d(0.5), Vector1d(2));
+    check_solve(true);
+    // New linear cost.
+    cost.evaluator()->UpdateCoefficients(Eigen::Matrix2d::Identity(),
+                                         Eigen::Vector2d(-3, 2));
+    check_solve(true);
+    // New cost Hessian and constraint matrix, with the same sparsity.
+    const Eigen::Matrix2d new_Q = Eigen::Vector2d(2, 3).asDiagonal();
+    cost.evaluator()->UpdateCoefficients(new_Q, Eigen::Vector2d(-3, 2));
+    constraint.evaluator()->UpdateCoefficients(
+        Eigen::RowVector2d(1, 2), Vector1d(0.5), Vector1d(2));
+    check_solve(true);
+    // A new constraint changes the sparsity.
+    prog.AddLinearConstraint(x(0) - x(1) <= 0.25);
+    check_solve(false);
+    check_solve(true);
+
+    // Different solver options need a new workspace.
+    MathematicalProgramResult result;
+    SolverOptions solver_options;
+    solver_options.SetOption(osqp_solver.solver_id(), "max_iter", 1000);
+    osqp_solver.Solve(prog, {}, solver_options, &result);
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().reused_workspace);
+  }
+}
+
+GTEST_TEST(OsqpSolverTest, WorkspaceReuseNonDiagonalHessianTest) {
+  // OSQP keeps only the upper triangle of the Hessian; updating a reused
+  // workspace must pass the values of that triangle alone.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  Eigen::Matrix3d Q;
+  // clang-format off
+  Q << 4, 1, 0.5,
+       1, 3, -1,
+       0.5, -1, 5;
+  // clang-format on
+  auto cost = prog.AddQuadraticCost(Q, Eigen::Vector3d(1, -2, 3), x);
+  prog.AddLinearConstraint(Eigen::RowVector3d(1, 1, 1), -1, 1, x);
+
+  OsqpSolver osqp_solver;
+  if (osqp_solver.available()) {
+    MathematicalProgramResult result;
+    osqp_solver.Solve(prog, {}, {}, &result);
+    ASSERT_TRUE(result.is_success());
+
+    // A new Hessian with the same sparsity, off-diagonal entries included.
+    Eigen::Matrix3d new_Q;
+    // clang-format off
+    new_Q << 2, -0.5, 1,
+             -0.5, 6, 2,
+             1, 2, 3;
+    // clang-format on
+    cost.evaluator()->UpdateCoefficients(new_Q, Eigen::Vector3d(-1, 2, 1));
+    osqp_solver.Solve(prog, {}, {}, &result);
+    ASSERT_TRUE(result.is_success());
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().reused_workspace);
+
+    MathematicalProgramResult fresh_result;
+    OsqpSolver().Solve(prog, {}, {}, &fresh_result);
+    ASSERT_TRUE(fresh_result.is_success());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                fresh_result.GetSolution(x), 1e-5));
+    EXPECT_NEAR(result.get_optimal_cost(), fresh_result.get_optimal_cost(),
+                1e-5);
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
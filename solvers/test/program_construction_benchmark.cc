@@ -0,0 +1,88 @@
+#include <iostream>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/solvers/mathematical_program.h"
+
+DEFINE_int32(max_num_knots, 100000,
+             "The largest number of knot points of the programs built.");
+
+// Times the construction of a MathematicalProgram shaped like a direct
+// transcription, x[i+1] = x[i] + h * u[i] with -1 <= x[i] + u[i] <= 1 and the
+// cost ∑ x[i]² + r * u[i]², for an increasing number of knot points. Each
+// knot point adds its own constraints and cost from symbolic expressions,
+// built beforehand. The dynamics are also added from their coefficients, to
+// compare with the cost of parsing the expressions.
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using symbolic::Expression;
+
+constexpr double kTimeStep = 0.1;
+constexpr double kInputWeight = 0.01;
+
+int do_main() {
+  std::cout << "   knots   dynamics [ms]   dynamics, matrix [ms]"
+               "   bounds [ms]   costs [ms]\n";
+  for (int n = 10; n <= FLAGS_max_num_knots; n *= 10) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(n + 1, "x");
+    const auto u = prog.NewContinuousVariables(n, "u");
+
+    std::vector<Expression> dynamics(n);
+    std::vector<Expression> bounds(n);
+    std::vector<Expression> costs(n);
+    for (int i = 0; i < n; ++i) {
+      dynamics[i] = x(i + 1) - x(i) - kTimeStep * u(i);
+      bounds[i] = x(i) + u(i);
+      costs[i] = x(i) * x(i) + kInputWeight * u(i) * u(i);
+    }
+    const Eigen::RowVector3d dynamics_row(1, -1, -kTimeStep);
+
+    const double dynamics_time = common::test::MeasureExecutionTime([&]() {
+      for (int i = 0; i < n; ++i) {
+        prog.AddLinearEqualityConstraint(dynamics[i], 0);
+      }
+    });
+    const double dynamics_matrix_time =
+        common::test::MeasureExecutionTime([&]() {
+          for (int i = 0; i < n; ++i) {
+            prog.AddLinearEqualityConstraint(
+                dynamics_row, Vector1d(0),
+                {x.segment<1>(i + 1), x.segment<1>(i), u.segment<1>(i)});
+          }
+        });
+    const double bounds_time = common::test::MeasureExecutionTime([&]() {
+      for (int i = 0; i < n; ++i) {
+        prog.AddLinearConstraint(bounds[i], -1, 1);
+      }
+    });
+    const double costs_time = common::test::MeasureExecutionTime([&]() {
+      for (int i = 0; i < n; ++i) {
+        prog.AddQuadraticCost(costs[i]);
+      }
+    });
+
+    std::cout << fmt::format("{:8d} {:15.2f} {:23.2f} {:13.2f} {:12.2f}\n", n,
+                             1e3 * dynamics_time, 1e3 * dynamics_matrix_time,
+                             1e3 * bounds_time, 1e3 * costs_time);
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      "Times the construction of a MathematicalProgram from symbolic "
+      "expressions.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::solvers::do_main();
+}
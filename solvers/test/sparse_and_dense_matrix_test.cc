@@ -0,0 +1,99 @@
+#include "drake/solvers/sparse_and_dense_matrix.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+Eigen::SparseMatrix<double> MakeSparse() {
+  // [1 0 0]
+  // [0 0 2]
+  Eigen::SparseMatrix<double> sparse(2, 3);
+  sparse.insert(0, 0) = 1;
+  sparse.insert(1, 2) = 2;
+  // An explicitly stored zero.
+  sparse.insert(1, 1) = 0;
+  return sparse;
+}
+
+GTEST_TEST(SparseAndDenseMatrix, ConstructFromSparse) {
+  const SparseAndDenseMatrix matrix(MakeSparse());
+  EXPECT_EQ(matrix.rows(), 2);
+  EXPECT_EQ(matrix.cols(), 3);
+  // The explicit zero is dropped.
+  EXPECT_TRUE(matrix.is_sparse_constructed());
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 2);
+  EXPECT_FALSE(matrix.is_dense_constructed());
+
+  Eigen::MatrixXd expected(2, 3);
+  expected << 1, 0, 0, 0, 0, 2;
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsDense(), expected));
+  EXPECT_TRUE(matrix.is_dense_constructed());
+  // The dense matrix is built once.
+  EXPECT_EQ(&matrix.GetAsDense(), &matrix.GetAsDense());
+}
+
+GTEST_TEST(SparseAndDenseMatrix, ConstructFromDense) {
+  Eigen::MatrixXd dense(2, 2);
+  dense << 0, 3, 4, 0;
+  const SparseAndDenseMatrix matrix(dense);
+  EXPECT_EQ(matrix.rows(), 2);
+  EXPECT_EQ(matrix.cols(), 2);
+  EXPECT_TRUE(matrix.is_dense_constructed());
+  EXPECT_FALSE(matrix.is_sparse_constructed());
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsDense(), dense));
+
+  // The sparse matrix is built once, without the zero entries.
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 2);
+  EXPECT_TRUE(matrix.is_sparse_constructed());
+  EXPECT_EQ(&matrix.GetAsSparse(), &matrix.GetAsSparse());
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(matrix.GetAsSparse()), dense));
+}
+
+GTEST_TEST(SparseAndDenseMatrix, Set) {
+  SparseAndDenseMatrix matrix(Eigen::MatrixXd::Identity(2, 2));
+  matrix.SetFromSparse(MakeSparse());
+  EXPECT_FALSE(matrix.is_dense_constructed());
+  EXPECT_EQ(matrix.cols(), 3);
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(matrix.GetAsSparse()),
+                              matrix.GetAsDense()));
+
+  const Eigen::MatrixXd dense = Eigen::MatrixXd::Ones(3, 1);
+  matrix.SetFromDense(dense);
+  EXPECT_TRUE(matrix.is_dense_constructed());
+  EXPECT_FALSE(matrix.is_sparse_constructed());
+  EXPECT_EQ(matrix.rows(), 3);
+  EXPECT_EQ(matrix.cols(), 1);
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsDense(), dense));
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 3);
+}
+
+GTEST_TEST(SparseAndDenseMatrix, ConcurrentGetAsDense) {
+  const SparseAndDenseMatrix matrix(MakeSparse());
+  std::vector<const Eigen::MatrixXd*> results(4);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+    threads.emplace_back([&matrix, &results, i]() {
+      results[i] = &matrix.GetAsDense();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const Eigen::MatrixXd* result : results) {
+    EXPECT_EQ(result, results[0]);
+    EXPECT_TRUE(CompareMatrices(*result, Eigen::MatrixXd(MakeSparse())));
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <tuple>
 #include <unordered_map>
 
 #include <gtest/gtest.h>
@@ -198,6 +199,99 @@ GTEST_TEST(SymbolicExtraction, DecomposeLinearExpression) {
   }
 }
 
+GTEST_TEST(SymbolicExtraction, DecomposeSparseAffineExpression) {
+  const Variable x("x");
+  const Variable y("y");
+  const Variable z("z");
+
+  // Nested sums, products with and divisions by constants are read off the
+  // expression tree.
+  {
+    const Expression e = 2 * (x + 3 * (y - 1)) / 4 - z + 5;
+    SparseAffineExpression affine;
+    EXPECT_TRUE(DecomposeAffineExpression(e, &affine));
+    EXPECT_EQ(affine.constant_term, 3.5);
+    ASSERT_EQ(affine.linear_terms.size(), 3u);
+    EXPECT_TRUE(affine.linear_terms[0].first.equal_to(x));
+    EXPECT_EQ(affine.linear_terms[0].second, 0.5);
+    EXPECT_TRUE(affine.linear_terms[1].first.equal_to(y));
+    EXPECT_EQ(affine.linear_terms[1].second, 1.5);
+    EXPECT_TRUE(affine.linear_terms[2].first.equal_to(z));
+    EXPECT_EQ(affine.linear_terms[2].second, -1);
+  }
+
+  // An expression which is affine only once expanded keeps the variables
+  // whose terms cancel, with a zero coefficient.
+  {
+    const Expression e = (x + 1) * (x - 1) - x * x + y;
+    SparseAffineExpression affine;
+    EXPECT_TRUE(DecomposeAffineExpression(e, &affine));
+    EXPECT_EQ(affine.constant_term, -1);
+    ASSERT_EQ(affine.linear_terms.size(), 2u);
+    EXPECT_TRUE(affine.linear_terms[0].first.equal_to(x));
+    EXPECT_EQ(affine.linear_terms[0].second, 0);
+    EXPECT_TRUE(affine.linear_terms[1].first.equal_to(y));
+    EXPECT_EQ(affine.linear_terms[1].second, 1);
+  }
+
+  // Constants.
+  {
+    SparseAffineExpression affine;
+    EXPECT_TRUE(DecomposeAffineExpression(Expression{2}, &affine));
+    EXPECT_EQ(affine.constant_term, 2);
+    EXPECT_TRUE(affine.linear_terms.empty());
+  }
+
+  // Non-affine expressions.
+  SparseAffineExpression affine;
+  EXPECT_FALSE(DecomposeAffineExpression(x * y + 1, &affine));
+  EXPECT_FALSE(DecomposeAffineExpression(x * x, &affine));
+  EXPECT_FALSE(DecomposeAffineExpression(sin(x) + y, &affine));
+  EXPECT_FALSE(DecomposeAffineExpression(x / y, &affine));
+}
+
+GTEST_TEST(SymbolicExtraction, DecomposeSparseQuadraticExpression) {
+  const Variable x("x");
+  const Variable y("y");
+
+  {
+    const Expression e = 3 * y * x + 2 * pow(x, 2) + (y * y - x) / 2 + 1;
+    SparseQuadraticExpression quadratic;
+    EXPECT_TRUE(DecomposeQuadraticExpression(e, &quadratic));
+    EXPECT_EQ(quadratic.constant_term, 1);
+    ASSERT_EQ(quadratic.linear_terms.size(), 1u);
+    EXPECT_TRUE(quadratic.linear_terms[0].first.equal_to(x));
+    EXPECT_EQ(quadratic.linear_terms[0].second, -0.5);
+    ASSERT_EQ(quadratic.quadratic_terms.size(), 3u);
+    const auto& xx = quadratic.quadratic_terms[0];
+    EXPECT_TRUE(std::get<0>(xx).equal_to(x) && std::get<1>(xx).equal_to(x));
+    EXPECT_EQ(std::get<2>(xx), 2);
+    const auto& xy = quadratic.quadratic_terms[1];
+    EXPECT_TRUE(std::get<0>(xy).equal_to(x) && std::get<1>(xy).equal_to(y));
+    EXPECT_EQ(std::get<2>(xy), 3);
+    const auto& yy = quadratic.quadratic_terms[2];
+    EXPECT_TRUE(std::get<0>(yy).equal_to(y) && std::get<1>(yy).equal_to(y));
+    EXPECT_EQ(std::get<2>(yy), 0.5);
+  }
+
+  // Products of sums are expanded.
+  {
+    const Expression e = (x + y) * (x - y);
+    SparseQuadraticExpression quadratic;
+    EXPECT_TRUE(DecomposeQuadraticExpression(e, &quadratic));
+    EXPECT_EQ(quadratic.constant_term, 0);
+    EXPECT_TRUE(quadratic.linear_terms.empty());
+    ASSERT_EQ(quadratic.quadratic_terms.size(), 2u);
+    EXPECT_EQ(std::get<2>(quadratic.quadratic_terms[0]), 1);
+    EXPECT_EQ(std::get<2>(quadratic.quadratic_terms[1]), -1);
+  }
+
+  SparseQuadraticExpression quadratic;
+  EXPECT_FALSE(DecomposeQuadraticExpression(x * x * y, &quadratic));
+  EXPECT_FALSE(DecomposeQuadraticExpression(pow(x, 3), &quadratic));
+  EXPECT_FALSE(DecomposeQuadraticExpression(cos(x), &quadratic));
+}
+
 }  // anonymous namespace
 }  // namespace internal
 }  // namespace solvers
@@ -17,6 +17,7 @@
 
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/jacobian_coloring.h"
 
 namespace drake {
 namespace systems {
@@ -64,8 +65,11 @@ void ImplicitEulerIntegrator<T>::DoInitialize() {
     working_accuracy = kLoosestAccuracy;
   this->set_accuracy_in_use(working_accuracy);
 
-  // Reset the Jacobian matrix (so that recomputation is forced).
+  // Reset the Jacobian matrix (so that recomputation is forced), and its
+  // sparsity pattern (so that rediscovery is forced).
   J_.resize(0, 0);
+  has_sparse_jacobian_ = false;
+  jacobian_pattern_.resize(0, 0);
 }
 
 // Computes the Jacobian of the ordinary differential equations taken with
@@ -125,6 +129,63 @@ MatrixX<T> ImplicitEulerIntegrator<T>::ComputeAutoDiffJacobian(
   return math::autoDiffToGradientMatrix(result);
 }
 
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state using automatic differentiation, as for
+// ComputeAutoDiffJacobian(), but with one derivative direction per color
+// (see columns_of_color_) rather than one per state variable.
+template <>
+void ImplicitEulerIntegrator<AutoDiffXd>::ComputeColoredAutoDiffJacobian(
+    const System<AutoDiffXd>&, const Context<AutoDiffXd>&) {
+  throw std::runtime_error("AutoDiff'd Jacobian not supported from "
+                               "AutoDiff'd ImplicitEulerIntegrator");
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state using automatic differentiation, with one
+// derivative direction per color of columns (see columns_of_color_); since no
+// two columns of a color have a nonzero in the same row, each nonzero of the
+// Jacobian can be read from the derivatives in the direction of its column's
+// color. The result is stored in sparse_J_values_.
+// @param system The dynamical system.
+// @param context The context at which to compute the time derivatives.
+template <class T>
+void ImplicitEulerIntegrator<T>::ComputeColoredAutoDiffJacobian(
+    const System<T>& system, const Context<T>& context) {
+  const int num_colors = static_cast<int>(columns_of_color_.size());
+  SPDLOG_DEBUG(drake::log(), "  IE Compute colored Autodiff Jacobian ({} "
+               "colors) t={}", num_colors, context.get_time());
+
+  // Seed each state variable with the derivative direction of its color.
+  VectorX<AutoDiffXd> a_xtplus = context.get_continuous_state().CopyToVector();
+  for (int color = 0; color < num_colors; ++color) {
+    for (int i : columns_of_color_[color])
+      a_xtplus[i].derivatives() = VectorX<T>::Unit(num_colors, color);
+  }
+
+  // Evaluate the derivatives at that state, as in ComputeAutoDiffJacobian().
+  const auto adiff_system = system.ToAutoDiffXd();
+  std::unique_ptr<Context<AutoDiffXd>> adiff_context = adiff_system->
+      AllocateContext();
+  adiff_context->SetTimeStateAndParametersFrom(context);
+  adiff_system->FixInputPortsFrom(system, context, adiff_context.get());
+  adiff_context->get_mutable_continuous_state().get_mutable_vector().
+      SetFromVector(a_xtplus);
+  const VectorX<AutoDiffXd> result =
+      this->EvalTimeDerivatives(*adiff_system, *adiff_context).CopyToVector();
+  const MatrixX<T> compressed_J =
+      math::autoDiffToGradientMatrix(result, num_colors);
+
+  // Decompress the Jacobian.
+  const int* const outer = jacobian_pattern_.outerIndexPtr();
+  const int* const inner = jacobian_pattern_.innerIndexPtr();
+  for (int color = 0; color < num_colors; ++color) {
+    for (int i : columns_of_color_[color]) {
+      for (int k = outer[i]; k < outer[i + 1]; ++k)
+        sparse_J_values_(k) = compressed_J(inner[k], color);
+    }
+  }
+}
+
 // Evaluates the ordinary differential equations at the time and state in
 // the system's context (stored by the integrator).
 template <class T>
@@ -285,6 +346,135 @@ MatrixX<T> ImplicitEulerIntegrator<T>::ComputeCentralDiffJacobian(
   return J;
 }
 
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state using a first-order forward difference, as
+// for ComputeForwardDiffJacobian(), but perturbing all state variables of a
+// color (see columns_of_color_) at once. Since no two columns of a color have
+// a nonzero in the same row, each nonzero of the difference in the time
+// derivatives is attributable to exactly one of the perturbed variables. The
+// result is stored in sparse_J_values_.
+// @param system The dynamical system.
+// @param context Mutable context for in-place computation of time derivatives.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+void ImplicitEulerIntegrator<T>::ComputeColoredForwardDiffJacobian(
+    const System<T>&, Context<T>* context) {
+  using std::abs;
+
+  // Set epsilon to the square root of machine precision.
+  const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+  // Get the current continuous state.
+  const VectorX<T> xtplus = context->get_continuous_state().CopyToVector();
+  const int n = xtplus.size();
+
+  SPDLOG_DEBUG(drake::log(), "  IE Compute colored Forwarddiff {}-Jacobian "
+               "({} colors) t={}", n, columns_of_color_.size(),
+               context->get_time());
+
+  // Evaluate f(t+h,xtplus) for the current state (current xtplus).
+  const VectorX<T> f = EvalTimeDerivativesUsingContext();
+
+  // Compute the Jacobian, one color at a time.
+  const int* const outer = jacobian_pattern_.outerIndexPtr();
+  const int* const inner = jacobian_pattern_.innerIndexPtr();
+  VectorX<T> xtplus_prime = xtplus;
+  VectorX<T> dx(n);
+  for (const std::vector<int>& columns : columns_of_color_) {
+    // Perturb each of this color's state variables, with the increments of
+    // ComputeForwardDiffJacobian().
+    for (int i : columns) {
+      const T abs_xi = abs(xtplus(i));
+      T dxi(abs_xi);
+      if (dxi <= 1) {
+        dxi = eps;
+      } else {
+        dxi = eps * abs_xi;
+      }
+      xtplus_prime(i) = xtplus(i) + dxi;
+      dx(i) = xtplus_prime(i) - xtplus(i);
+    }
+
+    // Compute f' and set the relevant nonzeros of the Jacobian matrix.
+    context->SetContinuousState(xtplus_prime);
+    const VectorX<T> df = EvalTimeDerivativesUsingContext() - f;
+    for (int i : columns) {
+      for (int k = outer[i]; k < outer[i + 1]; ++k)
+        sparse_J_values_(k) = df(inner[k]) / dx(i);
+
+      // Reset xtplus' to xtplus.
+      xtplus_prime(i) = xtplus(i);
+    }
+  }
+}
+
+// Computes the Jacobian of the ordinary differential equations taken with
+// respect to the continuous state using a second-order central difference, as
+// for ComputeCentralDiffJacobian(), but perturbing all state variables of a
+// color (see columns_of_color_) at once; see
+// ComputeColoredForwardDiffJacobian(). The result is stored in
+// sparse_J_values_.
+// @param system The dynamical system.
+// @param context Mutable context for in-place computation of time derivatives.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+void ImplicitEulerIntegrator<T>::ComputeColoredCentralDiffJacobian(
+    const System<T>&, Context<T>* context) {
+  using std::abs;
+
+  // Use the power of epsilon of ComputeCentralDiffJacobian().
+  const double eps = std::pow(std::numeric_limits<double>::epsilon(), 5.0/12);
+
+  // Get the current continuous state.
+  const VectorX<T> xtplus = context->get_continuous_state().CopyToVector();
+  const int n = xtplus.size();
+
+  SPDLOG_DEBUG(drake::log(), "  IE Compute colored Centraldiff {}-Jacobian "
+               "({} colors) t={}", n, columns_of_color_.size(),
+               context->get_time());
+
+  // Compute the Jacobian, one color at a time.
+  const int* const outer = jacobian_pattern_.outerIndexPtr();
+  const int* const inner = jacobian_pattern_.innerIndexPtr();
+  VectorX<T> xtplus_prime = xtplus;
+  VectorX<T> dx(n), dx_plus(n), dx_minus(n);
+  for (const std::vector<int>& columns : columns_of_color_) {
+    // Compute the increments of ComputeCentralDiffJacobian(), and f(x+dx).
+    for (int i : columns) {
+      const T abs_xi = abs(xtplus(i));
+      dx(i) = abs_xi;
+      if (dx(i) <= 1) {
+        dx(i) = eps;
+      } else {
+        dx(i) = eps * abs_xi;
+      }
+      xtplus_prime(i) = xtplus(i) + dx(i);
+      dx_plus(i) = xtplus_prime(i) - xtplus(i);
+    }
+    context->SetContinuousState(xtplus_prime);
+    const VectorX<T> fprime_plus = EvalTimeDerivativesUsingContext();
+
+    // Compute f(x-dx).
+    for (int i : columns) {
+      xtplus_prime(i) = xtplus(i) - dx(i);
+      dx_minus(i) = xtplus(i) - xtplus_prime(i);
+    }
+    context->SetContinuousState(xtplus_prime);
+    const VectorX<T> fprime_minus = EvalTimeDerivativesUsingContext();
+
+    // Set the relevant nonzeros of the Jacobian matrix.
+    for (int i : columns) {
+      for (int k = outer[i]; k < outer[i + 1]; ++k) {
+        sparse_J_values_(k) = (fprime_plus(inner[k]) - fprime_minus(inner[k])) /
+            (dx_plus(i) + dx_minus(i));
+      }
+
+      // Reset xtplus' to xtplus.
+      xtplus_prime(i) = xtplus(i);
+    }
+  }
+}
+
 // Factors a dense matrix (the negated iteration matrix) using LU factorization,
 // which should be faster than the QR factorization used in the specialized
 // template method immediately below.
@@ -292,6 +482,7 @@ template <class T>
 void ImplicitEulerIntegrator<T>::Factor(const MatrixX<T>& A) {
   num_iter_factorizations_++;
   LU_.compute(A);
+  use_sparse_LU_ = false;
 }
 
 // Factors a dense matrix (the negated iteration matrix). This
@@ -305,17 +496,50 @@ void ImplicitEulerIntegrator<AutoDiffXd>::Factor(
   QR_.compute(A);
 }
 
+// Factors a sparse matrix (the negated iteration matrix) using sparse LU
+// factorization. The symbolic analysis of the sparsity pattern is reused
+// until the pattern changes. If the factorization fails (i.e., the matrix is
+// numerically singular), falls back to the dense LU factorization, which is
+// what would have been used without sparsity.
+template <class T>
+void ImplicitEulerIntegrator<T>::FactorSparse(
+    const Eigen::SparseMatrix<T>& A) {
+  num_iter_factorizations_++;
+  if (!sparse_LU_pattern_analyzed_) {
+    sparse_LU_.analyzePattern(A);
+    sparse_LU_pattern_analyzed_ = true;
+  }
+  sparse_LU_.factorize(A);
+  use_sparse_LU_ = (sparse_LU_.info() == Eigen::Success);
+  if (!use_sparse_LU_) {
+    SPDLOG_DEBUG(drake::log(), "Sparse LU factorization failed: {}",
+                 sparse_LU_.lastErrorMessage());
+    LU_.compute(MatrixX<T>(A));
+  }
+}
+
+// Factors a sparse matrix (the negated iteration matrix). As for Factor(),
+// the AutoDiff-specialized method uses a dense QR factorization.
+template <>
+void ImplicitEulerIntegrator<AutoDiffXd>::FactorSparse(
+    const Eigen::SparseMatrix<AutoDiffXd>& A) {
+  num_iter_factorizations_++;
+  QR_.compute(MatrixX<AutoDiffXd>(A));
+}
+
 // Solves a linear system Ax = b for x using a negated iteration matrix (A)
-// factored using LU decomposition.
-// @sa Factor()
+// factored using (sparse or dense) LU decomposition.
+// @sa Factor(), FactorSparse()
 template <class T>
 VectorX<T> ImplicitEulerIntegrator<T>::Solve(const VectorX<T>& b) const {
+  if (use_sparse_LU_)
+    return sparse_LU_.solve(b);
   return LU_.solve(b);
 }
 
 // Solves the linear system Ax = b for x using a negated iteration matrix (A)
 // factored using QR decomposition.
-// @sa Factor()
+// @sa Factor(), FactorSparse()
 template <>
 VectorX<AutoDiffXd> ImplicitEulerIntegrator<AutoDiffXd>::Solve(
     const VectorX<AutoDiffXd>& b) const {
@@ -325,8 +549,38 @@ VectorX<AutoDiffXd> ImplicitEulerIntegrator<AutoDiffXd>::Solve(
 // Checks to see whether a Jacobian matrix has "become bad" and needs to be
 // refactorized.
 template <class T>
-bool ImplicitEulerIntegrator<T>::IsBadJacobian(const MatrixX<T>& J) const {
-  return !J.allFinite();
+bool ImplicitEulerIntegrator<T>::IsBadJacobian() const {
+  if (use_sparse_jacobian_)
+    return !sparse_J_values_.allFinite();
+  return !J_.allFinite();
+}
+
+// Forms the negated iteration matrix, J * (dt / scale) - I, from the last
+// computed (dense or sparse) Jacobian matrix, and factors it. The idea of
+// using the negation of the iteration matrix is that an O(n^2) subtraction is
+// not necessary as would be the case with MatrixX<T>::Identity(n, n) -
+// J * (dt / scale).
+template <class T>
+void ImplicitEulerIntegrator<T>::FormAndFactorIterationMatrix(const T& dt,
+                                                              int scale) {
+  if (!use_sparse_jacobian_) {
+    const int n = J_.rows();
+    neg_iteration_matrix_ = J_ * (dt / scale) - MatrixX<T>::Identity(n, n);
+    Factor(neg_iteration_matrix_);
+    return;
+  }
+
+  // Form the sparse matrix in place; its pattern was set up by
+  // UpdateJacobianSparsity().
+  Eigen::Map<VectorX<T>> values(sparse_neg_iteration_matrix_.valuePtr(),
+                                sparse_neg_iteration_matrix_.nonZeros());
+  values.setZero();
+  for (int k = 0; k < sparse_J_values_.size(); ++k)
+    values(iteration_index_of_jacobian_nonzero_[k]) =
+        sparse_J_values_(k) * (dt / scale);
+  for (int index : iteration_index_of_diagonal_)
+    values(index) -= 1;
+  FactorSparse(sparse_neg_iteration_matrix_);
 }
 
 // Computes any necessary matrices for the Newton-Raphson iteration in
@@ -340,8 +594,9 @@ bool ImplicitEulerIntegrator<T>::CalcMatrices(const T& tf, const T& dt,
                                               const VectorX<T>& xtplus,
                                               int trial) {
   // Compute the initial Jacobian and negated iteration matrices (see
-  // rationale for the negation below) and factor them, if necessary.
-  if (!reuse_ || J_.rows() == 0 || IsBadJacobian(J_)) {
+  // rationale for the negation in FormAndFactorIterationMatrix()) and factor
+  // them, if necessary.
+  if (!reuse_ || !has_jacobian() || IsBadJacobian()) {
     // Note that the Jacobian can become bad through a divergent Newton-Raphson
     // iteration, which causes the state to overflow, which then causes the
     // Jacobian to overflow. If the state overflows, recomputing the Jacobian
@@ -350,10 +605,8 @@ bool ImplicitEulerIntegrator<T>::CalcMatrices(const T& tf, const T& dt,
     // the continuous state to its previous, good value). DoStep() will then
     // be called again with a smaller step size and the good state; the
     // bad Jacobian will then be corrected.
-    J_ = CalcJacobian(tf, xtplus);
-    const int n = xtplus.size();
-    neg_iteration_matrix_ = J_ * (dt / scale) - MatrixX<T>::Identity(n, n);
-    Factor(neg_iteration_matrix_);
+    CalcJacobian(tf, xtplus);
+    FormAndFactorIterationMatrix(dt, scale);
     return true;
   }
 
@@ -364,9 +617,7 @@ bool ImplicitEulerIntegrator<T>::CalcMatrices(const T& tf, const T& dt,
 
     case 2: {
       // For the second trial, re-construct and factor the iteration matrix.
-      const int n = xtplus.size();
-      neg_iteration_matrix_ = J_ * (dt / scale) - MatrixX<T>::Identity(n, n);
-      Factor(neg_iteration_matrix_);
+      FormAndFactorIterationMatrix(dt, scale);
       return true;
     }
 
@@ -379,14 +630,13 @@ bool ImplicitEulerIntegrator<T>::CalcMatrices(const T& tf, const T& dt,
         return false;
       } else {
         // Reform the Jacobian matrix and refactor the negation of
-        // the iteration matrix. The idea of using the negation of this matrix
-        // is that an O(n^2) subtraction is not necessary as would
-        // be the case with MatrixX<T>::Identity(n, n) - J * (dt / scale).
-        J_ = CalcJacobian(tf, xtplus);
-        const int n = xtplus.size();
-        neg_iteration_matrix_ = J_ * (dt / scale) -
-            MatrixX<T>::Identity(n, n);
-        Factor(neg_iteration_matrix_);
+        // the iteration matrix. A sparse Jacobian matrix may be missing
+        // entries that were zero when its sparsity pattern was probed, so
+        // probe again.
+        if (use_sparse_jacobian_)
+          rediscover_jacobian_sparsity_ = true;
+        CalcJacobian(tf, xtplus);
+        FormAndFactorIterationMatrix(dt, scale);
       }
       return true;
 
@@ -648,13 +898,155 @@ bool ImplicitEulerIntegrator<T>::StepImplicitTrapezoid(const T& h,
   return success;
 }
 
+// Computes a dense Jacobian matrix using the selected scheme.
+// @param system The dynamical system.
+// @param context Mutable context for in-place computation of time derivatives.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+MatrixX<T> ImplicitEulerIntegrator<T>::ComputeDenseJacobian(
+    const System<T>& system, Context<T>* context) {
+  switch (jacobian_scheme_) {
+    case JacobianComputationScheme::kForwardDifference:
+      return ComputeForwardDiffJacobian(system, context);
+
+    case JacobianComputationScheme::kCentralDifference:
+      return ComputeCentralDiffJacobian(system, context);
+
+    case JacobianComputationScheme::kAutomatic:
+      return ComputeAutoDiffJacobian(system, *context);
+  }
+  DRAKE_UNREACHABLE();
+}
+
+// Computes a sparse Jacobian matrix using the selected scheme, storing it in
+// sparse_J_values_. If the sparsity pattern is not yet known (or is to be
+// probed again), it is discovered from a dense Jacobian matrix first.
+// @param system The dynamical system.
+// @param context Mutable context for in-place computation of time derivatives.
+// @post The continuous state will be indeterminate on return.
+template <class T>
+void ImplicitEulerIntegrator<T>::ComputeSparseJacobian(
+    const System<T>& system, Context<T>* context) {
+  if (jacobian_pattern_.rows() == 0 || rediscover_jacobian_sparsity_) {
+    rediscover_jacobian_sparsity_ = false;
+    const MatrixX<T> J = ComputeDenseJacobian(system, context);
+    UpdateJacobianSparsity(J);
+
+    // Keep the values of the dense Jacobian matrix.
+    const int* const outer = jacobian_pattern_.outerIndexPtr();
+    const int* const inner = jacobian_pattern_.innerIndexPtr();
+    for (int j = 0; j < J.cols(); ++j) {
+      for (int k = outer[j]; k < outer[j + 1]; ++k)
+        sparse_J_values_(k) = J(inner[k], j);
+    }
+    return;
+  }
+
+  switch (jacobian_scheme_) {
+    case JacobianComputationScheme::kForwardDifference:
+      ComputeColoredForwardDiffJacobian(system, context);
+      return;
+
+    case JacobianComputationScheme::kCentralDifference:
+      ComputeColoredCentralDiffJacobian(system, context);
+      return;
+
+    case JacobianComputationScheme::kAutomatic:
+      ComputeColoredAutoDiffJacobian(system, *context);
+      return;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+// Adds the nonzeros of @p J to the sparsity pattern of the Jacobian matrix
+// and updates everything that depends on the pattern: the column coloring,
+// the pattern of the negated iteration matrix, and the symbolic analysis of
+// its factorization.
+template <class T>
+void ImplicitEulerIntegrator<T>::UpdateJacobianSparsity(const MatrixX<T>& J) {
+  const int n = J.rows();
+  DRAKE_DEMAND(J.cols() == n);
+
+  // Merge the nonzeros of J with those found previously. Exact zeros are
+  // the only ones that are omitted.
+  std::vector<Eigen::Triplet<double>> triplets;
+  if (jacobian_pattern_.rows() == n) {
+    for (int j = 0; j < n; ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(jacobian_pattern_, j);
+           it; ++it) {
+        triplets.emplace_back(it.row(), j, 1.0);
+      }
+    }
+  }
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      if (J(i, j) != 0.0)
+        triplets.emplace_back(i, j, 1.0);
+    }
+  }
+  jacobian_pattern_.resize(n, n);
+  jacobian_pattern_.setFromTriplets(triplets.begin(), triplets.end());
+  jacobian_pattern_.makeCompressed();
+  sparse_J_values_.resize(jacobian_pattern_.nonZeros());
+
+  // Group the columns by color.
+  const std::vector<int> colors = math::ColorJacobianColumns(jacobian_pattern_);
+  columns_of_color_.clear();
+  for (int j = 0; j < n; ++j) {
+    if (colors[j] >= static_cast<int>(columns_of_color_.size()))
+      columns_of_color_.resize(colors[j] + 1);
+    columns_of_color_[colors[j]].push_back(j);
+  }
+  SPDLOG_DEBUG(drake::log(), "  IE Jacobian sparsity: {} nonzeros in {} "
+               "colors for {} state variables", jacobian_pattern_.nonZeros(),
+               columns_of_color_.size(), n);
+
+  // The negated iteration matrix has the pattern of J plus the diagonal.
+  std::vector<Eigen::Triplet<T>> iteration_triplets;
+  for (const Eigen::Triplet<double>& triplet : triplets)
+    iteration_triplets.emplace_back(triplet.row(), triplet.col(), T(0));
+  for (int i = 0; i < n; ++i)
+    iteration_triplets.emplace_back(i, i, T(0));
+  sparse_neg_iteration_matrix_.resize(n, n);
+  sparse_neg_iteration_matrix_.setFromTriplets(iteration_triplets.begin(),
+                                               iteration_triplets.end());
+  sparse_neg_iteration_matrix_.makeCompressed();
+
+  // Find where the Jacobian's nonzeros and the diagonal are stored in the
+  // negated iteration matrix. Both matrices store each column's entries in
+  // increasing row order, and the Jacobian's are a subset of the other's.
+  iteration_index_of_jacobian_nonzero_.resize(jacobian_pattern_.nonZeros());
+  iteration_index_of_diagonal_.resize(n);
+  const int* const outer = jacobian_pattern_.outerIndexPtr();
+  const int* const inner = jacobian_pattern_.innerIndexPtr();
+  const int* const iteration_outer =
+      sparse_neg_iteration_matrix_.outerIndexPtr();
+  const int* const iteration_inner =
+      sparse_neg_iteration_matrix_.innerIndexPtr();
+  for (int j = 0; j < n; ++j) {
+    int k = outer[j];
+    for (int m = iteration_outer[j]; m < iteration_outer[j + 1]; ++m) {
+      const int row = iteration_inner[m];
+      if (row == j)
+        iteration_index_of_diagonal_[j] = m;
+      if (k < outer[j + 1] && inner[k] == row)
+        iteration_index_of_jacobian_nonzero_[k++] = m;
+    }
+    DRAKE_DEMAND(k == outer[j + 1]);
+  }
+
+  // The sparse LU factorization must analyze the new pattern.
+  sparse_LU_pattern_analyzed_ = false;
+}
+
 // Compute the partial derivative of the ordinary differential equations with
-// respect to the state variables for a given x(t).
+// respect to the state variables for a given x(t), storing the result in J_
+// (or, when exploiting sparsity, sparse_J_values_).
 // @post the context's time and continuous state will be temporarily set during
 //       this call (and then reset to their original values) on return.
 template <class T>
-MatrixX<T> ImplicitEulerIntegrator<T>::CalcJacobian(const T& t,
-                                                    const VectorX<T>& x) {
+void ImplicitEulerIntegrator<T>::CalcJacobian(const T& t,
+                                              const VectorX<T>& x) {
   // We change the context but will change it back.
   Context<T>* context = this->get_mutable_context();
 
@@ -674,19 +1066,12 @@ MatrixX<T> ImplicitEulerIntegrator<T>::CalcJacobian(const T& t,
   const System<T>& system = this->get_system();
 
   // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
-  const MatrixX<T> J = [&]() {
-    switch (jacobian_scheme_) {
-      case JacobianComputationScheme::kForwardDifference:
-        return ComputeForwardDiffJacobian(system, &*context);
-
-      case JacobianComputationScheme::kCentralDifference:
-        return ComputeCentralDiffJacobian(system, &*context);
-
-      case JacobianComputationScheme::kAutomatic:
-        return ComputeAutoDiffJacobian(system, *context);
-    }
-    DRAKE_UNREACHABLE();
-  }();
+  if (use_sparse_jacobian_) {
+    ComputeSparseJacobian(system, &*context);
+    has_sparse_jacobian_ = true;
+  } else {
+    J_ = ComputeDenseJacobian(system, &*context);
+  }
 
   // Use the new number of ODE evaluations to determine the number of Jacobian
   // evaluations.
@@ -695,8 +1080,6 @@ MatrixX<T> ImplicitEulerIntegrator<T>::CalcJacobian(const T& t,
 
   // Reset the time and state.
   context->SetTimeAndContinuousState(t_current, x_current);
-
-  return J;
 }
 
 // Steps both implicit Euler and implicit trapezoid forward by dt, if possible.
@@ -3,8 +3,11 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/math/autodiff_gradient.h"
@@ -67,7 +70,9 @@ namespace systems {
  * process, though the complexity to form the Jacobian matrix is still `O(n²)`.
  * For large `n`, the time complexity may be dominated by the `O(n³)` time
  * required to (repeatedly) solve linear systems problems as part of the
- * nonlinear system solution process.
+ * nonlinear system solution process. When the state variables are only
+ * sparsely coupled, both costs can be reduced substantially; see
+ * set_use_sparse_jacobian().
  *
  * This implementation uses Newton-Raphson (NR) and relies upon the obvious
  * convergence to a solution for `g = 0` where
@@ -147,14 +152,50 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   /// @note Discards any already-computed Jacobian matrices if the scheme
   ///       changes.
   void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
-    if (jacobian_scheme_ != scheme)
+    if (jacobian_scheme_ != scheme) {
       J_.resize(0, 0);
+      has_sparse_jacobian_ = false;
+    }
     jacobian_scheme_ = scheme;
   }
 
   JacobianComputationScheme get_jacobian_computation_scheme() const {
     return jacobian_scheme_;
   }
+
+  /// Sets whether the integrator exploits sparsity in the Jacobian matrix
+  /// (default is `false`). Systems whose state variables are only sparsely
+  /// coupled- e.g., Diagrams of many independent or loosely connected
+  /// subsystems- have Jacobian matrices that are mostly zero. With this set,
+  /// the integrator discovers the sparsity pattern of the Jacobian matrix from
+  /// a first, dense, Jacobian evaluation (using the selected
+  /// JacobianComputationScheme), and then partitions the columns of the
+  /// Jacobian into groups ("colors") that share no nonzero rows. Every later
+  /// Jacobian matrix is then formed with one derivative evaluation (two for
+  /// central differencing), or one automatic differentiation direction, per
+  /// color rather than per state variable. The iteration matrix is stored and
+  /// factored as a sparse matrix as well.
+  ///
+  /// The sparsity pattern is determined numerically, so a partial derivative
+  /// that happens to be zero at the probed state is treated as zero
+  /// everywhere. The resulting Jacobian matrices are then approximate, which
+  /// can slow Newton-Raphson convergence but does not affect the accuracy of
+  /// the solution. When a convergence failure forces the integrator to reform
+  /// the Jacobian matrix, it also probes the sparsity pattern again, keeping
+  /// any entries found previously.
+  /// @note Discards any already-computed Jacobian matrices if the setting
+  ///       changes.
+  void set_use_sparse_jacobian(bool flag) {
+    if (use_sparse_jacobian_ != flag) {
+      J_.resize(0, 0);
+      has_sparse_jacobian_ = false;
+    }
+    use_sparse_jacobian_ = flag;
+  }
+
+  /// Gets whether the integrator exploits sparsity in the Jacobian matrix.
+  /// @see set_use_sparse_jacobian()
+  bool get_use_sparse_jacobian() const { return use_sparse_jacobian_; }
   /// @}
 
   /// The integrator supports error estimation.
@@ -247,10 +288,15 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   /// @}
 
  private:
-  bool IsBadJacobian(const MatrixX<T>& J) const;
+  bool has_jacobian() const {
+    return use_sparse_jacobian_ ? has_sparse_jacobian_ : J_.rows() != 0;
+  }
+  bool IsBadJacobian() const;
   void DoInitialize() override;
   void DoResetStatistics() override;
   void Factor(const MatrixX<T>& A);
+  void FactorSparse(const Eigen::SparseMatrix<T>& A);
+  void FormAndFactorIterationMatrix(const T& dt, int scale);
   VectorX<T> Solve(const VectorX<T>& rhs) const;
   bool AttemptStepPaired(const T& dt, VectorX<T>* xtplus_euler,
                          VectorX<T>* xtplus_trap);
@@ -258,7 +304,10 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
                     int scale, VectorX<T>* xtplus, int trial = 1);
   bool CalcMatrices(const T& tf, const T& dt, int scale,
                     const VectorX<T>& xtplus, int trial);
-  MatrixX<T> CalcJacobian(const T& tf, const VectorX<T>& xtplus);
+  void CalcJacobian(const T& tf, const VectorX<T>& xtplus);
+  MatrixX<T> ComputeDenseJacobian(const System<T>&, Context<T>*);
+  void ComputeSparseJacobian(const System<T>&, Context<T>*);
+  void UpdateJacobianSparsity(const MatrixX<T>& J);
   bool DoStep(const T& dt) override;
   bool StepImplicitEuler(const T& h);
   bool StepImplicitTrapezoid(const T& h, const VectorX<T>& dx0,
@@ -267,6 +316,10 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   MatrixX<T> ComputeCentralDiffJacobian(const System<T>&, Context<T>*);
   MatrixX<T> ComputeAutoDiffJacobian(const System<T>& system,
                                      const Context<T>& context);
+  void ComputeColoredForwardDiffJacobian(const System<T>&, Context<T>*);
+  void ComputeColoredCentralDiffJacobian(const System<T>&, Context<T>*);
+  void ComputeColoredAutoDiffJacobian(const System<T>& system,
+                                      const Context<T>& context);
   VectorX<T> EvalTimeDerivativesUsingContext();
 
   // A simple LU factorization is all that is needed; robustness in the solve
@@ -310,6 +363,40 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   // and deallocations.
   MatrixX<T> neg_iteration_matrix_;
 
+  // Whether Jacobian sparsity is exploited; see set_use_sparse_jacobian().
+  bool use_sparse_jacobian_{false};
+
+  // The sparsity pattern of the Jacobian matrix discovered so far (only the
+  // structure is used), and its columns grouped by color: no two columns in a
+  // group have a nonzero in the same row.
+  Eigen::SparseMatrix<double> jacobian_pattern_;
+  std::vector<std::vector<int>> columns_of_color_;
+
+  // Set when the sparsity pattern should be probed again by the next Jacobian
+  // matrix evaluation.
+  bool rediscover_jacobian_sparsity_{false};
+
+  // The last computed sparse Jacobian matrix, as the values of the nonzeros of
+  // jacobian_pattern_ (in storage order), and whether it is valid.
+  VectorX<T> sparse_J_values_;
+  bool has_sparse_jacobian_{false};
+
+  // The negated iteration matrix for the sparse Jacobian matrix. Its pattern
+  // is that of the Jacobian matrix plus the diagonal; the indices of the
+  // values of those entries within it are stored to allow forming the matrix
+  // in place.
+  Eigen::SparseMatrix<T> sparse_neg_iteration_matrix_;
+  std::vector<int> iteration_index_of_jacobian_nonzero_;
+  std::vector<int> iteration_index_of_diagonal_;
+
+  // The sparse LU factorization of sparse_neg_iteration_matrix_, whose
+  // symbolic analysis is redone only when the sparsity pattern changes.
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> sparse_LU_;
+  bool sparse_LU_pattern_analyzed_{false};
+
+  // Whether Solve() uses sparse_LU_ (rather than LU_).
+  bool use_sparse_LU_{false};
+
   // Whether the last call to StepAbstract() was a failure.
   bool last_call_failed_{false};
 
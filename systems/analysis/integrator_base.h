@@ -1616,7 +1616,8 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& dt_max) {
   const T current_time = context.get_time();
   VectorBase<T>& xc =
       get_mutable_context()->get_mutable_continuous_state_vector();
-  xc0_save_ = xc.CopyToVector();
+  xc0_save_.resize(xc.size());
+  xc.CopyToPreSizedVector(&xc0_save_);
 
   // Set the step size to attempt.
   T step_size_to_attempt = get_ideal_next_step_size();
@@ -1,5 +1,13 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <fmt/format.h>
+
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -20,9 +28,31 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
   return output(system, simulator->get_context());
 }
 
+namespace {
+
+int SelectNumberOfThreads(int num_parallel_executions, int num_samples) {
+  int num_threads = num_parallel_executions;
+  if (num_threads == kUseHardwareConcurrency) {
+    // hardware_concurrency() is allowed to return zero when it cannot tell.
+    num_threads = std::max(1, static_cast<int>(
+        std::thread::hardware_concurrency()));
+  } else if (num_threads < 1) {
+    throw std::runtime_error(fmt::format(
+        "MonteCarloSimulation: num_parallel_executions must be positive or "
+        "kUseHardwareConcurrency; got {}", num_parallel_executions));
+  }
+  return std::min(num_threads, std::max(num_samples, 1));
+}
+
+}  // namespace
+
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator) {
+    double final_time, int num_samples, RandomGenerator* generator,
+    int num_parallel_executions) {
+  const int num_threads =
+      SelectNumberOfThreads(num_parallel_executions, num_samples);
+
   std::unique_ptr<RandomGenerator> owned_generator{};
   if (generator == nullptr) {
     // Create a generator to be used for this set of tests.
@@ -33,15 +63,76 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
   std::vector<RandomSimulationResult> data;
   data.reserve(num_samples);
 
-  // TODO(russt): Support running these in multiple threads, as they are
-  // trivially parallelizable.
-  for (int i = 0; i < num_samples; i++) {
-    RandomSimulationResult result(*generator);
-    result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    data.emplace_back(std::move(result));
+  if (num_threads == 1) {
+    for (int i = 0; i < num_samples; i++) {
+      RandomSimulationResult result(*generator);
+      result.output =
+          RandomSimulation(make_simulator, output, final_time, generator);
+      data.emplace_back(std::move(result));
+    }
+    return data;
   }
 
+  // RandomSimulationResult has a const member (and no default constructor),
+  // so the workers fill these slots by index and we assemble the results once
+  // every sample has finished.
+  std::vector<std::unique_ptr<RandomGenerator>> snapshots(num_samples);
+  std::vector<double> outputs(num_samples);
+
+  // Guards the generator, next_sample, and first_error.  The sampling stage
+  // (make_simulator and SetRandomContext) is the only place the generator is
+  // consumed, so serializing it in order of increasing sample index reproduces
+  // the serial draw sequence exactly.
+  std::mutex mutex;
+  int next_sample = 0;
+  std::exception_ptr first_error;
+
+  auto worker = [&]() {
+    while (true) {
+      int sample{};
+      std::unique_ptr<Simulator<double>> simulator;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (next_sample >= num_samples || first_error) { return; }
+        sample = next_sample++;
+        try {
+          snapshots[sample] = std::make_unique<RandomGenerator>(*generator);
+          simulator = make_simulator(generator);
+          simulator->get_system().SetRandomContext(
+              &simulator->get_mutable_context(), generator);
+        } catch (...) {
+          first_error = std::current_exception();
+          return;
+        }
+      }
+      try {
+        simulator->AdvanceTo(final_time);
+        outputs[sample] =
+            output(simulator->get_system(), simulator->get_context());
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!first_error) { first_error = std::current_exception(); }
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+
+  for (int i = 0; i < num_samples; ++i) {
+    data.emplace_back(*snapshots[i], outputs[i]);
+  }
   return data;
 }
 
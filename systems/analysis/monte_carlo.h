@@ -111,6 +111,13 @@ struct RandomSimulationResult {
   double output{};
 };
 
+/// Run a MonteCarloSimulation on the calling thread only.
+constexpr int kNoConcurrency = 1;
+
+/// Run a MonteCarloSimulation using as many threads as the hardware reports
+/// (via std::thread::hardware_concurrency()).
+constexpr int kUseHardwareConcurrency = -1;
+
 /**
  * Generate samples of a scalar random variable output by running many
  * random simulations drawn from independent samples of the
@@ -125,6 +132,17 @@ struct RandomSimulationResult {
  *   return data
  * @endcode
  *
+ * When @p num_parallel_executions is greater than one, the samples are
+ * distributed over a pool of worker threads.  Each worker constructs its
+ * Simulator (via @p make_simulator) and randomizes the Context (via
+ * SetRandomContext()) while holding a lock on @p generator, claiming sample
+ * indices in increasing order; only the calls to AdvanceTo() and @p output
+ * run concurrently.  The generator is therefore consumed in exactly the same
+ * sequence as in the serial algorithm above, so that the returned
+ * generator snapshots and outputs are identical (bitwise) to those of a
+ * kNoConcurrency run with the same @p generator, and are returned in the
+ * same order.
+ *
  * @see RandomSimulation() for details about @p make_simulator, @p output,
  * and @p final_time.
  *
@@ -138,16 +156,26 @@ struct RandomSimulationResult {
  * future call to MonteCarloSimulation, you should make repeated uses of the
  * same RandomGenerator object.
  *
+ * @param num_parallel_executions Number of simulations to run concurrently.
+ * Use kNoConcurrency (the default) to run every sample on the calling
+ * thread, or kUseHardwareConcurrency to use one thread per hardware thread.
+ * Any other value must be positive.  For parallel runs, @p make_simulator
+ * and @p output must be safe to call from a thread other than the caller's
+ * (@p make_simulator is never invoked concurrently with itself), and the
+ * Systems they produce must not share mutable state between samples.
+ *
  * @returns a list of RandomSimulationResult's.
  *
+ * @throws std::exception if @p num_parallel_executions is neither positive
+ * nor kUseHardwareConcurrency.  If any sample throws, the remaining samples
+ * are abandoned and the first exception is rethrown on the calling thread.
+ *
  * @ingroup analysis
  */
-// TODO(russt): Consider generalizing this with options (e.g. setting the
-// number of simulators, number of samples per simulator, number of parallel
-// threads, ...).
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator = nullptr);
+    double final_time, int num_samples, RandomGenerator* generator = nullptr,
+    int num_parallel_executions = kNoConcurrency);
 
 }  // namespace analysis
 }  // namespace systems
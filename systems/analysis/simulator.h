@@ -279,6 +279,13 @@ class Simulator {
   /// the Context or Simulator options between successive AdvanceTo() calls. See
   /// Initialize() for more information.
   ///
+  /// Once the Simulator has been initialized and has taken its first step,
+  /// the Simulator itself performs no heap allocations while advancing a
+  /// System that has no continuous state (in release builds), so that it can
+  /// drive hard real-time loops. For the whole step to be allocation-free, the
+  /// System's own event handlers and output calculations must be, too, and
+  /// copying its abstract state values must not allocate.
+  ///
   /// @param boundary_time The time to advance the context to.
   /// @pre The internal Context satisfies all System constraints or will after
   ///      pending Context updates are performed.
@@ -596,6 +603,9 @@ class Simulator {
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
   VectorX<T> w0_, wf_;
 
+  // Pre-allocated temporary for the continuous state at the start of a step.
+  VectorX<T> x0_;
+
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{0.};
 
@@ -642,6 +652,11 @@ class Simulator {
   // AdvanceTo(). This collection is constructed within Initialize().
   std::unique_ptr<CompositeEventCollection<T>> witnessed_events_;
 
+  // The union of the per-step, timed, and witnessed events to be handled in
+  // AdvanceTo(). This collection is constructed within Initialize() so that
+  // AdvanceTo() can reuse it rather than allocate a new one on every call.
+  std::unique_ptr<CompositeEventCollection<T>> merged_events_;
+
   // Indicates when a timed or witnessed event needs to be handled on the next
   // call to AdvanceTo().
   bool timed_or_witnessed_event_triggered_{false};
@@ -812,6 +827,9 @@ void Simulator<T>::Initialize() {
   // Allocate the witness function collection.
   witnessed_events_ = system_.AllocateCompositeEventCollection();
 
+  // Allocate the collection of all events to be handled in a step.
+  merged_events_ = system_.AllocateCompositeEventCollection();
+
   // Do any publishes last. Merge the initialization events with per-step
   // events and current_time timed events (if any). We expect all initialization
   // events to precede any per-step or timed events in the merged collection.
@@ -885,7 +903,7 @@ void Simulator<T>::AdvanceTo(const T &boundary_time) {
   DRAKE_THROW_UNLESS(boundary_time >= context_->get_time());
 
   // Integrate until desired interval has completed.
-  auto merged_events = system_.AllocateCompositeEventCollection();
+  CompositeEventCollection<T>* const merged_events = merged_events_.get();
   DRAKE_DEMAND(timed_events_ != nullptr);
   DRAKE_DEMAND(witnessed_events_ != nullptr);
   DRAKE_DEMAND(merged_events != nullptr);
@@ -1148,7 +1166,8 @@ bool Simulator<T>::IntegrateContinuousState(
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  x0_.resize(context.num_continuous_states());
+  context.get_continuous_state().get_vector().CopyToPreSizedVector(&x0_);
 
   // Get the set of witness functions active at the current state.
   const System<T>& system = get_system();
@@ -1194,13 +1213,13 @@ bool Simulator<T>::IntegrateContinuousState(
     // events are only relevant iff at least one witness function is
     // successfully isolated (see IsolateWitnessTriggers() for details).
     IsolateWitnessTriggers(
-        witness_functions, w0_, t0, x0, tf, &triggered_witnesses_);
+        witness_functions, w0_, t0, x0_, tf, &triggered_witnesses_);
 
     // Store the state at x0 in the temporary continuous state. We only do this
     // if there are triggered witnesses (even though `witness_triggered` is
     // `true`, the witness might not have actually triggered after isolation).
     if (!triggered_witnesses_.empty())
-      event_handler_xc_->SetFromVector(x0);
+      event_handler_xc_->SetFromVector(x0_);
 
     // Store witness function(s) that triggered.
     for (const WitnessFunction<T>* fn : triggered_witnesses_) {
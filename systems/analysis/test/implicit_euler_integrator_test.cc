@@ -6,6 +6,7 @@
 #include "drake/systems/analysis/test_utilities/robertson_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_damper_system.h"
 #include "drake/systems/analysis/test_utilities/stiff_double_mass_spring_system.h"
+#include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/plants/spring_mass_system/spring_mass_system.h"
 
 namespace drake {
@@ -224,6 +225,10 @@ TEST_P(ImplicitIntegratorTest, MiscAPI) {
   EXPECT_EQ(integrator.get_jacobian_computation_scheme(),
             ImplicitEulerIntegrator<double>::JacobianComputationScheme::
                 kForwardDifference);
+  EXPECT_FALSE(integrator.get_use_sparse_jacobian());
+  integrator.set_use_sparse_jacobian(true);
+  EXPECT_TRUE(integrator.get_use_sparse_jacobian());
+  integrator.set_use_sparse_jacobian(false);
 
   // Test that setting the target accuracy and initial step size target is
   // successful.
@@ -786,6 +791,86 @@ TEST_P(ImplicitIntegratorTest, DiscontinuousSpringMassDamper) {
   CheckGeneralStatsValidity(&integrator);
 }
 
+// Integrate a Diagram of independent, overdamped mass-spring-damper systems,
+// whose Jacobian matrix is block diagonal, with and without exploiting
+// sparsity in the Jacobian matrix and using each Jacobian computation scheme.
+// Both must find the solution, but the sparse Jacobian matrices should be
+// cheaper to compute by numerical differentiation. Jacobian matrices are not
+// reused, so that many are computed.
+TEST_F(ImplicitIntegratorTest, SparseJacobian) {
+  const int num_systems = 4;
+  DiagramBuilder<double> builder;
+  std::vector<SpringMassDamperSystem<double>*> systems;
+  for (int i = 0; i < num_systems; ++i) {
+    const double spring_k = 1e4 * (i + 1);
+    const double damping_b = 1e3;
+    systems.push_back(builder.AddSystem<SpringMassDamperSystem<double>>(
+        spring_k, damping_b, mass_));
+  }
+  const std::unique_ptr<Diagram<double>> diagram = builder.Build();
+
+  // Set error controlled integration parameters.
+  const double xtol = 1e-3;
+  const double vtol = xtol * 100;
+  const double t_final = 1.0;
+
+  using Scheme = ImplicitEulerIntegrator<double>::JacobianComputationScheme;
+  for (Scheme scheme : {Scheme::kForwardDifference,
+                        Scheme::kCentralDifference, Scheme::kAutomatic}) {
+    // The average number of derivative evaluations per Jacobian matrix,
+    // without and with exploiting sparsity.
+    double evaluations_per_jacobian[2];
+    for (bool use_sparse : {false, true}) {
+      auto context = diagram->CreateDefaultContext();
+      context->EnableCaching();
+      for (int i = 0; i < num_systems; ++i) {
+        Context<double>& subcontext =
+            diagram->GetMutableSubsystemContext(*systems[i], context.get());
+        systems[i]->set_position(&subcontext, 0.1 * (i + 1));
+        systems[i]->set_velocity(&subcontext, -0.1);
+      }
+
+      ImplicitEulerIntegrator<double> integrator(*diagram, context.get());
+      integrator.set_maximum_step_size(large_dt_);
+      integrator.set_requested_minimum_step_size(small_dt_);
+      integrator.set_throw_on_minimum_step_size_violation(false);
+      integrator.set_reuse(false);
+      integrator.set_target_accuracy(xtol);
+      integrator.set_jacobian_computation_scheme(scheme);
+      integrator.set_use_sparse_jacobian(use_sparse);
+      integrator.Initialize();
+      integrator.IntegrateWithMultipleStepsToTime(t_final);
+
+      // Check the solution of each system.
+      for (int i = 0; i < num_systems; ++i) {
+        const Context<double>& subcontext =
+            diagram->GetSubsystemContext(*systems[i], *context);
+        double x_final_true, v_final_true;
+        systems[i]->GetClosedFormSolution(0.1 * (i + 1), -0.1, t_final,
+                                          &x_final_true, &v_final_true);
+        EXPECT_NEAR(systems[i]->get_position(subcontext), x_final_true, xtol);
+        EXPECT_NEAR(systems[i]->get_velocity(subcontext), v_final_true, vtol);
+      }
+
+      ASSERT_GT(integrator.get_num_jacobian_evaluations(), 1);
+      evaluations_per_jacobian[use_sparse] =
+          static_cast<double>(
+              integrator.get_num_derivative_evaluations_for_jacobian()) /
+          integrator.get_num_jacobian_evaluations();
+      CheckGeneralStatsValidity(&integrator);
+    }
+
+    // Each 2x2 block of the Jacobian matrix needs two colors, so numerical
+    // differentiation takes a third of the evaluations per Jacobian matrix
+    // (apart from those spent discovering the sparsity pattern). Automatic
+    // differentiation takes a single evaluation per Jacobian matrix either way.
+    if (scheme != Scheme::kAutomatic) {
+      EXPECT_LT(evaluations_per_jacobian[true],
+                evaluations_per_jacobian[false]);
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(test, ImplicitIntegratorTest,
     ::testing::Values(true, false));
 
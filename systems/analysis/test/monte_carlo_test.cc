@@ -169,6 +169,80 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// RandomGenerator has no operator==, so compare the next few draws instead.
+bool SameState(const RandomGenerator& a, const RandomGenerator& b) {
+  RandomGenerator a_copy(a);
+  RandomGenerator b_copy(b);
+  for (int i = 0; i < 10; ++i) {
+    if (a_copy() != b_copy()) { return false; }
+  }
+  return true;
+}
+
+// Confirm that the parallel implementation reproduces the serial results
+// exactly (including the order and the generator snapshots), when the
+// randomness comes from both the factory and the context.
+GTEST_TEST(MonteCarloSimulationTest, ParallelMatchesSerial) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    std::uniform_int_distribution<int> num_draws(0, 3);
+    // Consume a random number of samples, so that the per-sample generator
+    // state depends on all of the previous samples.
+    const int draws = num_draws(*generator);
+    for (int i = 0; i < draws; ++i) {
+      (*generator)();
+    }
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 25;
+
+  RandomGenerator serial_generator;
+  const auto serial = MonteCarloSimulation(
+      make_simulator, &GetScalarOutput, final_time, num_samples,
+      &serial_generator, kNoConcurrency);
+
+  for (const int num_parallel_executions : {2, 4, kUseHardwareConcurrency}) {
+    RandomGenerator parallel_generator;
+    const auto parallel = MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        &parallel_generator, num_parallel_executions);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (int i = 0; i < num_samples; ++i) {
+      EXPECT_EQ(parallel[i].output, serial[i].output);
+      EXPECT_TRUE(SameState(parallel[i].generator_snapshot,
+                            serial[i].generator_snapshot));
+    }
+    // The caller's generator is left in the same state, too.
+    EXPECT_TRUE(SameState(parallel_generator, serial_generator));
+  }
+}
+
+GTEST_TEST(MonteCarloSimulationTest, BadParallelism) {
+  const SimulatorFactory make_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput, 0.1, 2,
+                                    nullptr, 0),
+               std::runtime_error);
+}
+
+// Exceptions thrown by a sample on a worker thread reach the caller.
+GTEST_TEST(MonteCarloSimulationTest, ParallelException) {
+  const SimulatorFactory make_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const ScalarSystemFunction bad_output = [](const System<double>&,
+                                             const Context<double>&) -> double {
+    throw std::logic_error("bad output");
+  };
+  EXPECT_THROW(MonteCarloSimulation(make_simulator, bad_output, 0.1, 8,
+                                    nullptr, 4),
+               std::logic_error);
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
@@ -10,6 +10,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/analysis/explicit_euler_integrator.h"
@@ -2185,6 +2186,94 @@ GTEST_TEST(SimulatorTest, EvalDerivativesCounter) {
   EXPECT_EQ(simulator.get_integrator()->get_num_derivative_evaluations(), 24);
 }
 
+// A discrete-time system that exercises every kind of event that a fast
+// control loop might rely on: periodic discrete updates and publishes, and
+// per-step unrestricted updates of an abstract state.
+class SteadyStateDiscreteSystem : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SteadyStateDiscreteSystem)
+
+  SteadyStateDiscreteSystem() {
+    DeclareDiscreteState(2);
+    DeclareAbstractState(AbstractValue::Make<int>(0));
+    DeclareVectorOutputPort("x", BasicVector<double>(2),
+                            &SteadyStateDiscreteSystem::CopyStateOut);
+    DeclarePeriodicDiscreteUpdateEvent(
+        kPeriod, 0., &SteadyStateDiscreteSystem::Update);
+    DeclarePeriodicPublishEvent(
+        2 * kPeriod, 0., &SteadyStateDiscreteSystem::Publish);
+    DeclarePerStepEvent(UnrestrictedUpdateEvent<double>(
+        [](const Context<double>&, const UnrestrictedUpdateEvent<double>&,
+           State<double>* state) {
+          ++state->get_mutable_abstract_state<int>(0);
+        }));
+  }
+
+  static constexpr double kPeriod = 1e-3;
+
+  int num_publishes() const { return num_publishes_; }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* xd) const {
+    const BasicVector<double>& x = context.get_discrete_state(0);
+    (*xd)[0] = x[0] + 1.;
+    (*xd)[1] = 0.5 * x[1] + x[0];
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus Publish(const Context<double>& context) const {
+    get_output_port(0).Eval(context);
+    ++num_publishes_;
+    return EventStatus::Succeeded();
+  }
+
+  void CopyStateOut(const Context<double>& context,
+                    BasicVector<double>* output) const {
+    output->SetFrom(context.get_discrete_state(0));
+  }
+
+  mutable int num_publishes_{0};
+};
+
+// Once the simulator has been initialized and has taken a step, stepping a
+// discrete-time system must not allocate any heap memory, whether the system
+// is a LeafSystem or a Diagram.
+GTEST_TEST(SimulatorTest, SteadyStateSteppingDoesNotAllocate) {
+  const double h = SteadyStateDiscreteSystem::kPeriod;
+  // Some of the checks armed by DRAKE_ASSERT (e.g., of the type of a cache
+  // entry's value) allocate, so only release builds are held to the limit.
+  const int max_num_allocations = kDrakeAssertIsArmed ? -1 : 0;
+
+  SteadyStateDiscreteSystem leaf;
+  Simulator<double> leaf_simulator(leaf);
+
+  DiagramBuilder<double> builder;
+  builder.AddSystem<SteadyStateDiscreteSystem>();
+  auto* sub = builder.AddSystem<SteadyStateDiscreteSystem>();
+  auto diagram = builder.Build();
+  Simulator<double> diagram_simulator(*diagram);
+
+  for (Simulator<double>* simulator : {&leaf_simulator, &diagram_simulator}) {
+    simulator->AdvanceTo(10 * h);
+    {
+      drake::test::LimitMalloc guard({ .max_num_allocations =
+                                           max_num_allocations });
+      for (int i = 11; i <= 100; ++i) {
+        simulator->AdvanceTo(i * h);
+      }
+    }
+    EXPECT_EQ(simulator->get_num_discrete_updates(), 100);
+  }
+  EXPECT_EQ(leaf.num_publishes(), 51);
+  EXPECT_EQ(sub->num_publishes(), 51);
+  const Context<double>& sub_context =
+      diagram->GetSubsystemContext(*sub, diagram_simulator.get_context());
+  EXPECT_EQ(sub_context.get_discrete_state(0)[0], 100.);
+  EXPECT_EQ(sub_context.get_abstract_state<int>(0),
+            diagram_simulator.get_num_steps_taken());
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -1,10 +1,15 @@
 #include "drake/systems/controllers/linear_model_predictive_controller.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
-#include "drake/solvers/solve.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
@@ -14,6 +19,24 @@ namespace controllers {
 using solvers::VectorXDecisionVariable;
 using trajectory_optimization::DirectTranscription;
 
+namespace {
+
+// Returns the values of `vars` in the vector `x` of values of all of the
+// decision variables of `prog`.
+Eigen::VectorXd GetValues(
+    const solvers::MathematicalProgram& prog,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars,
+    const Eigen::VectorXd& x) {
+  const std::vector<int> indices = prog.FindDecisionVariableIndices(vars);
+  Eigen::VectorXd values(indices.size());
+  for (int i = 0; i < values.size(); ++i) {
+    values(i) = x(indices[i]);
+  }
+  return values;
+}
+
+}  // namespace
+
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
@@ -38,6 +61,11 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
       time_horizon_(time_horizon) {
   DRAKE_DEMAND(time_period_ > 0.);
   DRAKE_DEMAND(time_horizon_ > 0.);
+  if (base_context_ == nullptr) {
+    throw std::logic_error(
+        "LinearModelPredictiveController requires a base_context about which "
+        "to linearize the model");
+  }
 
   // Check that the model is SISO and has discrete states belonging to a single
   // group.
@@ -63,21 +91,35 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
     throw std::runtime_error("R must be positive definite");
   }
 
-  this->DeclarePeriodicDiscreteUpdate(time_period_);
-
-  if (base_context_ != nullptr) {
-    linear_model_ = Linearize(*model_, *base_context_);
-  }
+  linear_model_ = Linearize(*model_, *base_context_);
+  SetupQp();
+  // The structure of the QP never changes, so neither would the best solver.
+  solver_ = solvers::MakeSolver(solvers::ChooseBestSolver(*prog_));
+
+  // The warm start of the QP; NaN (no guess) until the first update.
+  const int num_vars = prog_->num_vars();
+  this->DeclareDiscreteState(Eigen::VectorXd::Constant(
+      num_vars, std::numeric_limits<double>::quiet_NaN()));
+  this->DeclarePeriodicDiscreteUpdateEvent(
+      time_period_, 0., &LinearModelPredictiveController<T>::UpdateWarmStart);
+
+  qp_solution_cache_index_ =
+      this->DeclareCacheEntry(
+              "QP solution", Eigen::VectorXd(num_vars),
+              &LinearModelPredictiveController<T>::CalcQpSolution,
+              {this->input_port_ticket(InputPortIndex(state_input_index_)),
+               this->xd_ticket()})
+          .cache_index();
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
-  const Eigen::VectorBlock<const VectorX<T>> current_state =
-      get_state_port().Eval(context);
-
+  const auto& solution =
+      this->get_cache_entry(qp_solution_cache_index_)
+          .template Eval<Eigen::VectorXd>(context);
   const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+      GetValues(*prog_, prog_->input(0), solution);
 
   const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
@@ -87,30 +129,70 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
-  DRAKE_DEMAND(linear_model_ != nullptr);
+void LinearModelPredictiveController<T>::SetupQp() {
+  num_sample_times_ = static_cast<int>(time_horizon_ / time_period_ + 0.5);
 
-  const int kNumSampleTimes =
-      static_cast<int>(time_horizon_ / time_period_ + 0.5);
+  prog_ = std::make_unique<DirectTranscription>(
+      linear_model_.get(), *base_context_, num_sample_times_);
 
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
+  const auto state_error = prog_->state();
+  const auto input_error = prog_->input();
 
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
+  prog_->AddRunningCost(state_error.transpose() * Q_ * state_error +
+                        input_error.transpose() * R_ * input_error);
 
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
+  // The right-hand side is set by SolveQp() before every solve.
+  initial_state_constraint_ =
+      prog_
+          ->AddLinearEqualityConstraint(
+              Eigen::MatrixXd::Identity(num_states_, num_states_),
+              Eigen::VectorXd::Zero(num_states_), prog_->initial_state())
+          .evaluator();
+}
 
+template <typename T>
+void LinearModelPredictiveController<T>::CalcQpSolution(
+    const Context<T>& context, Eigen::VectorXd* solution) const {
   const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
-
-  const auto result = Solve(prog);
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+  const Eigen::VectorXd initial_state_error =
+      get_state_port().Eval(context) - state_ref;
+  const VectorX<T>& initial_guess = context.get_discrete_state(0).get_value();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  initial_state_constraint_->set_bounds(initial_state_error,
+                                        initial_state_error);
+
+  const optional<Eigen::VectorXd> guess =
+      initial_guess.array().isNaN().all()
+          ? nullopt
+          : optional<Eigen::VectorXd>(initial_guess);
+  solvers::MathematicalProgramResult result;
+  solver_->Solve(*prog_, guess, {}, &result);
   DRAKE_DEMAND(result.is_success());
+  *solution = result.GetSolution();
+}
 
-  return prog.GetInputSamples(result).col(0);
+template <typename T>
+void LinearModelPredictiveController<T>::UpdateWarmStart(
+    const Context<T>& context, DiscreteValues<T>* discrete_state) const {
+  const auto& solution =
+      this->get_cache_entry(qp_solution_cache_index_)
+          .template Eval<Eigen::VectorXd>(context);
+
+  // Warm-start the next solve, one time period later, with this solution
+  // shifted forward by one sample; the last sample is repeated.
+  Eigen::VectorXd initial_guess = solution;
+  for (int i = 0; i < num_sample_times_; ++i) {
+    const int next = std::min(i + 1, num_sample_times_ - 1);
+    prog_->SetDecisionVariableValueInVector(
+        prog_->state(i), GetValues(*prog_, prog_->state(next), solution),
+        &initial_guess);
+    prog_->SetDecisionVariableValueInVector(
+        prog_->input(i), GetValues(*prog_, prog_->input(next), solution),
+        &initial_guess);
+  }
+  discrete_state->get_mutable_vector(0).SetFromVector(initial_guess);
 }
 
 template class LinearModelPredictiveController<double>;
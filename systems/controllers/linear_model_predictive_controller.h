@@ -1,10 +1,14 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/solvers/constraint.h"
+#include "drake/solvers/solver_interface.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -23,9 +27,20 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.
+///
+/// The QP is constructed once, when the controller is constructed; at each
+/// time step only the bounds of the initial-state constraint change.  The
+/// controller has a discrete state that holds the warm start of the QP: at
+/// each periodic update, it is set to the current solution, shifted forward
+/// by one time step, which solvers that accept an initial guess use as their
+/// starting point.  Every QP is solved by the same solver, the one that
+/// solvers::ChooseBestSolver() picks for the QP when the controller is
+/// constructed, so that a solver that keeps data between solves (as OSQP
+/// keeps its workspace and KKT factorization) does so from one step to the
+/// next.  The solution is cached in the Context, so the control output only
+/// depends on the Context; it does not depend on the warm start, up to the
+/// solver's tolerance.
 ///
 /// Instantiated templates for the following kinds of T's are provided:
 ///
@@ -61,6 +76,7 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   /// @pre base_context must have discrete states set as appropriate for the
   /// given @p model.  The input must also be initialized via
   /// `base_context->FixInputPort(0, u0)`, or otherwise initialized via Diagram.
+  /// @throws std::exception if @p base_context is nullptr.
   LinearModelPredictiveController(
       std::unique_ptr<systems::System<double>> model,
       std::unique_ptr<systems::Context<double>> base_context,
@@ -78,10 +94,20 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Sets up the DirectTranscription problem that is solved at every time
+  // step.  Only the initial-state constraint depends on the current state.
+  void SetupQp();
+
+  // Updates the initial-state constraint of the DirectTranscription problem to
+  // the current state and solves it, warm-started from the discrete state.
+  // This is the calculator of the cache entry for the QP's solution.
+  void CalcQpSolution(const Context<T>& context,
+                      Eigen::VectorXd* solution) const;
+
+  // Stores the cached QP solution, shifted forward by one sample, as the warm
+  // start of the next time step.
+  void UpdateWarmStart(const Context<T>& context,
+                       DiscreteValues<T>* discrete_state) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -101,6 +127,21 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The QP over the state and input errors at num_sample_times_ samples, built
+  // once by SetupQp(), and the constraint that pins its initial state error.
+  int num_sample_times_{};
+  std::unique_ptr<trajectory_optimization::DirectTranscription> prog_;
+  std::shared_ptr<solvers::LinearEqualityConstraint> initial_state_constraint_;
+
+  // Solves the QP; it is kept between solves.
+  std::unique_ptr<solvers::SolverInterface> solver_;
+
+  // Serializes the solves, which set the bounds of initial_state_constraint_
+  // right before solving.  The solution is a function of the Context only.
+  mutable std::mutex mutex_;
+
+  CacheIndex qp_solution_cache_index_;
 };
 
 }  // namespace controllers
@@ -81,6 +81,81 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
                               kTolerance));
 }
 
+// The QP is built once and re-solved, warm-started from the controller's
+// discrete state, for every new state. The result must not depend on the
+// states seen before.
+TEST_F(TestMpcWithDoubleIntegrator, RepeatedSolvesAgreeWithInfiniteHorizon) {
+  const double kTolerance = 1e-5;
+
+  const Eigen::Matrix2d A = system_->A();
+  const Eigen::Matrix<double, 2, 1> B = system_->B();
+  const Eigen::Matrix2d S = DiscreteAlgebraicRiccatiEquation(A, B, Q_, R_);
+  const Eigen::Matrix<double, 1, 2> K =
+      -(R_ + B.transpose() * S * B).inverse() * (B.transpose() * S * A);
+
+  auto context = dut_->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput();
+  std::unique_ptr<DiscreteValues<double>> update =
+      dut_->AllocateDiscreteVariables();
+  // The periodic update of the warm start.
+  std::unique_ptr<CompositeEventCollection<double>> events =
+      dut_->AllocateCompositeEventCollection();
+  dut_->CalcNextUpdateTime(*context, events.get());
+  ASSERT_TRUE(events->HasDiscreteUpdateEvents());
+
+  // There is no warm start before the first update.
+  EXPECT_TRUE(context->get_discrete_state(0).get_value().array().isNaN().all());
+
+  // Follow the closed-loop trajectory for a few steps, then jump to an
+  // unrelated state, and back.
+  Eigen::Matrix<double, 2, 7> states;
+  states.col(0) << 1., -0.5;
+  for (int i = 1; i < 5; ++i) {
+    states.col(i) = (A + B * K) * states.col(i - 1);
+  }
+  states.col(5) << -3., 2.;
+  states.col(6) = states.col(0);
+
+  for (int i = 0; i < states.cols(); ++i) {
+    const Eigen::Vector2d state = states.col(i);
+    context->FixInputPort(0, BasicVector<double>::Make(state(0), state(1)));
+    dut_->CalcOutput(*context, output.get());
+    EXPECT_TRUE(CompareMatrices(K * state,
+                                output->get_vector_data(0)->get_value(),
+                                kTolerance));
+
+    // Advance the warm start, as a periodic update would.
+    dut_->CalcDiscreteVariableUpdates(
+        *context, events->get_discrete_update_events(), update.get());
+    context->get_mutable_discrete_state().SetFrom(*update);
+    EXPECT_FALSE(
+        context->get_discrete_state(0).get_value().array().isNaN().any());
+  }
+}
+
+// The output is a function of the context only: two contexts with the same
+// input and warm start produce the same output, whatever was solved in
+// between.
+TEST_F(TestMpcWithDoubleIntegrator, OutputOnlyDependsOnContext) {
+  auto context = dut_->CreateDefaultContext();
+  auto other_context = dut_->CreateDefaultContext();
+  context->FixInputPort(0, BasicVector<double>::Make(1., -0.5));
+  other_context->FixInputPort(0, BasicVector<double>::Make(-3., 2.));
+
+  std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput();
+  dut_->CalcOutput(*context, output.get());
+  const Eigen::VectorXd first = output->get_vector_data(0)->get_value();
+
+  std::unique_ptr<SystemOutput<double>> other_output = dut_->AllocateOutput();
+  dut_->CalcOutput(*other_context, other_output.get());
+
+  auto same_context = dut_->CreateDefaultContext();
+  same_context->FixInputPort(0, BasicVector<double>::Make(1., -0.5));
+  dut_->CalcOutput(*same_context, output.get());
+  EXPECT_TRUE(
+      CompareMatrices(output->get_vector_data(0)->get_value(), first, 0.));
+}
+
 namespace {
 
 // A discrete-time cubic polynomial system.
@@ -236,6 +311,23 @@ TEST_F(TestMpcWithCubicSystem, TimeInvariantMpc) {
   EXPECT_TRUE(CompareMatrices(result, Eigen::Vector2d::Zero(), kTolerance));
 }
 
+GTEST_TEST(TestMpcConstructor, ThrowIfNoBaseContext) {
+  const auto A = Eigen::Matrix<double, 2, 2>::Identity();
+  const auto B = Eigen::Matrix<double, 2, 2>::Identity();
+  const auto C = Eigen::Matrix<double, 2, 2>::Identity();
+  const auto D = Eigen::Matrix<double, 2, 2>::Zero();
+
+  std::unique_ptr<LinearSystem<double>> system =
+      std::make_unique<LinearSystem<double>>(A, B, C, D, 1.);
+
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Eigen::Matrix2d R = Eigen::Matrix2d::Identity();
+
+  EXPECT_THROW(LinearModelPredictiveController<double>(
+      std::move(system), nullptr, Q, R, 1., 1.),
+               std::logic_error);
+}
+
 GTEST_TEST(TestMpcConstructor, ThrowIfRNotStrictlyPositiveDefinite) {
   const auto A = Eigen::Matrix<double, 2, 2>::Identity();
   const auto B = Eigen::Matrix<double, 2, 2>::Identity();
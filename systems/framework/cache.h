@@ -417,12 +417,11 @@ class CacheEntryValue {
   // (Internal use only) Returns a mutable reference to an unused cache entry
   // value object, which has no valid CacheIndex or DependencyTicket and has a
   // meaningless value. The reference is to a singleton %CacheEntryValue and
-  // will always return the same address. You may invoke mark_up_to_date()
-  // harmlessly on this object, but may not depend on its contents in any way as
-  // they may change unexpectedly. The intention is that this object is used as
-  // a common throw-away destination for non-cache DependencyTracker
-  // invalidations so that invalidation can be done unconditionally, and to the
-  // same memory location, for speed.
+  // will always return the same address. Since it is shared by all Contexts,
+  // which may be in use by different threads, it must not be modified. The
+  // intention is that this object is used as a common placeholder for
+  // non-cache DependencyTrackers so that their cache value pointer is never
+  // null.
   static CacheEntryValue& dummy() {
     static never_destroyed<CacheEntryValue> dummy;
     return dummy.access();
@@ -221,8 +221,13 @@ class ContinuousState {
     DRAKE_THROW_UNLESS(num_q() == other.num_q());
     DRAKE_THROW_UNLESS(num_v() == other.num_v());
     DRAKE_THROW_UNLESS(num_z() == other.num_z());
-    SetFromVector(other.CopyToVector().unaryExpr(
-        scalar_conversion::ValueConverter<T, U>{}));
+    // Copy element-wise so that no temporary vector is allocated.
+    const scalar_conversion::ValueConverter<T, U> converter{};
+    const VectorBase<U>& other_vector = other.get_vector();
+    VectorBase<T>& vector = this->get_mutable_vector();
+    for (int i = 0; i < size(); ++i) {
+      vector[i] = converter(other_vector[i]);
+    }
   }
 
   /// Sets the entire continuous state vector from an Eigen expression.
@@ -60,8 +60,10 @@ void DependencyTracker::NotePrerequisiteChange(
     return;
   }
   last_change_event_ = change_event;
-  // Invalidate associated cache entry value if any.
-  cache_value_->mark_out_of_date();
+  // Invalidate associated cache entry value if any. Non-cache trackers point
+  // to the shared dummy value, which must not be written since trackers in
+  // different Contexts can be notified concurrently from different threads.
+  if (has_associated_cache_entry_) cache_value_->mark_out_of_date();
   // Follow up with downstream subscribers.
   NotifySubscribers(change_event, depth);
 }
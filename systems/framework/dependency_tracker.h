@@ -124,12 +124,12 @@ nodes. */
 // DependencyTrackers for cache entries have to invalidate the associated cache
 // value when notified of prerequisite changes. That simply sets a bool that is
 // maintained by the CacheEntryValue object. This is an inner loop activity
-// that must be done very efficiently. It is faster to invalidate with
-// unconditional, inline code than to have a runtime test or abstract interface
-// for cache invalidation. To permit that, we allocate a static dummy
-// CacheEntryValue here, make it available for all non-cache DependencyTrackers
-// to "invalidate", and require that the definition of the cache invalidation
-// method is visible here rather than use an abstract interface to it.
+// that must be done very efficiently, so we require that the definition of the
+// cache invalidation method is visible here rather than use an abstract
+// interface to it. Non-cache DependencyTrackers point to a static dummy
+// CacheEntryValue so that cache_value_ is never null, but skip invalidating
+// it: the dummy is shared by all Contexts, which may be in use by different
+// threads at the same time.
 
 class DependencyTracker {
  public:
@@ -396,8 +396,8 @@ class DependencyTracker {
   // Pointer to the system name service of the owning subcontext.
   const internal::ContextMessageInterface* owning_subcontext_{nullptr};
 
-  // If false, cache_value_ will be set to point to CacheEntryValue::dummy() so
-  // we don't need to check during invalidation sweeps.
+  // If false, cache_value_ will be set to point to CacheEntryValue::dummy(),
+  // which is never invalidated.
   bool has_associated_cache_entry_{false};
   CacheEntryValue* cache_value_{nullptr};
 
@@ -16,6 +16,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/symbolic.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
 #include "drake/systems/framework/diagram_discrete_values.h"
@@ -86,10 +87,75 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
   template <typename U>
   explicit Diagram(const Diagram<U>& other)
-      : Diagram(other.template ConvertScalarType<T>()) {}
+      : Diagram(other.template ConvertScalarType<T>()) {
+    set_num_parallel_executions(other.get_num_parallel_executions());
+  }
 
   ~Diagram() override {}
 
+  /// Sets the number of threads used to evaluate this Diagram's immediate
+  /// subsystems concurrently. With the default of one, subsystems are
+  /// evaluated sequentially on the calling thread, in the order they were
+  /// added to the DiagramBuilder.
+  ///
+  /// With more than one thread, the following computations are carried out
+  /// in parallel over the subsystems, on a pool of threads owned by `this`
+  /// Diagram:
+  ///
+  /// - Time derivatives, see CalcTimeDerivatives().
+  /// - Discrete and unrestricted updates, see CalcDiscreteVariableUpdates()
+  ///   and CalcUnrestrictedUpdate().
+  ///
+  /// Publish events are still dispatched sequentially, since the order of
+  /// their side effects is observable.
+  ///
+  /// Before any of the above, every output port that feeds an input port of
+  /// another subsystem is brought up to date. This is done one level at a
+  /// time, where the level of an output port is one more than the highest
+  /// level among the output ports it depends on via direct feedthrough. Ports
+  /// within a level don't depend on each other, and are evaluated in
+  /// parallel. Once all connected ports are cached, the subsystems only read
+  /// shared data. The schedule of levels is computed once, by this method,
+  /// from the connection map and the subsystems' direct-feedthrough sparsity.
+  ///
+  /// The results are identical to those of the sequential evaluation, with
+  /// these caveats:
+  ///
+  /// - Connected output ports are evaluated even if no subsystem needs them
+  ///   for the computation at hand.
+  /// - If a subsystem throws, subsystems that were not yet started are skipped
+  ///   and the first exception is rethrown; which exception comes first is
+  ///   not deterministic.
+  /// - The subsystems' calculations for different subcontexts must be safe to
+  ///   run concurrently. That is true for Drake systems, but not necessarily
+  ///   for user systems that share mutable state outside of their Context.
+  ///
+  /// Parallel evaluation relies on caching, and falls back to sequential
+  /// evaluation for Contexts with caching disabled (see
+  /// ContextBase::DisableCaching()).
+  ///
+  /// @throws std::exception if `num_parallel_executions` is not positive.
+  void set_num_parallel_executions(int num_parallel_executions) {
+    if (num_parallel_executions < 1) {
+      throw std::logic_error(fmt::format(
+          "Diagram::set_num_parallel_executions(): the number of parallel "
+          "executions must be positive; got {}.", num_parallel_executions));
+    }
+    if (num_parallel_executions == get_num_parallel_executions()) return;
+    thread_pool_.reset();
+    if (num_parallel_executions > 1) {
+      if (output_port_levels_.empty()) CalcOutputPortLevels();
+      thread_pool_ = std::make_unique<drake::internal::ThreadPool>(
+          num_parallel_executions);
+    }
+  }
+
+  /// Returns the number of threads used to evaluate this Diagram's immediate
+  /// subsystems. See set_num_parallel_executions().
+  int get_num_parallel_executions() const {
+    return thread_pool_ == nullptr ? 1 : thread_pool_->num_threads();
+  }
+
   /// Returns the list of contained Systems.
   std::vector<const systems::System<T>*> GetSystems() const {
     std::vector<const systems::System<T>*> result;
@@ -312,12 +378,13 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     DRAKE_DEMAND(num_subsystems() == n);
 
     // Evaluate the derivatives of each constituent system.
-    for (SubsystemIndex i(0); i < n; ++i) {
+    const auto all = [](SubsystemIndex) { return true; };
+    ForEachSubsystem(*diagram_context, all, [&](SubsystemIndex i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       ContinuousState<T>& subderivatives =
           diagram_derivatives->get_mutable_substate(i);
       registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
-    }
+    });
   }
 
   /// Retrieves a reference to the subsystem with name @p name returned by
@@ -902,26 +969,28 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     *time = std::numeric_limits<double>::infinity();
 
     // Iterate over the subsystems, and harvest the most imminent updates.
-    std::vector<T> times(num_subsystems());
+    // Only the subsystems whose next update time equals *time keep their
+    // events. All of those are at or after `first_at_time`; the event
+    // collections of any earlier subsystems have already been cleared.
+    SubsystemIndex first_at_time(0);
     for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       CompositeEventCollection<T>& subinfo =
           info->get_mutable_subevent_collection(i);
       const T sub_time =
           registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-      times[i] = sub_time;
 
       if (sub_time < *time) {
+        // The events harvested so far are no longer the most imminent.
+        for (SubsystemIndex j = first_at_time; j < i; ++j) {
+          info->get_mutable_subevent_collection(j).Clear();
+        }
+        first_at_time = i;
         *time = sub_time;
+      } else if (sub_time > *time) {
+        subinfo.Clear();
       }
     }
-
-    // For all the subsystems whose next update time is bigger than *time,
-    // clear their event collections.
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-      if (times[i] > *time)
-        info->get_mutable_subevent_collection(i).Clear();
-    }
   }
 
  private:
@@ -1163,19 +1232,19 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
             event_info);
 
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const auto has_events = [&info](SubsystemIndex i) {
+      return info.get_subevent_collection(i).HasEvents();
+    };
+    ForEachSubsystem(*diagram_context, has_events, [&](SubsystemIndex i) {
       const EventCollection<DiscreteUpdateEvent<T>>& subinfo =
           info.get_subevent_collection(i);
+      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+      DiscreteValues<T>& subdiscrete =
+          diagram_discrete->get_mutable_subdiscrete(i);
 
-      if (subinfo.HasEvents()) {
-        const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-        DiscreteValues<T>& subdiscrete =
-            diagram_discrete->get_mutable_subdiscrete(i);
-
-        registered_systems_[i]->CalcDiscreteVariableUpdates(subcontext, subinfo,
-                                                            &subdiscrete);
-      }
-    }
+      registered_systems_[i]->CalcDiscreteVariableUpdates(subcontext, subinfo,
+                                                          &subdiscrete);
+    });
   }
 
   // For each subsystem, if there is an unrestricted update event in its
@@ -1197,18 +1266,119 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
         dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
             event_info);
 
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const auto has_events = [&info](SubsystemIndex i) {
+      return info.get_subevent_collection(i).HasEvents();
+    };
+    ForEachSubsystem(*diagram_context, has_events, [&](SubsystemIndex i) {
       const EventCollection<UnrestrictedUpdateEvent<T>>& subinfo =
           info.get_subevent_collection(i);
+      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+      State<T>& substate = diagram_state->get_mutable_substate(i);
+
+      registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subinfo,
+          &substate);
+    });
+  }
+
+  // Calls `calc(i)` for each subsystem index i for which `is_selected(i)` is
+  // true. If parallel evaluation is enabled (see
+  // set_num_parallel_executions()), this first brings all connected output
+  // ports up to date and then makes the calls concurrently. Otherwise the
+  // calls are made sequentially, in order, without any heap allocation.
+  template <typename IsSelected, typename Calc>
+  void ForEachSubsystem(const DiagramContext<T>& context,
+                        const IsSelected& is_selected, const Calc& calc) const {
+    // With caching disabled, cache entries are recomputed on every Eval() and
+    // therefore reading a connected output port is no longer read-only.
+    const bool parallel =
+        thread_pool_ != nullptr &&
+        !this->get_time_derivatives_cache_entry().is_cache_entry_disabled(
+            context);
+    if (!parallel) {
+      for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+        if (is_selected(i)) calc(i);
+      }
+      return;
+    }
+    std::vector<SubsystemIndex> subsystems;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (is_selected(i)) subsystems.push_back(i);
+    }
+    if (subsystems.size() <= 1) {
+      for (SubsystemIndex i : subsystems) calc(i);
+      return;
+    }
+    EvalConnectedOutputPorts(context);
+    thread_pool_->ParallelFor(
+        static_cast<int>(subsystems.size()),
+        [&subsystems, &calc](int k) { calc(subsystems[k]); });
+  }
+
+  // Brings up to date all output ports of the immediate subsystems that are
+  // connected to an input port of another subsystem, evaluating the ports in
+  // each of output_port_levels_ in parallel. Tasks within a level are grouped
+  // by subsystem so that no two threads touch the same subcontext.
+  void EvalConnectedOutputPorts(const DiagramContext<T>& context) const {
+    DRAKE_DEMAND(thread_pool_ != nullptr);
+    // Our own input ports might be computed by our parent Diagram. They are
+    // evaluated here, on the calling thread, so that subsystems with exported
+    // input ports only read cached values.
+    for (InputPortIndex i(0); i < this->num_input_ports(); ++i) {
+      this->EvalAbstractInput(context, i);
+    }
+    for (const auto& level : output_port_levels_) {
+      thread_pool_->ParallelFor(
+          static_cast<int>(level.size()), [this, &context, &level](int k) {
+            const SubsystemIndex i = level[k].first;
+            for (OutputPortIndex port_index : level[k].second) {
+              EvalSubsystemOutputPort(
+                  context, {registered_systems_[i].get(), port_index});
+            }
+          });
+    }
+  }
 
-      if (subinfo.HasEvents()) {
-        const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-        State<T>& substate = diagram_state->get_mutable_substate(i);
-
-        registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subinfo,
-            &substate);
+  // Computes output_port_levels_ from the connection map. Only output ports
+  // connected to a subsystem input port are included. The level of a port is
+  // zero if none of the inputs it has direct feedthrough from are connected
+  // to a subsystem output port, or else one more than the maximum level of
+  // those upstream output ports. Since the connection map has no algebraic
+  // loops, the levels are well defined.
+  void CalcOutputPortLevels() {
+    std::map<OutputPortLocator, int> levels;
+    std::function<int(const OutputPortLocator&)> calc_level =
+        [this, &levels, &calc_level](const OutputPortLocator& port) {
+          const auto it = levels.find(port);
+          if (it != levels.end()) return it->second;
+          const System<T>* const system = port.first;
+          int level = 0;
+          for (InputPortIndex i(0); i < system->num_input_ports(); ++i) {
+            const auto upstream_it = connection_map_.find({system, i});
+            if (upstream_it != connection_map_.end() &&
+                system->HasDirectFeedthrough(i, port.second)) {
+              level = std::max(level, calc_level(upstream_it->second) + 1);
+            }
+          }
+          levels[port] = level;
+          return level;
+        };
+    // Maps each level to the ports within it, grouped by subsystem.
+    std::map<int, std::map<SubsystemIndex, std::vector<OutputPortIndex>>>
+        ports_by_level;
+    for (const auto& connection : connection_map_) {
+      const OutputPortLocator& port = connection.second;
+      std::vector<OutputPortIndex>& subsystem_ports =
+          ports_by_level[calc_level(port)][GetSystemIndexOrAbort(port.first)];
+      if (std::find(subsystem_ports.begin(), subsystem_ports.end(),
+                    port.second) == subsystem_ports.end()) {
+        subsystem_ports.push_back(port.second);
       }
     }
+    output_port_levels_.clear();
+    for (const auto& level : ports_by_level) {
+      output_port_levels_.emplace_back(level.second.begin(),
+                                       level.second.end());
+    }
   }
 
   // Tries to recursively find @p target_system's BaseStuff
@@ -1615,6 +1785,17 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<OutputPortLocator> output_port_ids_;
 
+  // The connected output ports of the immediate subsystems, grouped by level
+  // and, within each level, by subsystem. See CalcOutputPortLevels(). Only
+  // computed when parallel evaluation is first enabled.
+  std::vector<std::vector<std::pair<SubsystemIndex,
+                                    std::vector<OutputPortIndex>>>>
+      output_port_levels_;
+
+  // The threads used for parallel evaluation of the subsystems, or nullptr if
+  // the evaluation is sequential. See set_num_parallel_executions().
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
@@ -158,9 +158,12 @@ class DiscreteValues {
     DRAKE_THROW_UNLESS(num_groups() == other.num_groups());
     for (int i = 0; i < num_groups(); i++) {
       DRAKE_THROW_UNLESS(data_[i] != nullptr);
-      data_[i]->set_value(
+      DRAKE_THROW_UNLESS(data_[i]->size() == other.get_vector(i).size());
+      // Assign the expression directly, rather than through set_value(), so
+      // that no temporary vector is allocated.
+      data_[i]->get_mutable_value() =
           other.get_vector(i).get_value().unaryExpr(
-              scalar_conversion::ValueConverter<T, U>{}));
+              scalar_conversion::ValueConverter<T, U>{});
     }
   }
 
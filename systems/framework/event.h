@@ -319,6 +319,22 @@ class Event {
     DoAddToComposite(trigger_type_, &*events);
   }
 
+  /**
+   * (Advanced) Adds `this` event itself, rather than a clone of it, to the
+   * event collection `events`. Unlike AddToComposite(), this does not
+   * allocate any heap memory once the collection's storage has grown to its
+   * steady-state size. See LeafEventCollection::add_event_reference().
+   * @pre `this` event must not have an unknown trigger type.
+   * @pre `this` event must outlive `events` and every collection that
+   *      `events` is merged into.
+   * @pre `events` must not be null.
+   */
+  void AddReferenceToComposite(CompositeEventCollection<T>* events) const {
+    DRAKE_DEMAND(events != nullptr);
+    DRAKE_DEMAND(trigger_type_ != TriggerType::kUnknown);
+    DoAddReferenceToComposite(&*events);
+  }
+
  protected:
   Event(const Event& other) : trigger_type_(other.trigger_type_) {
     if (other.event_data_ != nullptr)
@@ -338,6 +354,15 @@ class Event {
   virtual void DoAddToComposite(TriggerType trigger_type,
                                 CompositeEventCollection<T>* events) const = 0;
 
+  /**
+   * Derived classes should override this to add `this` Event itself to the
+   * event collection. The default implementation adds a clone instead.
+   */
+  virtual void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const {
+    DoAddToComposite(trigger_type_, events);
+  }
+
   /**
    * Derived classes must implement this method to clone themselves. Any
    * Event-specific data is cloned using the Clone() method. Data specific
@@ -423,6 +448,11 @@ class PublishEvent final : public Event<T> {
     events->add_publish_event(std::move(event));
   }
 
+  void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_publish_event_reference(this);
+  }
+
   // Clones PublishEvent-specific data.
   DRAKE_NODISCARD PublishEvent<T>* DoClone() const final {
     return new PublishEvent(*this);
@@ -503,6 +533,11 @@ class DiscreteUpdateEvent final : public Event<T> {
     events->add_discrete_update_event(std::move(event));
   }
 
+  void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_discrete_update_event_reference(this);
+  }
+
   // Clones DiscreteUpdateEvent-specific data.
   DRAKE_NODISCARD DiscreteUpdateEvent<T>* DoClone() const final {
     return new DiscreteUpdateEvent(this->get_trigger_type(), callback_);
@@ -582,6 +617,11 @@ class UnrestrictedUpdateEvent final : public Event<T> {
     events->add_unrestricted_update_event(std::move(event));
   }
 
+  void DoAddReferenceToComposite(
+      CompositeEventCollection<T>* events) const final {
+    events->add_unrestricted_update_event_reference(this);
+  }
+
   // Clones event data specific to UnrestrictedUpdateEvent.
   UnrestrictedUpdateEvent<T>* DoClone() const final {
     return new UnrestrictedUpdateEvent(*this);
@@ -322,8 +322,23 @@ class LeafEventCollection final : public EventCollection<EventType> {
    */
   void add_event(std::unique_ptr<EventType> event) override {
     DRAKE_DEMAND(event != nullptr);
+    events_.push_back(event.get());
     owned_events_.push_back(std::move(event));
-    events_.push_back(owned_events_.back().get());
+  }
+
+  /**
+   * (Advanced) Adds @p event to the existing collection without copying it
+   * and without taking ownership of it. Merging `this` into another
+   * collection adds @p event to that collection by reference, too. Once the
+   * storage for the events has grown to its steady-state size, adding and
+   * clearing references does not allocate heap memory, which is why systems
+   * use this to report the events they declared. Aborts if event is null.
+   * @pre @p event outlives `this` and every collection it is merged into.
+   */
+  void add_event_reference(const EventType* event) {
+    DRAKE_DEMAND(event != nullptr);
+    events_.push_back(event);
+    owned_events_.push_back(nullptr);
   }
 
   /**
@@ -332,7 +347,8 @@ class LeafEventCollection final : public EventCollection<EventType> {
   bool HasEvents() const override { return !events_.empty(); }
 
   /**
-   * Removes all events from this collection.
+   * Removes all events from this collection. The storage for the events is
+   * retained for reuse.
    */
   void Clear() override {
     owned_events_.clear();
@@ -356,6 +372,8 @@ class LeafEventCollection final : public EventCollection<EventType> {
    * <pre>
    *   EventType: {event1, event2, event3, event4}
    * </pre>
+   * Events owned by @p other_collection are cloned, while events that it
+   * refers to (see add_event_reference()) are referred to by `this`, too.
    *
    * @throws std::bad_cast if @p other_collection is not an instance of
    * LeafEventCollection.
@@ -365,16 +383,22 @@ class LeafEventCollection final : public EventCollection<EventType> {
         dynamic_cast<const LeafEventCollection<EventType>&>(other_collection);
 
     const std::vector<const EventType*>& other_events = other.get_events();
-    for (const EventType* other_event : other_events) {
-      this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+    for (size_t i = 0; i < other_events.size(); ++i) {
+      const EventType* other_event = other_events[i];
+      if (other.owned_events_[i] == nullptr) {
+        this->add_event_reference(other_event);
+      } else {
+        this->add_event(static_pointer_cast<EventType>(other_event->Clone()));
+      }
     }
   }
 
  private:
-  // Owned event unique pointers.
+  // Owned event unique pointers, index-aligned with events_. The entry is
+  // null for an event that was added by reference.
   std::vector<std::unique_ptr<EventType>> owned_events_;
 
-  // Points to the corresponding unique pointers. This is primarily used for
+  // Points to all of the events, owned or not. This is primarily used for
   // get_events().
   std::vector<const EventType*> events_;
 };
@@ -484,6 +508,45 @@ class CompositeEventCollection {
     events.add_event(std::move(event));
   }
 
+  /**
+   * Assuming the internal publish event collection is an instance of
+   * LeafEventCollection, adds a reference to the publish event @p event to it.
+   * See LeafEventCollection::add_event_reference().
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_publish_event_reference(const PublishEvent<T>* event) {
+    auto& events = dynamic_cast<LeafEventCollection<PublishEvent<T>>&>(
+        this->get_mutable_publish_events());
+    events.add_event_reference(event);
+  }
+
+  /**
+   * Assuming the internal discrete update event collection is an instance of
+   * LeafEventCollection, adds a reference to the discrete update event
+   * @p event to it. See LeafEventCollection::add_event_reference().
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_discrete_update_event_reference(
+      const DiscreteUpdateEvent<T>* event) {
+    auto& events = dynamic_cast<LeafEventCollection<DiscreteUpdateEvent<T>>&>(
+        this->get_mutable_discrete_update_events());
+    events.add_event_reference(event);
+  }
+
+  /**
+   * Assuming the internal unrestricted update event collection is an instance
+   * of LeafEventCollection, adds a reference to the unrestricted update event
+   * @p event to it. See LeafEventCollection::add_event_reference().
+   * @throws std::bad_cast if the assumption is incorrect.
+   */
+  void add_unrestricted_update_event_reference(
+      const UnrestrictedUpdateEvent<T>* event) {
+    auto& events =
+        dynamic_cast<LeafEventCollection<UnrestrictedUpdateEvent<T>>&>(
+            this->get_mutable_unrestricted_update_events());
+    events.add_event_reference(event);
+  }
+
   /**
    * Merges the contained homogeneous event collections (e.g.,
    * EventCollection<PublishEvent<T>>, EventCollection<DiscreteUpdateEvent<T>>,
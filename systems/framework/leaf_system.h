@@ -390,26 +390,23 @@ class LeafSystem : public System<T> {
       return;
     }
 
-    // Find the minimum next sample time across all registered events, and
-    // the set of registered events that will occur at that time.
-    std::vector<const Event<T>*> next_events;
+    // Find the minimum next sample time across all registered events.
     for (const auto& event_pair : periodic_events_) {
       const PeriodicEventData& event_data = event_pair.first;
-      const Event<T>* const event = event_pair.second.get();
       const T t =
           leaf_system_detail::GetNextSampleTime(event_data, context.get_time());
-      if (t < min_time) {
-        min_time = t;
-        next_events = {event};
-      } else if (t == min_time) {
-        next_events.push_back(event);
-      }
+      if (t < min_time) min_time = t;
     }
 
-    // Write out the events that fire at min_time.
+    // Write out the events that fire at min_time. The registered events are
+    // owned by this system, so `events` can refer to them rather than copy
+    // them; that keeps this allocation-free during a simulation.
     *time = min_time;
-    for (const Event<T>* event : next_events) {
-      event->AddToComposite(events);
+    for (const auto& event_pair : periodic_events_) {
+      const PeriodicEventData& event_data = event_pair.first;
+      const T t =
+          leaf_system_detail::GetNextSampleTime(event_data, context.get_time());
+      if (t == min_time) event_pair.second->AddReferenceToComposite(events);
     }
   }
 
@@ -2369,10 +2366,24 @@ class LeafSystem : public System<T> {
     this->DoCalcUnrestrictedUpdate(context, leaf_events.get_events(), state);
   }
 
+  // The per-step events are owned by this system, so `events` refers to them
+  // rather than copying them. The Simulator merges them into its own event
+  // collection on every step, which thus doesn't allocate.
   void DoGetPerStepEvents(
       const Context<T>&,
       CompositeEventCollection<T>* events) const override {
-    events->SetFrom(per_step_events_);
+    for (const auto* event :
+         per_step_events_.get_publish_events().get_events()) {
+      event->AddReferenceToComposite(events);
+    }
+    for (const auto* event :
+         per_step_events_.get_discrete_update_events().get_events()) {
+      event->AddReferenceToComposite(events);
+    }
+    for (const auto* event :
+         per_step_events_.get_unrestricted_update_events().get_events()) {
+      event->AddReferenceToComposite(events);
+    }
   }
 
   void DoGetInitializationEvents(
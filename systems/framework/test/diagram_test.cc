@@ -785,6 +785,37 @@ TEST_F(DiagramTest, CalcTimeDerivatives) {
   EXPECT_EQ(27, integrator1_xcdot.get_vector()[2]);
 }
 
+// Tests that evaluating the subsystems in parallel gives the same derivatives
+// as the sequential evaluation, with caching both on and off.
+TEST_F(DiagramTest, CalcTimeDerivativesInParallel) {
+  AttachInputs();
+  std::unique_ptr<ContinuousState<double>> expected =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, expected.get());
+
+  EXPECT_EQ(diagram_->get_num_parallel_executions(), 1);
+  diagram_->set_num_parallel_executions(3);
+  EXPECT_EQ(diagram_->get_num_parallel_executions(), 3);
+  for (bool caching : {true, false}) {
+    if (caching) {
+      context_->EnableCaching();
+    } else {
+      context_->DisableCaching();
+    }
+    context_->SetAllCacheEntriesOutOfDate();
+    std::unique_ptr<ContinuousState<double>> derivatives =
+        diagram_->AllocateTimeDerivatives();
+    diagram_->CalcTimeDerivatives(*context_, derivatives.get());
+    EXPECT_EQ(derivatives->CopyToVector(), expected->CopyToVector());
+  }
+
+  diagram_->set_num_parallel_executions(1);
+  EXPECT_EQ(diagram_->get_num_parallel_executions(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram_->set_num_parallel_executions(0), std::logic_error,
+      ".*number of parallel executions must be positive; got 0.*");
+}
+
 // Tests the AllocateInput logic.
 TEST_F(DiagramTest, AllocateInputs) {
   auto context = diagram_->CreateDefaultContext();
@@ -1806,6 +1837,26 @@ TEST_F(DiscreteStateTest, UpdateDiscreteVariables) {
   EXPECT_EQ(23.0, updates2[0]);
 }
 
+// Tests that both holds latch their inputs when their updates are evaluated
+// in parallel.
+TEST_F(DiscreteStateTest, UpdateDiscreteVariablesInParallel) {
+  diagram_.set_num_parallel_executions(2);
+  std::unique_ptr<DiscreteValues<double>> updates =
+      diagram_.AllocateDiscreteVariables();
+  context_->SetTime(11.5);
+  auto events = diagram_.AllocateCompositeEventCollection();
+  EXPECT_EQ(diagram_.CalcNextUpdateTime(*context_, events.get()), 12.0);
+  context_->SetTime(12.0);
+  diagram_.CalcDiscreteVariableUpdates(
+      *context_, events->get_discrete_update_events(), updates.get());
+  EXPECT_EQ(
+      diagram_.GetSubsystemDiscreteValues(*diagram_.hold1(), *updates)[0],
+      17.0);
+  EXPECT_EQ(
+      diagram_.GetSubsystemDiscreteValues(*diagram_.hold2(), *updates)[0],
+      23.0);
+}
+
 // Tests that a publish action is taken at 19 sec.
 TEST_F(DiscreteStateTest, Publish) {
   context_->SetTime(18.5);
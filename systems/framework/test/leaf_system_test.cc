@@ -856,6 +856,52 @@ TEST_F(LeafSystemTest, DeclarePerStepEvents) {
   }
 }
 
+// Tests that the events reported by CalcNextUpdateTime() and
+// GetPerStepEvents() refer to the events declared by the system, rather than
+// copies of them, and that merging preserves those references while still
+// copying owned events.
+TEST_F(LeafSystemTest, ReportedEventsAreReferences) {
+  system_.AddPeriodicUpdate();
+  system_.DeclarePerStepEvent(PublishEvent<double>());
+
+  context_.SetTime(2.0);
+  system_.CalcNextUpdateTime(context_, event_info_.get());
+  const DiscreteUpdateEvent<double>* const timed_event =
+      leaf_info_->get_discrete_update_events().get_events().front();
+  system_.CalcNextUpdateTime(context_, event_info_.get());
+  ASSERT_EQ(leaf_info_->get_discrete_update_events().get_events().size(), 1);
+  EXPECT_EQ(leaf_info_->get_discrete_update_events().get_events().front(),
+            timed_event);
+
+  auto per_step_events = system_.AllocateCompositeEventCollection();
+  system_.GetPerStepEvents(context_, per_step_events.get());
+  const auto& per_step_publish_events =
+      dynamic_cast<const LeafEventCollection<PublishEvent<double>>&>(
+          per_step_events->get_publish_events()).get_events();
+  ASSERT_EQ(per_step_publish_events.size(), 1);
+  const PublishEvent<double>* const per_step_event =
+      per_step_publish_events.front();
+  EXPECT_EQ(per_step_event->get_trigger_type(), TriggerType::kPerStep);
+
+  // Add an owned event, too.
+  PublishEvent<double>(TriggerType::kForced).AddToComposite(event_info_.get());
+  const PublishEvent<double>* const owned_event =
+      leaf_info_->get_publish_events().get_events().front();
+
+  auto merged_events = system_.AllocateCompositeEventCollection();
+  merged_events->Merge(*per_step_events);
+  merged_events->Merge(*event_info_);
+  const auto& merged = dynamic_cast<const LeafCompositeEventCollection<double>&>(
+      *merged_events);
+  ASSERT_EQ(merged.get_publish_events().get_events().size(), 2);
+  EXPECT_EQ(merged.get_publish_events().get_events()[0], per_step_event);
+  EXPECT_NE(merged.get_publish_events().get_events()[1], owned_event);
+  EXPECT_EQ(merged.get_publish_events().get_events()[1]->get_trigger_type(),
+            TriggerType::kForced);
+  ASSERT_EQ(merged.get_discrete_update_events().get_events().size(), 1);
+  EXPECT_EQ(merged.get_discrete_update_events().get_events()[0], timed_event);
+}
+
 // A system that exercises the model_value-based input and output ports,
 // as well as model-declared params.
 class DeclaredModelPortsSystem : public LeafSystem<double> {
@@ -18,8 +18,11 @@ using std::make_unique;
 namespace {
 constexpr int kStateIndexMessage = 0;
 constexpr int kStateIndexMessageCount = 1;
+constexpr int kBufferIndexMask = 3;
 }  // namespace
 
+constexpr int LcmSubscriberSystem::kFreshMessage;
+
 // TODO(jwnimmer-tri) The "serializer xor translator" disjoint implementations
 // within the method bodies below are not ideal, because of the code smell, and
 // because it is likely confusing for users.  We should take further steps to
@@ -39,7 +42,9 @@ LcmSubscriberSystem::LcmSubscriberSystem(
     : channel_(channel),
       translator_(translator),
       serializer_(std::move(serializer)),
-      fixed_encoded_size_(fixed_encoded_size) {
+      fixed_encoded_size_(fixed_encoded_size),
+      decoded_message_(serializer_ ? serializer_->CreateDefaultValue()
+                                   : nullptr) {
   DRAKE_DEMAND((translator_ != nullptr) != (serializer_ != nullptr));
   DRAKE_DEMAND(lcm);
 
@@ -119,6 +124,34 @@ void LcmSubscriberSystem::CopyLatestMessageInto(State<double>* state) const {
   }
 }
 
+const LcmSubscriberSystem::MessageBuffer&
+LcmSubscriberSystem::AcquireLatestMessage() const {
+  // If the receive thread has published a message since we last looked, swap
+  // our front buffer for it.  The acquire half of the exchange pairs with the
+  // release half of the exchange in HandleMessage(), so that the new front
+  // buffer's contents are visible to us.
+  if (middle_index_.load(std::memory_order_relaxed) & kFreshMessage) {
+    front_index_ =
+        middle_index_.exchange(front_index_, std::memory_order_acq_rel) &
+        kBufferIndexMask;
+  }
+  return buffers_[front_index_];
+}
+
+const AbstractValue& LcmSubscriberSystem::GetDecodedMessage(
+    const MessageBuffer& message) const {
+  DRAKE_DEMAND(serializer_ != nullptr);
+  DRAKE_DEMAND(message.count > 0);
+  if (message.count != decoded_message_count_) {
+    // Mark the cache invalid first, in case Deserialize() throws.
+    decoded_message_count_ = 0;
+    serializer_->Deserialize(
+        message.bytes.data(), message.bytes.size(), decoded_message_.get());
+    decoded_message_count_ = message.count;
+  }
+  return *decoded_message_;
+}
+
 // The decision to store the decoded message instead of the raw bytes in
 // state is to avoid repeated decoding in DoCalcOutput for the latter case.
 // However, this computational concern will not exist once caching is properly
@@ -127,14 +160,15 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToDiscreteState(
     DiscreteValues<double>* discrete_state) const {
   DRAKE_ASSERT(is_discrete_state());
 
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  std::lock_guard<std::mutex> lock(consumer_mutex_);
+  const MessageBuffer& message = AcquireLatestMessage();
+  if (message.count > 0) {
     if (translator_) {
       translator_->Deserialize(
-          received_message_.data(), received_message_.size(),
+          message.bytes.data(), message.bytes.size(),
           &discrete_state->get_mutable_vector(kStateIndexMessage));
     } else {
-      const int received_size = static_cast<int>(received_message_.size());
+      const int received_size = static_cast<int>(message.bytes.size());
       if (received_size > fixed_encoded_size_) {
         throw std::runtime_error(fmt::format(
             "LcmSubscriberSystem: Received {} message was {} bytes, not the "
@@ -144,12 +178,12 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToDiscreteState(
       auto& xd = discrete_state->get_mutable_vector(kStateIndexMessage);
       xd[0] = received_size;
       for (int i = 0; i < received_size; ++i) {
-        xd[i + 1] = received_message_[i];
+        xd[i + 1] = message.bytes[i];
       }
     }
   }
   discrete_state->get_mutable_vector(kStateIndexMessageCount)
-      .SetAtIndex(0, received_message_count_);
+      .SetAtIndex(0, message.count);
 }
 
 void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
@@ -157,14 +191,14 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
   DRAKE_ASSERT(is_abstract_state());
   DRAKE_ASSERT(serializer_ != nullptr);
 
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
-    serializer_->Deserialize(
-        received_message_.data(), received_message_.size(),
-        &abstract_state->get_mutable_value(kStateIndexMessage));
+  std::lock_guard<std::mutex> lock(consumer_mutex_);
+  const MessageBuffer& message = AcquireLatestMessage();
+  if (message.count > 0) {
+    abstract_state->get_mutable_value(kStateIndexMessage).SetFrom(
+        GetDecodedMessage(message));
   }
   abstract_state->get_mutable_value(kStateIndexMessageCount)
-      .get_mutable_value<int>() = received_message_count_;
+      .get_mutable_value<int>() = message.count;
 }
 
 int LcmSubscriberSystem::GetMessageCount(const Context<double>& context) const {
@@ -190,10 +224,7 @@ void LcmSubscriberSystem::DoCalcNextUpdateTime(
 
   // Do nothing unless we have a new message.
   const int last_message_count = GetMessageCount(context);
-  const int received_message_count = [this]() {
-    std::unique_lock<std::mutex> lock(received_message_mutex_);
-    return received_message_count_;
-  }();
+  const int received_message_count = received_message_count_.load();
   if (last_message_count == received_message_count) {
     return;
   }
@@ -272,13 +303,30 @@ void LcmSubscriberSystem::CalcSerializerOutputValue(
 void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   SPDLOG_TRACE(drake::log(), "Receiving LCM {} message", channel_);
 
+  // Fill in the back buffer; once its capacity has grown to the message size,
+  // this does not allocate.
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
-  received_message_count_++;
-  received_message_condition_variable_.notify_all();
+  const int new_count = received_message_count_.load() + 1;
+  MessageBuffer& back = buffers_[back_index_];
+  back.bytes.assign(rbuf_begin, rbuf_end);
+  back.count = new_count;
+
+  // Publish it as the middle buffer, and take the previous middle buffer (which
+  // the consumers are either done with or never looked at) as our next back
+  // buffer.
+  back_index_ = middle_index_.exchange(back_index_ | kFreshMessage,
+                                       std::memory_order_acq_rel) &
+                kBufferIndexMask;
+  received_message_count_.store(new_count);
+
+  // Wake up any WaitForMessage() callers.  The sequentially consistent
+  // operations on received_message_count_ and num_waiters_ ensure that a
+  // waiter either sees the new count before it blocks, or is seen by us here.
+  if (num_waiters_.load() > 0) {
+    { std::lock_guard<std::mutex> lock(waiter_mutex_); }
+    received_message_condition_variable_.notify_all();
+  }
 }
 
 int LcmSubscriberSystem::WaitForMessage(
@@ -291,51 +339,59 @@ int LcmSubscriberSystem::WaitForMessage(
   using Duration = Clock::duration;
   using TimePoint = Clock::time_point;
 
-  // The message buffer and counter are updated in HandleMessage(), which is
+  // The message buffers and counter are updated in HandleMessage(), which is
   // a callback function invoked by a different thread owned by the
-  // drake::lcm::DrakeLcmInterface instance passed to the constructor. Thus,
-  // for thread safety, these need to be properly protected by a mutex.
-  std::unique_lock<std::mutex> lock(received_message_mutex_);
+  // drake::lcm::DrakeLcmInterface instance passed to the constructor.  We
+  // block on a condition variable that it signals, but only while there is
+  // not yet a new message to return.
 
   // Predicate to handle spurious wakeup -- in other words, we can stop if we
   // detect a message has *actually* been received.
   auto message_received = [&]() {
-    return received_message_count_ > old_message_count;
+    return received_message_count_.load() > old_message_count;
   };
-  if (timeout <= 0) {
-    // No timeout.
-    received_message_condition_variable_.wait(lock, message_received);
-  } else {
-    // With timeout.
-
-    const Duration requested = std::chrono::duration_cast<Duration>(
-        std::chrono::duration<double>(timeout));
-    // Hour-encoding of ten years. Empirical evidence suggests that
-    // condition_variable::wait_* doesn't work over the full domain of otherwise
-    // valid Duration values (i.e., it can be "too large"). So, for
-    // exceptionally "large" timeouts, we cap it, silently, at ten years; if
-    // this proves too short for any given process, we can modify it later.
-    const Duration kMaxDuration(87600h);
-    const Duration duration =
-        requested < kMaxDuration ? requested : kMaxDuration;
-    DRAKE_ASSERT(TimePoint::max() - duration > Clock::now());
-    if (!received_message_condition_variable_.wait_for(lock, duration,
-                                                       message_received)) {
-      return received_message_count_;
+  if (!message_received()) {
+    std::unique_lock<std::mutex> lock(waiter_mutex_);
+    ++num_waiters_;
+    bool received = true;
+    if (timeout <= 0) {
+      // No timeout.
+      received_message_condition_variable_.wait(lock, message_received);
+    } else {
+      // With timeout.
+
+      const Duration requested = std::chrono::duration_cast<Duration>(
+          std::chrono::duration<double>(timeout));
+      // Hour-encoding of ten years. Empirical evidence suggests that
+      // condition_variable::wait_* doesn't work over the full domain of
+      // otherwise valid Duration values (i.e., it can be "too large"). So, for
+      // exceptionally "large" timeouts, we cap it, silently, at ten years; if
+      // this proves too short for any given process, we can modify it later.
+      const Duration kMaxDuration(87600h);
+      const Duration duration =
+          requested < kMaxDuration ? requested : kMaxDuration;
+      DRAKE_ASSERT(TimePoint::max() - duration > Clock::now());
+      received = received_message_condition_variable_.wait_for(
+          lock, duration, message_received);
+    }
+    --num_waiters_;
+    if (!received) {
+      return received_message_count_.load();
     }
   }
 
   if (message) {
-      serializer_->Deserialize(
-          received_message_.data(), received_message_.size(), message);
+    std::lock_guard<std::mutex> lock(consumer_mutex_);
+    const MessageBuffer& latest = AcquireLatestMessage();
+    message->SetFrom(GetDecodedMessage(latest));
+    return latest.count;
   }
 
-  return received_message_count_;
+  return received_message_count_.load();
 }
 
 int LcmSubscriberSystem::GetInternalMessageCount() const {
-  std::unique_lock<std::mutex> lock(received_message_mutex_);
-  return received_message_count_;
+  return received_message_count_.load();
 }
 
 const LcmAndVectorBaseTranslator& LcmSubscriberSystem::get_translator() const {
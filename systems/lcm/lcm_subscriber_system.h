@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -35,6 +37,16 @@ namespace lcm {
  * all these operations are taken care of by the Simulator. On the other hand,
  * the user needs to manually replicate this process without the Simulator.
  *
+ * Messages are handed off from the LCM receive thread to the simulation
+ * thread through a triple buffer, so that neither thread ever waits on the
+ * other: the receive thread copies each message's bytes into a spare buffer
+ * and publishes it with a single atomic exchange, and the simulation thread
+ * picks up the most recently published buffer the same way.  Messages that
+ * arrive faster than they are consumed are dropped, oldest first.  A message
+ * is deserialized at most once, when it is first consumed, no matter how many
+ * times it is subsequently copied into a State or returned by
+ * WaitForMessage().
+ *
  * If LCM service in use is a drake::lcm::DrakeLcmLog (not live operation),
  * then see drake::systems::lcm::LcmLogPlaybackSystem for a helper to advance
  * the log cursor in concert with the simulation.
@@ -243,17 +255,65 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   const std::unique_ptr<SerializerInterface> serializer_;
   const int fixed_encoded_size_;
 
-  // The mutex that guards received_message_ and received_message_count_.
-  mutable std::mutex received_message_mutex_;
-
-  // A condition variable that's signaled every time the handler is called.
-  mutable std::condition_variable received_message_condition_variable_;
-
-  // The bytes of the most recently received LCM message.
-  std::vector<uint8_t> received_message_;
+  // One buffer of the triple buffer that hands messages off from the LCM
+  // receive thread to its consumers.
+  struct MessageBuffer {
+    // The bytes of the LCM message.
+    std::vector<uint8_t> bytes;
+    // The value of received_message_count_ when this message was received,
+    // or zero if this buffer has never held a message.
+    int count{0};
+  };
+
+  // Returns the most recently received message, which is zero-count (i.e.,
+  // empty) if no messages have been received yet.  The caller must hold
+  // consumer_mutex_, and the result is only valid while it is held.
+  const MessageBuffer& AcquireLatestMessage() const;
+
+  // Returns the deserialization of `message`, decoding it only if it differs
+  // from the message decoded by the previous call.  The caller must hold
+  // consumer_mutex_, and the result is only valid while it is held.
+  // @pre serializer_ is non-null and message.count is positive.
+  const AbstractValue& GetDecodedMessage(const MessageBuffer& message) const;
+
+  // The triple buffer.  At any given time, one of the three buffers belongs to
+  // the receive thread (the "back" buffer), one belongs to the consumers (the
+  // "front" buffer), and the third one (the "middle" buffer) holds the most
+  // recently published message waiting to be consumed, if any.  Ownership of
+  // buffers only changes by swapping buffer indices with middle_, so that the
+  // contents of a buffer are never accessed by two threads at once.
+  std::array<MessageBuffer, 3> buffers_;
+
+  // The index of the back buffer.  Only accessed by the receive thread.
+  int back_index_{0};
+
+  // The index of the middle buffer.  When kFreshMessage is or-ed into the
+  // index, the middle buffer holds a message that the consumers haven't seen.
+  static constexpr int kFreshMessage = 4;
+  mutable std::atomic<int> middle_index_{1};
+
+  // Serializes the (const) consumers of received messages with one another;
+  // it is never held by the receive thread.  Guards front_index_,
+  // decoded_message_, and decoded_message_count_.
+  mutable std::mutex consumer_mutex_;
+
+  // The index of the front buffer.
+  mutable int front_index_{2};
+
+  // The deserialization of the message whose count is decoded_message_count_.
+  // Will be non-null iff serializer_ is non-null.
+  const std::unique_ptr<AbstractValue> decoded_message_;
+  mutable int decoded_message_count_{0};
 
   // A message counter that's incremented every time the handler is called.
-  int received_message_count_{0};
+  std::atomic<int> received_message_count_{0};
+
+  // The number of threads blocked in WaitForMessage(), and the mutex and
+  // condition variable on which they wait.  The handler only touches the
+  // mutex when there is a waiter to notify.
+  mutable std::atomic<int> num_waiters_{0};
+  mutable std::mutex waiter_mutex_;
+  mutable std::condition_variable received_message_condition_variable_;
 };
 
 }  // namespace lcm
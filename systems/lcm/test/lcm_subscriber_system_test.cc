@@ -1,7 +1,9 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
 #include <array>
+#include <atomic>
 #include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -285,6 +287,117 @@ GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
   EXPECT_GE(second_timeout_count.get(), old_count + 1);
 }
 
+// A Serializer that counts how many times it has deserialized a message.
+class CountingSerializer : public Serializer<lcmt_drake_signal> {
+ public:
+  void Deserialize(const void* message_bytes, int message_length,
+                   AbstractValue* abstract_value) const override {
+    ++num_deserialized;
+    Serializer<lcmt_drake_signal>::Deserialize(
+        message_bytes, message_length, abstract_value);
+  }
+
+  mutable int num_deserialized{0};
+};
+
+// Each received message is decoded only once, no matter how many times it is
+// copied out of the subscriber.
+GTEST_TEST(LcmSubscriberSystemTest, DecodeOncePerMessageTest) {
+  drake::lcm::DrakeMockLcm lcm;
+  const std::string channel_name = "channel_name";
+  auto owned_serializer = std::make_unique<CountingSerializer>();
+  const CountingSerializer& serializer = *owned_serializer;
+  LcmSubscriberSystem dut(channel_name, std::move(owned_serializer), &lcm);
+
+  // Nothing is decoded until a message arrives.
+  auto context = dut.CreateDefaultContext();
+  dut.CopyLatestMessageInto(&context->get_mutable_state());
+  EXPECT_EQ(dut.GetMessageCount(*context), 0);
+  EXPECT_EQ(serializer.num_deserialized, 0);
+
+  SampleData sample_data;
+  sample_data.MockPublish(&lcm, channel_name);
+  for (int i = 0; i < 3; ++i) {
+    auto new_context = dut.CreateDefaultContext();
+    dut.CopyLatestMessageInto(&new_context->get_mutable_state());
+    EXPECT_EQ(dut.GetMessageCount(*new_context), 1);
+    EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+        dut.get_output_port().Eval<lcmt_drake_signal>(*new_context),
+        sample_data.value));
+  }
+  Value<lcmt_drake_signal> message;
+  EXPECT_EQ(dut.WaitForMessage(0, &message), 1);
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      message.get_value(), sample_data.value));
+  EXPECT_EQ(serializer.num_deserialized, 1);
+
+  // A new message is decoded once more.
+  sample_data.value.timestamp += 1;
+  sample_data.MockPublish(&lcm, channel_name);
+  dut.CopyLatestMessageInto(&context->get_mutable_state());
+  dut.CopyLatestMessageInto(&context->get_mutable_state());
+  EXPECT_EQ(dut.GetMessageCount(*context), 2);
+  EXPECT_EQ(
+      dut.get_output_port().Eval<lcmt_drake_signal>(*context).timestamp,
+      sample_data.value.timestamp);
+  EXPECT_EQ(serializer.num_deserialized, 2);
+}
+
+// Messages received on one thread while another thread is consuming them are
+// always handed off intact, in order, and paired with their message count.
+GTEST_TEST(LcmSubscriberSystemTest, ConcurrentHandoffTest) {
+  drake::lcm::DrakeMockLcm lcm;
+  const std::string channel_name = "channel_name";
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  auto context = dut->CreateDefaultContext();
+
+  // Each message carries its own count in its timestamp, with a payload whose
+  // size varies from one message to the next.
+  const int kNumMessages = 2000;
+  std::atomic<bool> done{false};
+  std::thread receive_thread([&]() {
+    SampleData sample_data;
+    for (int i = 1; i <= kNumMessages; ++i) {
+      const int dim = i % 7;
+      sample_data.value.dim = dim;
+      sample_data.value.val.assign(dim, static_cast<double>(i));
+      sample_data.value.coord.assign(dim, std::to_string(i));
+      sample_data.value.timestamp = i;
+      sample_data.MockPublish(&lcm, channel_name);
+    }
+    done = true;
+  });
+
+  // Consume messages until the last one arrives.  (The ASSERTs return from
+  // the lambda, not the test, so that we still join the receive thread.)
+  auto consume = [&]() {
+    int last_count = 0;
+    while (last_count < kNumMessages) {
+      const bool was_done = done.load();
+      dut->CopyLatestMessageInto(&context->get_mutable_state());
+      const int count = dut->GetMessageCount(*context);
+      ASSERT_GE(count, last_count);
+      if (was_done) {
+        ASSERT_EQ(count, kNumMessages);
+      }
+      if (count > 0) {
+        const auto& message =
+            dut->get_output_port().Eval<lcmt_drake_signal>(*context);
+        ASSERT_EQ(message.timestamp, count);
+        ASSERT_EQ(message.dim, count % 7);
+        for (int j = 0; j < message.dim; ++j) {
+          ASSERT_EQ(message.val[j], count);
+          ASSERT_EQ(message.coord[j], std::to_string(count));
+        }
+      }
+      last_count = count;
+    }
+  };
+  consume();
+  receive_thread.join();
+  EXPECT_EQ(dut->GetInternalMessageCount(), kNumMessages);
+}
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 // Subscribe and output a custom VectorBase type.
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+namespace internal {
+
+/// A set of interchangeable scratch contexts for evaluating the dynamics of a
+/// System, so that the dynamic constraints of a trajectory optimization can be
+/// evaluated concurrently (e.g., by a solver that evaluates thread-safe
+/// constraints in parallel).  Each entry is a copy of the time, state, and
+/// parameters of the context given at construction, with input port 0 (if
+/// any) fixed, and comes with preallocated outputs for the time derivatives
+/// and discrete updates.
+///
+/// Entries are allocated on demand, so that a pool used from a single thread
+/// holds exactly one entry, and are returned to the pool when their Lease is
+/// destroyed.  Acquire() may be called concurrently from multiple threads.
+template <typename T>
+class ContextPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContextPool)
+
+  struct Entry {
+    std::unique_ptr<Context<T>> context;
+    /// The value fixed to input port 0, or nullptr if the system has no
+    /// inputs.  Owned by `context`.
+    FixedInputPortValue* input_port_value{nullptr};
+    std::unique_ptr<ContinuousState<T>> derivatives;
+    std::unique_ptr<DiscreteValues<T>> discrete_state;
+  };
+
+  /// Exclusive use of one Entry until destruction.  Move-only.
+  class Lease {
+   public:
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+    Lease(Lease&& other)
+        : pool_(other.pool_), entry_(std::move(other.entry_)) {}
+
+    ~Lease() {
+      if (entry_ != nullptr) pool_->Release(std::move(entry_));
+    }
+
+    Entry& operator*() const { return *entry_; }
+    Entry* operator->() const { return entry_.get(); }
+
+   private:
+    friend class ContextPool;
+
+    Lease(const ContextPool* pool, std::unique_ptr<Entry> entry)
+        : pool_(pool), entry_(std::move(entry)) {}
+
+    const ContextPool* const pool_;
+    std::unique_ptr<Entry> entry_;
+  };
+
+  /// @param system The system whose dynamics will be evaluated.  It is
+  ///    aliased for the lifetime of this object.
+  /// @param context Provides the time, state, and parameters of every entry.
+  ///    It is not aliased.
+  template <typename U>
+  ContextPool(const System<T>& system, const Context<U>& context)
+      : system_(system) {
+    DRAKE_DEMAND(system_.get_num_input_ports() <= 1);
+    prototype_ = MakeEntry(context);
+  }
+
+  /// Returns the context from which every entry is copied.
+  const Context<T>& prototype() const { return *prototype_->context; }
+
+  /// Returns an unused entry, allocating one if needed.  The time, state, and
+  /// input of the entry are those last written by any previous lease holder.
+  Lease Acquire() const {
+    std::unique_ptr<Entry> entry;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_.empty()) {
+        entry = std::move(free_.back());
+        free_.pop_back();
+      } else {
+        ++num_entries_;
+      }
+    }
+    if (entry == nullptr) {
+      entry = MakeEntry(*prototype_->context);
+    }
+    return Lease(this, std::move(entry));
+  }
+
+  /// Returns the number of entries allocated so far (not counting the
+  /// prototype).
+  int num_entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_entries_;
+  }
+
+ private:
+  template <typename U>
+  std::unique_ptr<Entry> MakeEntry(const Context<U>& context) const {
+    auto entry = std::make_unique<Entry>();
+    entry->context = system_.CreateDefaultContext();
+    entry->context->SetTimeStateAndParametersFrom(context);
+    if (system_.get_num_input_ports() > 0) {
+      entry->input_port_value = &entry->context->FixInputPort(
+          0, system_.AllocateInputVector(system_.get_input_port(0)));
+    }
+    entry->derivatives = system_.AllocateTimeDerivatives();
+    entry->discrete_state = system_.AllocateDiscreteVariables();
+    return entry;
+  }
+
+  void Release(std::unique_ptr<Entry> entry) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(std::move(entry));
+  }
+
+  const System<T>& system_;
+  std::unique_ptr<Entry> prototype_;
+
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<Entry>> free_;
+  mutable int num_entries_{0};
+};
+
+}  // namespace internal
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
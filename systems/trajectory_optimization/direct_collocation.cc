@@ -32,10 +32,6 @@ DirectCollocationConstraint::DirectCollocationConstraint(
                  Eigen::VectorXd::Zero(num_states),
                  Eigen::VectorXd::Zero(num_states)),
       system_(System<double>::ToAutoDiffXd(system)),
-      context_(system_->CreateDefaultContext()),
-      // Don't allocate the input port until we're past the point
-      // where we might throw.
-      derivatives_(system_->AllocateTimeDerivatives()),
       num_states_(num_states),
       num_inputs_(num_inputs) {
   DRAKE_THROW_UNLESS(system_->get_num_input_ports() <= 1);
@@ -44,24 +40,26 @@ DirectCollocationConstraint::DirectCollocationConstraint(
   // TODO(russt): Add support for time-varying dynamics OR check for
   // time-invariance.
 
-  context_->SetTimeStateAndParametersFrom(context);
+  // Don't allocate the contexts until we're past the point where we might
+  // throw.
+  context_pool_ =
+      std::make_unique<internal::ContextPool<AutoDiffXd>>(*system_, context);
 
-  if (context.get_num_input_ports() > 0) {
-    // Allocate the input port and keep an alias around.
-    input_port_value_ = &context_->FixInputPort(
-        0, system_->AllocateInputVector(system_->get_input_port(0)));
-  }
+  // Every evaluation leases its own context from the pool.
+  set_is_thread_safe(true);
 }
 
 void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
                                            const AutoDiffVecXd& input,
                                            AutoDiffVecXd* xdot) const {
-  if (context_->get_num_input_ports() > 0) {
-    input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(input);
+  const auto scratch = context_pool_->Acquire();
+  if (scratch->input_port_value != nullptr) {
+    scratch->input_port_value->GetMutableVectorData<AutoDiffXd>()
+        ->SetFromVector(input);
   }
-  context_->get_mutable_continuous_state().SetFromVector(state);
-  system_->CalcTimeDerivatives(*context_, derivatives_.get());
-  *xdot = derivatives_->CopyToVector();
+  scratch->context->get_mutable_continuous_state().SetFromVector(state);
+  system_->CalcTimeDerivatives(*scratch->context, scratch->derivatives.get());
+  *xdot = scratch->derivatives->CopyToVector();
 }
 
 void DirectCollocationConstraint::DoEval(
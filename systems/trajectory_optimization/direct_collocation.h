@@ -7,6 +7,7 @@
 #include "drake/solvers/constraint.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
+#include "drake/systems/trajectory_optimization/context_pool.h"
 #include "drake/systems/trajectory_optimization/multiple_shooting.h"
 
 namespace drake {
@@ -89,7 +90,9 @@ class DirectCollocation : public MultipleShooting {
 ///
 /// Note that the DirectCollocation implementation allocates only ONE of
 /// these constraints, but binds that constraint multiple times (with
-/// different decision variables, along the trajectory).
+/// different decision variables, along the trajectory).  The constraint is
+/// thread-safe: each evaluation leases its own scratch context, so the
+/// bindings may be evaluated concurrently.
 class DirectCollocationConstraint : public solvers::Constraint {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectCollocationConstraint)
@@ -122,9 +125,7 @@ class DirectCollocationConstraint : public solvers::Constraint {
                 AutoDiffVecXd* xdot) const;
 
   std::unique_ptr<System<AutoDiffXd>> system_;
-  std::unique_ptr<Context<AutoDiffXd>> context_;
-  FixedInputPortValue* input_port_value_{nullptr};
-  std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+  std::unique_ptr<internal::ContextPool<AutoDiffXd>> context_pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
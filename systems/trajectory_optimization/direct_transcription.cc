@@ -26,32 +26,28 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
 
   // @param evaluation_time  The time along the trajectory at which this
   // constraint is evaluated.
-  DiscreteTimeSystemConstraint(const System<AutoDiffXd>& system,
-                               Context<AutoDiffXd>* context,
-                               DiscreteValues<AutoDiffXd>* discrete_state,
-                               FixedInputPortValue* input_port_value,
-                               int num_states, int num_inputs,
-                               double evaluation_time)
+  DiscreteTimeSystemConstraint(
+      const System<AutoDiffXd>& system,
+      const internal::ContextPool<AutoDiffXd>* context_pool, int num_states,
+      int num_inputs, double evaluation_time)
       : Constraint(num_states, num_inputs + 2 * num_states,
                    Eigen::VectorXd::Zero(num_states),
                    Eigen::VectorXd::Zero(num_states)),
         system_(system),
-        context_(context),
-        input_port_value_(input_port_value),
-        discrete_state_(discrete_state),
+        context_pool_(context_pool),
         num_states_(num_states),
         num_inputs_(num_inputs),
         evaluation_time_(evaluation_time) {
     DRAKE_DEMAND(evaluation_time >= 0.0);
-    DRAKE_DEMAND(context_->has_only_discrete_state());
-    DRAKE_DEMAND(context_ != nullptr);
-    DRAKE_DEMAND(discrete_state_ != nullptr);
-    DRAKE_DEMAND(context_->get_num_input_ports() == 0 ||
-                 input_port_value_ != nullptr);
+    DRAKE_DEMAND(context_pool_ != nullptr);
+    DRAKE_DEMAND(context_pool_->prototype().has_only_discrete_state());
 
     // Makes sure the autodiff vector is properly initialized.
     evaluation_time_.derivatives().resize(2 * num_states_ + num_inputs_);
     evaluation_time_.derivatives().setZero();
+
+    // Every evaluation leases its own context from the pool.
+    set_is_thread_safe(true);
   }
 
   ~DiscreteTimeSystemConstraint() override = default;
@@ -75,15 +71,17 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
     const auto state = x.segment(num_inputs_, num_states_);
     const auto next_state = x.tail(num_states_);
 
-    context_->SetTime(evaluation_time_);
-    if (context_->get_num_input_ports() > 0) {
-      input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(
-          input);
+    const auto scratch = context_pool_->Acquire();
+    scratch->context->SetTime(evaluation_time_);
+    if (scratch->input_port_value != nullptr) {
+      scratch->input_port_value->GetMutableVectorData<AutoDiffXd>()
+          ->SetFromVector(input);
     }
-    context_->get_mutable_discrete_state(0).SetFromVector(state);
+    scratch->context->get_mutable_discrete_state(0).SetFromVector(state);
 
-    system_.CalcDiscreteVariableUpdates(*context_, discrete_state_);
-    *y = next_state - discrete_state_->get_vector(0).CopyToVector();
+    system_.CalcDiscreteVariableUpdates(*scratch->context,
+                                        scratch->discrete_state.get());
+    *y = next_state - scratch->discrete_state->get_vector(0).CopyToVector();
   }
 
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
@@ -94,9 +92,7 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
 
  private:
   const System<AutoDiffXd>& system_;
-  Context<AutoDiffXd>* const context_;
-  FixedInputPortValue* const input_port_value_;
-  DiscreteValues<AutoDiffXd>* const discrete_state_;
+  const internal::ContextPool<AutoDiffXd>* const context_pool_;
 
   const int num_states_{0};
   const int num_inputs_{0};
@@ -294,16 +290,8 @@ void DirectTranscription::AddAutodiffDynamicConstraints(
     const System<double>* system, const Context<double>& context) {
   system_ = system->ToAutoDiffXd();
   DRAKE_DEMAND(system_ != nullptr);
-  context_ = system_->CreateDefaultContext();
-  discrete_state_ = system_->AllocateDiscreteVariables();
-
-  context_->SetTimeStateAndParametersFrom(context);
-
-  if (context_->get_num_input_ports() > 0) {
-    // Allocate the input port and keep an alias around.
-    input_port_value_ = &context_->FixInputPort(
-        0, system_->AllocateInputVector(system_->get_input_port(0)));
-  }
+  context_pool_ =
+      std::make_unique<internal::ContextPool<AutoDiffXd>>(*system_, context);
 
   // For N-1 timesteps, add a constraint which depends on the knot
   // value along with the state and input vectors at that knot and the
@@ -311,8 +299,8 @@ void DirectTranscription::AddAutodiffDynamicConstraints(
   for (int i = 0; i < N() - 1; i++) {
     // Add the dynamic constraints.
     auto constraint = std::make_shared<DiscreteTimeSystemConstraint>(
-        *system_, context_.get(), discrete_state_.get(), input_port_value_,
-        num_states(), num_inputs(), i * fixed_timestep());
+        *system_, context_pool_.get(), num_states(), num_inputs(),
+        i * fixed_timestep());
 
     AddConstraint(constraint, {input(i), state(i), state(i + 1)});
   }
@@ -8,6 +8,7 @@
 #include "drake/systems/framework/system.h"
 #include "drake/systems/primitives/linear_system.h"
 #include "drake/systems/primitives/piecewise_polynomial_linear_system.h"
+#include "drake/systems/trajectory_optimization/context_pool.h"
 #include "drake/systems/trajectory_optimization/multiple_shooting.h"
 
 namespace drake {
@@ -142,10 +143,10 @@ class DirectTranscription : public MultipleShooting {
   // AutoDiff versions of the System components (for the constraints).
   // These values are allocated iff the dynamic constraints are allocated
   // as DiscreteTimeSystemConstraints, otherwise they are nullptr.
+  // The contexts are shared by all of the constraints, one per concurrent
+  // evaluation.
   std::unique_ptr<const System<AutoDiffXd>> system_;
-  std::unique_ptr<Context<AutoDiffXd>> context_;
-  std::unique_ptr<DiscreteValues<AutoDiffXd>> discrete_state_;
-  FixedInputPortValue* input_port_value_{nullptr};  // Owned by the context.
+  std::unique_ptr<internal::ContextPool<AutoDiffXd>> context_pool_;
 
   const bool discrete_time_system_{false};
 };
@@ -0,0 +1,118 @@
+#include "drake/systems/trajectory_optimization/context_pool.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace trajectory_optimization {
+namespace internal {
+namespace {
+
+// xdot = -x + u.
+std::unique_ptr<LinearSystem<double>> MakeSystem(double time_period) {
+  return std::make_unique<LinearSystem<double>>(
+      -Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Identity(),
+      Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Zero(), time_period);
+}
+
+GTEST_TEST(ContextPoolTest, EntriesAreCopiedAndReused) {
+  const auto system = MakeSystem(0.0);
+  auto context = system->CreateDefaultContext();
+  context->SetTime(1.5);
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Eigen::Vector2d(1.0, 2.0));
+
+  const ContextPool<double> pool(*system, *context);
+  EXPECT_EQ(pool.num_entries(), 0);
+  EXPECT_EQ(pool.prototype().get_time(), 1.5);
+
+  // Changes to the context after construction have no effect.
+  context->SetTime(3.0);
+
+  const Context<double>* first_context{};
+  {
+    const auto first = pool.Acquire();
+    const auto second = pool.Acquire();
+    EXPECT_EQ(pool.num_entries(), 2);
+    EXPECT_NE(first->context.get(), second->context.get());
+    for (const auto* entry : {&*first, &*second}) {
+      EXPECT_EQ(entry->context->get_time(), 1.5);
+      EXPECT_EQ(entry->context->get_continuous_state_vector().CopyToVector(),
+                Eigen::Vector2d(1.0, 2.0));
+      ASSERT_NE(entry->input_port_value, nullptr);
+      ASSERT_NE(entry->derivatives, nullptr);
+      ASSERT_NE(entry->discrete_state, nullptr);
+    }
+    first_context = first->context.get();
+
+    first->input_port_value->GetMutableVectorData<double>()->SetFromVector(
+        Eigen::Vector2d(3.0, 4.0));
+    system->CalcTimeDerivatives(*first->context, first->derivatives.get());
+    EXPECT_EQ(first->derivatives->CopyToVector(), Eigen::Vector2d(2.0, 2.0));
+  }
+
+  // Returned entries are handed out again rather than reallocated.
+  const auto again = pool.Acquire();
+  EXPECT_EQ(pool.num_entries(), 2);
+  EXPECT_EQ(again->context.get(), first_context);
+}
+
+GTEST_TEST(ContextPoolTest, DiscreteTime) {
+  const auto system = MakeSystem(0.1);
+  auto context = system->CreateDefaultContext();
+  context->get_mutable_discrete_state(0).SetFromVector(
+      Eigen::Vector2d(1.0, 2.0));
+
+  const ContextPool<double> pool(*system, *context);
+  const auto entry = pool.Acquire();
+  entry->input_port_value->GetMutableVectorData<double>()->SetFromVector(
+      Eigen::Vector2d::Zero());
+  system->CalcDiscreteVariableUpdates(*entry->context,
+                                      entry->discrete_state.get());
+  EXPECT_EQ(entry->discrete_state->get_vector(0).CopyToVector(),
+            Eigen::Vector2d(-1.0, -2.0));
+}
+
+// Concurrent lease holders never share an entry.
+GTEST_TEST(ContextPoolTest, Concurrent) {
+  const auto system = MakeSystem(0.0);
+  const auto context = system->CreateDefaultContext();
+  const ContextPool<double> pool(*system, *context);
+
+  const int kNumThreads = 4;
+  const int kNumIterations = 100;
+  std::vector<int> num_failures(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&system, &pool, &num_failures, i]() {
+      for (int j = 0; j < kNumIterations; ++j) {
+        const auto entry = pool.Acquire();
+        const Eigen::Vector2d x(i, j);
+        entry->context->get_mutable_continuous_state_vector().SetFromVector(x);
+        entry->input_port_value->GetMutableVectorData<double>()->SetFromVector(
+            Eigen::Vector2d::Zero());
+        system->CalcTimeDerivatives(*entry->context, entry->derivatives.get());
+        if (entry->derivatives->CopyToVector() != -x) ++num_failures[i];
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (int i = 0; i < kNumThreads; ++i) {
+    EXPECT_EQ(num_failures[i], 0);
+  }
+  EXPECT_GE(pool.num_entries(), 1);
+  EXPECT_LE(pool.num_entries(), kNumThreads);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace trajectory_optimization
+}  // namespace systems
+}  // namespace drake
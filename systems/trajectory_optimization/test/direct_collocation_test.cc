@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -114,6 +115,38 @@ GTEST_TEST(DirectCollocationTest, TestCollocationConstraint) {
   }
 }
 
+// The single collocation constraint shared by all of the segments may be
+// evaluated from several threads at once.
+GTEST_TEST(DirectCollocationTest, ConcurrentEvaluation) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const DirectCollocationConstraint constraint(*system, *context);
+  EXPECT_TRUE(constraint.is_thread_safe());
+
+  const int kNumThreads = 4;
+  std::vector<Eigen::VectorXd> x(kNumThreads);
+  std::vector<Eigen::VectorXd> y_expected(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    x[i] = Eigen::VectorXd::LinSpaced(constraint.num_vars(), 0.1, 1.0 + i);
+    constraint.Eval(x[i], &y_expected[i]);
+  }
+
+  std::vector<Eigen::VectorXd> y(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&constraint, &x, &y, i]() {
+      for (int j = 0; j < 100; ++j) {
+        constraint.Eval(x[i], &y[i]);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (int i = 0; i < kNumThreads; ++i) {
+    EXPECT_TRUE(CompareMatrices(y[i], y_expected[i], 0.0));
+  }
+}
+
 // Checks the collocation constraint value against the interpolation used
 // in the reconstructed trajectories.  This confirms that the reconstruction
 // is using the same interpolation algorithms as the actual optimization.